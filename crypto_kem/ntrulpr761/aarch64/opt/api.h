@@ -1,4 +1,6 @@
-#define CRYPTO_SECRETKEYBYTES 1294
-#define CRYPTO_PUBLICKEYBYTES 1039
-#define CRYPTO_CIPHERTEXTBYTES 1167
-#define CRYPTO_BYTES 32
+#include "crypto_kem_ntrulpr761.h"
+
+#define CRYPTO_SECRETKEYBYTES crypto_kem_ntrulpr761_SECRETKEYBYTES
+#define CRYPTO_PUBLICKEYBYTES crypto_kem_ntrulpr761_PUBLICKEYBYTES
+#define CRYPTO_CIPHERTEXTBYTES crypto_kem_ntrulpr761_CIPHERTEXTBYTES
+#define CRYPTO_BYTES crypto_kem_ntrulpr761_BYTES
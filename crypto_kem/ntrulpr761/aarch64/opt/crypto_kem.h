@@ -6,10 +6,18 @@
 #define crypto_kem_keypair crypto_kem_ntrulpr761_keypair
 #define crypto_kem_enc crypto_kem_ntrulpr761_enc
 #define crypto_kem_dec crypto_kem_ntrulpr761_dec
+#ifdef LPR
+#define crypto_kem_enc_context crypto_kem_ntrulpr761_enc_context
+#define crypto_kem_enc_ctx_init crypto_kem_ntrulpr761_enc_ctx_init
+#define crypto_kem_enc_ctx crypto_kem_ntrulpr761_enc_ctx
+#define crypto_kem_sk_expanded crypto_kem_ntrulpr761_sk_expanded
+#define crypto_kem_sk_expand crypto_kem_ntrulpr761_sk_expand
+#define crypto_kem_dec_expanded crypto_kem_ntrulpr761_dec_expanded
+#endif
 #define crypto_kem_PUBLICKEYBYTES crypto_kem_ntrulpr761_PUBLICKEYBYTES
 #define crypto_kem_SECRETKEYBYTES crypto_kem_ntrulpr761_SECRETKEYBYTES
 #define crypto_kem_BYTES crypto_kem_ntrulpr761_BYTES
 #define crypto_kem_CIPHERTEXTBYTES crypto_kem_ntrulpr761_CIPHERTEXTBYTES
-#define crypto_kem_PRIMITIVE "ntrulpr761"
+#define crypto_kem_PRIMITIVE crypto_kem_ntrulpr761_PRIMITIVE
 
 #endif
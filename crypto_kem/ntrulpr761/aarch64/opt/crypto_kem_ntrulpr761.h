@@ -1,10 +1,117 @@
 #ifndef crypto_kem_ntrulpr761_H
 #define crypto_kem_ntrulpr761_H
 
+/* parameter set selected in paramsmenu.h */
+#include "paramsmenu.h"
+
+/* sizes of the selected parameter set */
+#ifdef LPR
+#if defined(SIZE653)
+#define crypto_kem_ntrulpr761_ref_SECRETKEYBYTES 1125
+#define crypto_kem_ntrulpr761_ref_PUBLICKEYBYTES 897
+#define crypto_kem_ntrulpr761_ref_CIPHERTEXTBYTES 1025
+#define crypto_kem_ntrulpr761_ref_PRIMITIVE "ntrulpr653"
+#elif defined(SIZE761)
 #define crypto_kem_ntrulpr761_ref_SECRETKEYBYTES 1294
 #define crypto_kem_ntrulpr761_ref_PUBLICKEYBYTES 1039
 #define crypto_kem_ntrulpr761_ref_CIPHERTEXTBYTES 1167
+#define crypto_kem_ntrulpr761_ref_PRIMITIVE "ntrulpr761"
+#elif defined(SIZE857)
+#define crypto_kem_ntrulpr761_ref_SECRETKEYBYTES 1463
+#define crypto_kem_ntrulpr761_ref_PUBLICKEYBYTES 1184
+#define crypto_kem_ntrulpr761_ref_CIPHERTEXTBYTES 1312
+#define crypto_kem_ntrulpr761_ref_PRIMITIVE "ntrulpr857"
+#elif defined(SIZE953)
+#define crypto_kem_ntrulpr761_ref_SECRETKEYBYTES 1652
+#define crypto_kem_ntrulpr761_ref_PUBLICKEYBYTES 1349
+#define crypto_kem_ntrulpr761_ref_CIPHERTEXTBYTES 1477
+#define crypto_kem_ntrulpr761_ref_PRIMITIVE "ntrulpr953"
+#elif defined(SIZE1013)
+#define crypto_kem_ntrulpr761_ref_SECRETKEYBYTES 1773
+#define crypto_kem_ntrulpr761_ref_PUBLICKEYBYTES 1455
+#define crypto_kem_ntrulpr761_ref_CIPHERTEXTBYTES 1583
+#define crypto_kem_ntrulpr761_ref_PRIMITIVE "ntrulpr1013"
+#elif defined(SIZE1277)
+#define crypto_kem_ntrulpr761_ref_SECRETKEYBYTES 2231
+#define crypto_kem_ntrulpr761_ref_PUBLICKEYBYTES 1847
+#define crypto_kem_ntrulpr761_ref_CIPHERTEXTBYTES 1975
+#define crypto_kem_ntrulpr761_ref_PRIMITIVE "ntrulpr1277"
+#endif
+#else
+#if defined(SIZE653)
+#define crypto_kem_ntrulpr761_ref_SECRETKEYBYTES 1518
+#define crypto_kem_ntrulpr761_ref_PUBLICKEYBYTES 994
+#define crypto_kem_ntrulpr761_ref_CIPHERTEXTBYTES 897
+#define crypto_kem_ntrulpr761_ref_PRIMITIVE "sntrup653"
+#elif defined(SIZE761)
+#define crypto_kem_ntrulpr761_ref_SECRETKEYBYTES 1763
+#define crypto_kem_ntrulpr761_ref_PUBLICKEYBYTES 1158
+#define crypto_kem_ntrulpr761_ref_CIPHERTEXTBYTES 1039
+#define crypto_kem_ntrulpr761_ref_PRIMITIVE "sntrup761"
+#elif defined(SIZE857)
+#define crypto_kem_ntrulpr761_ref_SECRETKEYBYTES 1999
+#define crypto_kem_ntrulpr761_ref_PUBLICKEYBYTES 1322
+#define crypto_kem_ntrulpr761_ref_CIPHERTEXTBYTES 1184
+#define crypto_kem_ntrulpr761_ref_PRIMITIVE "sntrup857"
+#elif defined(SIZE953)
+#define crypto_kem_ntrulpr761_ref_SECRETKEYBYTES 2254
+#define crypto_kem_ntrulpr761_ref_PUBLICKEYBYTES 1505
+#define crypto_kem_ntrulpr761_ref_CIPHERTEXTBYTES 1349
+#define crypto_kem_ntrulpr761_ref_PRIMITIVE "sntrup953"
+#elif defined(SIZE1013)
+#define crypto_kem_ntrulpr761_ref_SECRETKEYBYTES 2417
+#define crypto_kem_ntrulpr761_ref_PUBLICKEYBYTES 1623
+#define crypto_kem_ntrulpr761_ref_CIPHERTEXTBYTES 1455
+#define crypto_kem_ntrulpr761_ref_PRIMITIVE "sntrup1013"
+#elif defined(SIZE1277)
+#define crypto_kem_ntrulpr761_ref_SECRETKEYBYTES 3059
+#define crypto_kem_ntrulpr761_ref_PUBLICKEYBYTES 2067
+#define crypto_kem_ntrulpr761_ref_CIPHERTEXTBYTES 1847
+#define crypto_kem_ntrulpr761_ref_PRIMITIVE "sntrup1277"
+#endif
+#endif
 #define crypto_kem_ntrulpr761_ref_BYTES 32
+
+#include <stdint.h>
+
+#ifdef LPR
+
+/* number of size-512 NTTs mod 6984193, i.e. GP0 in ntt/ntt_params.h */
+#if defined(SIZE653) || defined(SIZE761)
+#define crypto_kem_ntrulpr761_ref_NTTROWS 3
+#else
+#define crypto_kem_ntrulpr761_ref_NTTROWS 5
+#endif
+
+/* polynomial in the NTT domain: NTTROWS size-512 NTTs mod 6984193, or 3
+   size-512 NTTs mod 7681 followed by 3 size-512 NTTs mod 12289 (-D NTT16), or
+   the 63 size-48 Toom-Cook and Karatsuba operands (-D TOOM), or the 265 words
+   of the Kronecker substitution (-D KRONECKER); kem.c checks these sizes
+   against ntt/ntt_params.h */
+typedef union {
+  int32_t ntt32[crypto_kem_ntrulpr761_ref_NTTROWS][512];
+  int16_t ntt16[6][512];
+  int16_t toom[63][48];
+  uint64_t kron[265];
+} crypto_kem_ntrulpr761_ref_ntt;
+
+/* sk with a, G and A precomputed in the NTT domain */
+typedef struct {
+  crypto_kem_ntrulpr761_ref_ntt a;
+  crypto_kem_ntrulpr761_ref_ntt G;
+  crypto_kem_ntrulpr761_ref_ntt A;
+  unsigned char sk[crypto_kem_ntrulpr761_ref_SECRETKEYBYTES];
+} crypto_kem_ntrulpr761_ref_sk_expanded;
+
+/* pk with G and A precomputed in the NTT domain and the Hash4(pk) cache */
+typedef struct {
+  crypto_kem_ntrulpr761_ref_ntt G;
+  crypto_kem_ntrulpr761_ref_ntt A;
+  unsigned char pk[crypto_kem_ntrulpr761_ref_PUBLICKEYBYTES];
+  unsigned char cache[32];
+} crypto_kem_ntrulpr761_ref_enc_context;
+
+#endif
  
 #ifdef __cplusplus
 extern "C" {
@@ -12,6 +119,12 @@ extern "C" {
 extern int crypto_kem_ntrulpr761_ref_keypair(unsigned char *,unsigned char *);
 extern int crypto_kem_ntrulpr761_ref_enc(unsigned char *,unsigned char *,const unsigned char *);
 extern int crypto_kem_ntrulpr761_ref_dec(unsigned char *,const unsigned char *,const unsigned char *);
+#ifdef LPR
+extern int crypto_kem_ntrulpr761_ref_enc_ctx_init(crypto_kem_ntrulpr761_ref_enc_context *,const unsigned char *);
+extern int crypto_kem_ntrulpr761_ref_enc_ctx(unsigned char *,unsigned char *,const crypto_kem_ntrulpr761_ref_enc_context *);
+extern int crypto_kem_ntrulpr761_ref_sk_expand(crypto_kem_ntrulpr761_ref_sk_expanded *,const unsigned char *);
+extern int crypto_kem_ntrulpr761_ref_dec_expanded(unsigned char *,const unsigned char *,const crypto_kem_ntrulpr761_ref_sk_expanded *);
+#endif
 #ifdef __cplusplus
 }
 #endif
@@ -19,9 +132,18 @@ extern int crypto_kem_ntrulpr761_ref_dec(unsigned char *,const unsigned char *,c
 #define crypto_kem_ntrulpr761_keypair crypto_kem_ntrulpr761_ref_keypair
 #define crypto_kem_ntrulpr761_enc crypto_kem_ntrulpr761_ref_enc
 #define crypto_kem_ntrulpr761_dec crypto_kem_ntrulpr761_ref_dec
+#ifdef LPR
+#define crypto_kem_ntrulpr761_enc_context crypto_kem_ntrulpr761_ref_enc_context
+#define crypto_kem_ntrulpr761_enc_ctx_init crypto_kem_ntrulpr761_ref_enc_ctx_init
+#define crypto_kem_ntrulpr761_enc_ctx crypto_kem_ntrulpr761_ref_enc_ctx
+#define crypto_kem_ntrulpr761_sk_expanded crypto_kem_ntrulpr761_ref_sk_expanded
+#define crypto_kem_ntrulpr761_sk_expand crypto_kem_ntrulpr761_ref_sk_expand
+#define crypto_kem_ntrulpr761_dec_expanded crypto_kem_ntrulpr761_ref_dec_expanded
+#endif
 #define crypto_kem_ntrulpr761_PUBLICKEYBYTES crypto_kem_ntrulpr761_ref_PUBLICKEYBYTES
 #define crypto_kem_ntrulpr761_SECRETKEYBYTES crypto_kem_ntrulpr761_ref_SECRETKEYBYTES
 #define crypto_kem_ntrulpr761_BYTES crypto_kem_ntrulpr761_ref_BYTES
 #define crypto_kem_ntrulpr761_CIPHERTEXTBYTES crypto_kem_ntrulpr761_ref_CIPHERTEXTBYTES
+#define crypto_kem_ntrulpr761_PRIMITIVE crypto_kem_ntrulpr761_ref_PRIMITIVE
 
 #endif
@@ -0,0 +1,245 @@
+/* Switch to the text segment - this contains the program code */
+
+.text
+
+/* Provide function declarations */
+
+.global __asm_base_multiply
+.type __asm_base_multiply, %function
+
+.global __asm_base_multiply5
+.type __asm_base_multiply5, %function
+
+/* Provide macro definitions */
+
+/* Reduce the 64 bit accumulators { lo, hi } = X into a single vector of 32 bit
+ * integer coefficients using Montgomery reduction. We compute m = X · M^-1 mod
+ * 2^32 and subtract m · M, after which the lower 32 bits of every accumulator
+ * are zero. The upper 32 bits are then equal to X · 2^-32 mod M. */
+
+.macro montgomery_reduce out, lo, hi, tmp
+    uzp1    \tmp\().4s, \lo\().4s, \hi\().4s
+    mul     \tmp\().4s, \tmp\().4s, v31.4s[1]
+    smlsl   \lo\().2d, \tmp\().2s, v31.2s[0]
+    smlsl2  \hi\().2d, \tmp\().4s, v31.4s[0]
+    uzp2    \out\().4s, \lo\().4s, \hi\().4s
+.endm
+
+__asm_base_multiply:
+
+    /* Due to our choice of registers we do not need (to store) callee-saved
+     * registers. Neither do we use the procedure link register, as we do not
+     * branch to any functions from within this subroutine. The function
+     * prologue is therefore empty. */
+
+    /* Alias registers for a specific purpose (and readability) */
+
+    out     .req x0     // Store pointer to the first product coefficient
+    in_f    .req x1     // Store pointer to the first coefficient of F
+    in_g    .req x2     // Store pointer to the first coefficient of G
+    M       .req w14    // Store the constant value M = 6984193
+    M_inv   .req w15    // Store the constant value M^-1 mod 2^32 = 1926852097
+
+    /* Initialize constant values */
+
+    mov     M, #0x9201              // 6984193 (= M)
+    movk    M, #0x6a, lsl #16
+    mov     v31.4s[0], M
+
+    mov     M_inv, #0x6e01          // 1926852097 (= M^-1 mod 2^32)
+    movk    M_inv, #0x72d9, lsl #16
+    mov     v31.4s[1], M_inv
+
+    /* We multiply two degree 2 polynomials and reduce the result mod (x^3 - 1),
+     * for 4 columns of the GP0xGP1 matrices at a time. The rows of each matrix
+     * are 512 integer coefficients, i.e. 2048 bytes, apart. Each product is
+     * accumulated exactly in 64 bits before it is reduced:
+     *
+     * C[0] = F[0] · G[0] + F[1] · G[2] + F[2] · G[1]
+     * C[1] = F[0] · G[1] + F[1] · G[0] + F[2] · G[2]
+     * C[2] = F[0] · G[2] + F[1] · G[1] + F[2] · G[0]
+     *
+     * We need to repeat this sequence 128 times. We can take 4 columns in one
+     * go and 512 / 4 = 128. */
+
+    .rept 128
+
+    ldr     q0, [in_f, #2048 * 0]
+    ldr     q3, [in_g, #2048 * 0]
+    ldr     q4, [in_g, #2048 * 1]
+    ldr     q5, [in_g, #2048 * 2]
+
+    smull   v16.2d, v0.2s, v3.2s
+    ldr     q1, [in_f, #2048 * 1]
+    smull2  v17.2d, v0.4s, v3.4s
+    ldr     q2, [in_f, #2048 * 2]
+    smull   v18.2d, v0.2s, v4.2s
+    add     in_f, in_f, #16
+    smull2  v19.2d, v0.4s, v4.4s
+    add     in_g, in_g, #16
+    smull   v20.2d, v0.2s, v5.2s
+    smull2  v21.2d, v0.4s, v5.4s
+
+    smlal   v16.2d, v1.2s, v5.2s
+    smlal2  v17.2d, v1.4s, v5.4s
+    smlal   v18.2d, v1.2s, v3.2s
+    smlal2  v19.2d, v1.4s, v3.4s
+    smlal   v20.2d, v1.2s, v4.2s
+    smlal2  v21.2d, v1.4s, v4.4s
+
+    smlal   v16.2d, v2.2s, v4.2s
+    smlal2  v17.2d, v2.4s, v4.4s
+    smlal   v18.2d, v2.2s, v5.2s
+    smlal2  v19.2d, v2.4s, v5.4s
+    smlal   v20.2d, v2.2s, v3.2s
+    smlal2  v21.2d, v2.4s, v3.4s
+
+    montgomery_reduce v24, v16, v17, v6
+    montgomery_reduce v25, v18, v19, v7
+    str     q24, [out, #2048 * 0]
+    montgomery_reduce v26, v20, v21, v22
+    str     q25, [out, #2048 * 1]
+    str     q26, [out, #2048 * 2]
+
+    add     out, out, #16
+
+    .endr
+
+    .unreq  out
+    .unreq  in_f
+    .unreq  in_g
+    .unreq  M
+    .unreq  M_inv
+
+    ret     lr
+
+__asm_base_multiply5:
+
+    /* Due to our choice of registers we do not need (to store) callee-saved
+     * registers. Neither do we use the procedure link register, as we do not
+     * branch to any functions from within this subroutine. The function
+     * prologue is therefore empty. */
+
+    /* Alias registers for a specific purpose (and readability) */
+
+    out     .req x0     // Store pointer to the first product coefficient
+    in_f    .req x1     // Store pointer to the first coefficient of F
+    in_g    .req x2     // Store pointer to the first coefficient of G
+    M       .req w14    // Store the constant value M = 6984193
+    M_inv   .req w15    // Store the constant value M^-1 mod 2^32 = 1926852097
+
+    /* Initialize constant values */
+
+    mov     M, #0x9201              // 6984193 (= M)
+    movk    M, #0x6a, lsl #16
+    mov     v31.4s[0], M
+
+    mov     M_inv, #0x6e01          // 1926852097 (= M^-1 mod 2^32)
+    movk    M_inv, #0x72d9, lsl #16
+    mov     v31.4s[1], M_inv
+
+    /* This is the equivalent of __asm_base_multiply() for GP0 = 5, i.e. we
+     * multiply two degree 4 polynomials and reduce the result mod (x^5 - 1):
+     *
+     * C[k] = F[0] · G[k] + F[1] · G[k-1] + ... + F[4] · G[k-4]
+     *
+     * where the indices of G are taken mod 5. The 25 products of 4 columns are
+     * accumulated exactly in 64 bits in v21, ..., v30. The sums of 5 products
+     * of integer coefficients below 2^27 fit in 64 bits.
+     *
+     * We need to repeat this sequence 128 times. We can take 4 columns in one
+     * go and 512 / 4 = 128. */
+
+    .rept 128
+
+    ldr     q0, [in_f, #2048 * 0]
+    ldr     q1, [in_f, #2048 * 1]
+    ldr     q2, [in_f, #2048 * 2]
+    ldr     q3, [in_f, #2048 * 3]
+    ldr     q4, [in_f, #2048 * 4]
+    ldr     q16, [in_g, #2048 * 0]
+    ldr     q17, [in_g, #2048 * 1]
+    ldr     q18, [in_g, #2048 * 2]
+    ldr     q19, [in_g, #2048 * 3]
+    ldr     q20, [in_g, #2048 * 4]
+
+    add     in_f, in_f, #16
+    add     in_g, in_g, #16
+
+    smull   v21.2d, v0.2s, v16.2s
+    smull2  v22.2d, v0.4s, v16.4s
+    smull   v23.2d, v0.2s, v17.2s
+    smull2  v24.2d, v0.4s, v17.4s
+    smull   v25.2d, v0.2s, v18.2s
+    smull2  v26.2d, v0.4s, v18.4s
+    smull   v27.2d, v0.2s, v19.2s
+    smull2  v28.2d, v0.4s, v19.4s
+    smull   v29.2d, v0.2s, v20.2s
+    smull2  v30.2d, v0.4s, v20.4s
+
+    smlal   v21.2d, v1.2s, v20.2s
+    smlal2  v22.2d, v1.4s, v20.4s
+    smlal   v23.2d, v1.2s, v16.2s
+    smlal2  v24.2d, v1.4s, v16.4s
+    smlal   v25.2d, v1.2s, v17.2s
+    smlal2  v26.2d, v1.4s, v17.4s
+    smlal   v27.2d, v1.2s, v18.2s
+    smlal2  v28.2d, v1.4s, v18.4s
+    smlal   v29.2d, v1.2s, v19.2s
+    smlal2  v30.2d, v1.4s, v19.4s
+
+    smlal   v21.2d, v2.2s, v19.2s
+    smlal2  v22.2d, v2.4s, v19.4s
+    smlal   v23.2d, v2.2s, v20.2s
+    smlal2  v24.2d, v2.4s, v20.4s
+    smlal   v25.2d, v2.2s, v16.2s
+    smlal2  v26.2d, v2.4s, v16.4s
+    smlal   v27.2d, v2.2s, v17.2s
+    smlal2  v28.2d, v2.4s, v17.4s
+    smlal   v29.2d, v2.2s, v18.2s
+    smlal2  v30.2d, v2.4s, v18.4s
+
+    smlal   v21.2d, v3.2s, v18.2s
+    smlal2  v22.2d, v3.4s, v18.4s
+    smlal   v23.2d, v3.2s, v19.2s
+    smlal2  v24.2d, v3.4s, v19.4s
+    smlal   v25.2d, v3.2s, v20.2s
+    smlal2  v26.2d, v3.4s, v20.4s
+    smlal   v27.2d, v3.2s, v16.2s
+    smlal2  v28.2d, v3.4s, v16.4s
+    smlal   v29.2d, v3.2s, v17.2s
+    smlal2  v30.2d, v3.4s, v17.4s
+
+    smlal   v21.2d, v4.2s, v17.2s
+    smlal2  v22.2d, v4.4s, v17.4s
+    smlal   v23.2d, v4.2s, v18.2s
+    smlal2  v24.2d, v4.4s, v18.4s
+    smlal   v25.2d, v4.2s, v19.2s
+    smlal2  v26.2d, v4.4s, v19.4s
+    smlal   v27.2d, v4.2s, v20.2s
+    smlal2  v28.2d, v4.4s, v20.4s
+    smlal   v29.2d, v4.2s, v16.2s
+    smlal2  v30.2d, v4.4s, v16.4s
+
+    montgomery_reduce v0, v21, v22, v5
+    montgomery_reduce v1, v23, v24, v6
+    montgomery_reduce v2, v25, v26, v7
+    montgomery_reduce v3, v27, v28, v16
+    montgomery_reduce v4, v29, v30, v17
+    str     q0, [out, #2048 * 0]
+    str     q1, [out, #2048 * 1]
+    str     q2, [out, #2048 * 2]
+    str     q3, [out, #2048 * 3]
+    str     q4, [out, #2048 * 4]
+
+    add     out, out, #16
+
+    .endr
+
+    .unreq  out
+    .unreq  in_f
+    .unreq  in_g
+    .unreq  M
+    .unreq  M_inv
+
+    ret     lr
@@ -0,0 +1,138 @@
+/* Switch to the text segment - this contains the program code */
+
+.text
+
+/* Provide function declarations */
+
+.global __asm_decode_split
+.type __asm_decode_split, %function
+
+/* Provide macro definitions */
+
+/* Compute x = x mod m and q = x / m for the 4 lanes of x, with the same steps
+ * as uint32_divmod_uint14(). The vectors v28 and v29 hold v = 2^31 / m and m,
+ * the vectors v20 - v23 are used as temporary registers. */
+
+.macro divmod x, q
+    umull   v20.2d, \x\().2s, v28.2s
+    umull2  v21.2d, \x\().4s, v28.4s
+    shrn    \q\().2s, v20.2d, #31
+    shrn2   \q\().4s, v21.2d, #31
+    mls     \x\().4s, \q\().4s, v29.4s
+
+    umull   v20.2d, \x\().2s, v28.2s
+    umull2  v21.2d, \x\().4s, v28.4s
+    shrn    v22.2s, v20.2d, #31
+    shrn2   v22.4s, v21.2d, #31
+    mls     \x\().4s, v22.4s, v29.4s
+    add     \q\().4s, \q\().4s, v22.4s
+
+    /* Now x <= m, so x - m is either negative or zero. The mask v22 is -1 if
+     * x >= m, in which case q is incremented, otherwise m is added back. */
+
+    sub     \x\().4s, \x\().4s, v29.4s
+    cmge    v22.4s, \x\().4s, #0
+    bic     v23.16b, v29.16b, v22.16b
+    add     \x\().4s, \x\().4s, v23.4s
+    sub     \q\().4s, \q\().4s, v22.4s
+.endm
+
+/* Split the 8 completed integers in v2 (pairs 0 - 3) and v3 (pairs 4 - 7) and
+ * store the interleaved pairs to R. The quotients are reduced mod m once more,
+ * which is only needed for invalid inputs. */
+
+.macro split
+    divmod  v2, v4
+    divmod  v3, v5
+    divmod  v4, v6
+    divmod  v5, v6
+    xtn     v16.4h, v2.4s
+    xtn2    v16.8h, v3.4s
+    xtn     v17.4h, v4.4s
+    xtn2    v17.8h, v5.4s
+    st2     {v16.8h, v17.8h}, [R], #32
+.endm
+
+__asm_decode_split:
+
+    /* Due to our choice of registers we do not need (to store) callee-saved
+     * registers. Neither do we use the procedure link register, as we do not
+     * branch to any functions from within this subroutine. The function
+     * prologue is therefore empty. */
+
+    /* Alias registers for a specific purpose (and readability) */
+
+    R       .req x0     // Store pointer to the split integers
+    R2      .req x1     // Store pointer to the merged integers
+    S       .req x2     // Store pointer to the input bytes
+    count   .req w3     // Store the number of remaining vectors
+    radix   .req w4     // Store the radix m
+    recip   .req w5     // Store the reciprocal v
+    bytes   .req w6     // Store the number of input bytes per pair
+
+    /* Initialize constant values */
+
+    dup     v29.4s, radix
+    dup     v28.4s, recip
+    lsr     count, count, #3
+
+    cmp     bytes, #1
+    b.eq    .Ldecode_split1
+    b.hi    .Ldecode_split2
+
+    /* The merged integers are complete, r = R2[i] */
+
+.Ldecode_split0:
+    ldr     q0, [R2], #16
+    uxtl    v2.4s, v0.4h
+    uxtl2   v3.4s, v0.8h
+    split
+
+    subs    count, count, #1
+    b.ne    .Ldecode_split0
+
+    b       .Ldecode_done
+
+    /* One byte per pair, r = S[i] + R2[i] · 2^8 */
+
+.Ldecode_split1:
+    ldr     q0, [R2], #16
+    ldr     d1, [S], #8
+    uxtl    v1.8h, v1.8b
+    ushll   v2.4s, v0.4h, #8
+    ushll2  v3.4s, v0.8h, #8
+    uxtl    v4.4s, v1.4h
+    uxtl2   v5.4s, v1.8h
+    add     v2.4s, v2.4s, v4.4s
+    add     v3.4s, v3.4s, v5.4s
+    split
+
+    subs    count, count, #1
+    b.ne    .Ldecode_split1
+
+    b       .Ldecode_done
+
+    /* Two bytes per pair, r = (S[2i] + S[2i + 1] · 2^8) + R2[i] · 2^16, i.e.
+     * the halfwords of the input bytes and R2 are interleaved */
+
+.Ldecode_split2:
+    ldr     q0, [R2], #16
+    ldr     q1, [S], #16
+    zip1    v2.8h, v1.8h, v0.8h
+    zip2    v3.8h, v1.8h, v0.8h
+    split
+
+    subs    count, count, #1
+    b.ne    .Ldecode_split2
+
+.Ldecode_done:
+
+    .unreq  R
+    .unreq  R2
+    .unreq  S
+    .unreq  count
+    .unreq  radix
+    .unreq  recip
+    .unreq  bytes
+
+    ret     lr
@@ -0,0 +1,150 @@
+/* Switch to the text segment - this contains the program code */
+
+.text
+
+/* Provide function declarations */
+
+.global __asm_divmod_batch
+.global __asm_freeze_batch
+.type __asm_divmod_batch, %function
+.type __asm_freeze_batch, %function
+
+/* Provide macro definitions */
+
+/* Compute x = x mod m and q = x / m for the 4 lanes of x, with the same steps
+ * as uint32_divmod_uint14(). The vectors v28 and v29 hold v = 2^31 / m and m,
+ * the vectors v20 - v23 are used as temporary registers. */
+
+.macro divmod x, q
+    umull   v20.2d, \x\().2s, v28.2s
+    umull2  v21.2d, \x\().4s, v28.4s
+    shrn    \q\().2s, v20.2d, #31
+    shrn2   \q\().4s, v21.2d, #31
+    mls     \x\().4s, \q\().4s, v29.4s
+
+    umull   v20.2d, \x\().2s, v28.2s
+    umull2  v21.2d, \x\().4s, v28.4s
+    shrn    v22.2s, v20.2d, #31
+    shrn2   v22.4s, v21.2d, #31
+    mls     \x\().4s, v22.4s, v29.4s
+    add     \q\().4s, \q\().4s, v22.4s
+
+    /* Now x <= m, so x - m is either negative or zero. The mask v22 is -1 if
+     * x >= m, in which case q is incremented, otherwise m is added back. */
+
+    sub     \x\().4s, \x\().4s, v29.4s
+    cmge    v22.4s, \x\().4s, #0
+    bic     v23.16b, v29.16b, v22.16b
+    add     \x\().4s, \x\().4s, v23.4s
+    sub     \q\().4s, \q\().4s, v22.4s
+.endm
+
+__asm_divmod_batch:
+
+    /* Due to our choice of registers we do not need (to store) callee-saved
+     * registers. Neither do we use the procedure link register, as we do not
+     * branch to any functions from within this subroutine. The function
+     * prologue is therefore empty. */
+
+    /* Alias registers for a specific purpose (and readability) */
+
+    quot    .req x0     // Store pointer to the quotients
+    rem     .req x1     // Store pointer to the remainders
+    in      .req x2     // Store pointer to the dividends
+    count   .req w3     // Store the number of remaining vectors
+    modulus .req w4     // Store the modulus m
+    recip   .req w5     // Store the reciprocal v
+
+    /* Initialize constant values */
+
+    dup     v29.4s, modulus
+    dup     v28.4s, recip
+    lsr     count, count, #3
+
+    cbz     quot, .Ldivmod_batch_mod
+
+.Ldivmod_batch:
+    ldp     q0, q1, [in], #32
+    divmod  v0, v2
+    divmod  v1, v3
+    xtn     v16.4h, v0.4s
+    xtn2    v16.8h, v1.4s
+    str     q16, [rem], #16
+    stp     q2, q3, [quot], #32
+
+    subs    count, count, #1
+    b.ne    .Ldivmod_batch
+
+    b       .Ldivmod_batch_done
+
+    /* The same loop without storing the quotients */
+
+.Ldivmod_batch_mod:
+    ldp     q0, q1, [in], #32
+    divmod  v0, v2
+    divmod  v1, v3
+    xtn     v16.4h, v0.4s
+    xtn2    v16.8h, v1.4s
+    str     q16, [rem], #16
+
+    subs    count, count, #1
+    b.ne    .Ldivmod_batch_mod
+
+.Ldivmod_batch_done:
+
+    .unreq  quot
+    .unreq  rem
+    .unreq  in
+    .unreq  count
+    .unreq  modulus
+    .unreq  recip
+
+    ret     lr
+
+__asm_freeze_batch:
+
+    /* Alias registers for a specific purpose (and readability) */
+
+    rem     .req x0     // Store pointer to the centered representatives
+    in      .req x1     // Store pointer to the integers
+    count   .req w2     // Store the number of remaining vectors
+    modulus .req w3     // Store the modulus m
+    recip   .req w4     // Store the reciprocal v
+    offset  .req w5     // Store the freeze offset
+    half    .req w6     // Store (m - 1) / 2
+
+    /* Initialize constant values */
+
+    dup     v29.4s, modulus
+    dup     v28.4s, recip
+    dup     v27.4s, offset
+    sub     half, modulus, #1
+    lsr     half, half, #1
+    dup     v26.8h, half
+    lsr     count, count, #3
+
+.Lfreeze_batch:
+    ldr     q0, [in], #16
+    sxtl    v1.4s, v0.4h
+    sxtl2   v2.4s, v0.8h
+    add     v1.4s, v1.4s, v27.4s
+    add     v2.4s, v2.4s, v27.4s
+    divmod  v1, v3
+    divmod  v2, v3
+    xtn     v4.4h, v1.4s
+    xtn2    v4.8h, v2.4s
+    sub     v4.8h, v4.8h, v26.8h
+    str     q4, [rem], #16
+
+    subs    count, count, #1
+    b.ne    .Lfreeze_batch
+
+    .unreq  rem
+    .unreq  in
+    .unreq  count
+    .unreq  modulus
+    .unreq  recip
+    .unreq  offset
+    .unreq  half
+
+    ret     lr
@@ -0,0 +1,229 @@
+/* Switch to the text segment - this contains the program code */
+
+.text
+
+/* Provide function declarations */
+
+.global __asm_divstep3
+.global __asm_divstepq
+.type __asm_divstep3, %function
+.type __asm_divstepq, %function
+
+/* Provide macro definitions */
+
+/* Swap the vectors a and b if the lanes of the swap mask in v28 are set. The
+ * vector v2 is used as a temporary register. */
+
+.macro swap a, b
+    mov     v2.16b, \b\().16b
+    bit     \b\().16b, \a\().16b, v28.16b
+    bit     \a\().16b, v2.16b, v28.16b
+.endm
+
+/* Compute x = x + sign · y mod 3, where x, y and sign are in { -1, 0, 1 }. The
+ * sum is in -2, ..., 2, so the lanes x > 1 and x < -1 are corrected by -3 and
+ * +3 using the comparison masks (-1 or 0) multiplied by 3. The vectors v27,
+ * v29, v30 and v31 hold -1, sign, 1 and 3. */
+
+.macro update3 x, y
+    mla     \x\().16b, \y\().16b, v29.16b
+    cmgt    v2.16b, \x\().16b, v30.16b
+    cmgt    v3.16b, v27.16b, \x\().16b
+    sub     v2.16b, v2.16b, v3.16b
+    mla     \x\().16b, v2.16b, v31.16b
+.endm
+
+/* Compute out = c0 · x - c1 · y mod q using Barrett multiplication, where c0
+ * and c1 are { f0, g0 } stored in v7 together with their Barrett constants and
+ * q, i.e. v7 = { f0, f0', g0, g0', q, swap }. The lower 16 bits of the exact
+ * products are combined with the rounded quotients of sqrdmulh, such that the
+ * result is correct as long as it fits in 16 bits. */
+
+.macro updateq out, x, y
+    mul     \out\().8h, \x\().8h, v7.8h[0]
+    sqrdmulh v3.8h, \x\().8h, v7.8h[1]
+    mls     \out\().8h, \y\().8h, v7.8h[2]
+    mls     \out\().8h, v3.8h, v7.8h[4]
+    sqrdmulh v3.8h, \y\().8h, v7.8h[3]
+    mla     \out\().8h, v3.8h, v7.8h[4]
+.endm
+
+__asm_divstep3:
+
+    /* Due to our choice of registers we do not need (to store) callee-saved
+     * registers. Neither do we use the procedure link register, as we do not
+     * branch to any functions from within this subroutine. The function
+     * prologue is therefore empty. */
+
+    /* Alias registers for a specific purpose (and readability) */
+
+    row_f   .req x0     // Store pointer to the current vector of f
+    len     .req w1     // Store the row length
+    active  .req w2     // Store the number of coefficients of v and r
+    row_g   .req x3     // Store pointer to the current vector of g
+    row_v   .req x4     // Store pointer to the current vector of v
+    row_r   .req x5     // Store pointer to the current vector of r
+    out     .req x6     // Store pointer to the previous vector of g
+    count   .req w7     // Store the number of remaining vectors
+
+    /* Initialize constant values, the swap mask and sign are passed in w3 and
+     * w4 before their registers are reused as pointers */
+
+    dup     v28.16b, w3
+    dup     v29.16b, w4
+    movi    v27.16b, #0xff
+    movi    v30.16b, #1
+    movi    v31.16b, #3
+
+    add     row_g, row_f, len, uxtw
+    add     row_v, row_g, len, uxtw
+    add     row_r, row_v, len, uxtw
+
+    /* The rows f and g are updated one vector at a time. Since g is divided by
+     * x, every updated vector of g supplies the last lane of the previous one,
+     * which is only stored once the next vector has been updated. The first
+     * vector is peeled off to fill the pipeline of v24. */
+
+    ldr     q0, [row_f]
+    ldr     q1, [row_g], #16
+    swap    v0, v1
+    update3 v1, v0
+    str     q0, [row_f], #16
+    mov     v24.16b, v1.16b
+    sub     out, row_g, #16
+
+    lsr     count, len, #4
+    sub     count, count, #1
+
+.Ldivstep3_fg:
+    ldr     q0, [row_f]
+    ldr     q1, [row_g], #16
+    swap    v0, v1
+    update3 v1, v0
+    str     q0, [row_f], #16
+    ext     v25.16b, v24.16b, v1.16b, #1
+    mov     v24.16b, v1.16b
+    str     q25, [out], #16
+
+    subs    count, count, #1
+    b.ne    .Ldivstep3_fg
+
+    /* The last coefficient of g is zero after the division by x */
+
+    movi    v26.16b, #0
+    ext     v25.16b, v24.16b, v26.16b, #1
+    str     q25, [out]
+
+    /* The rows v and r are updated one vector at a time. Since v is multiplied
+     * by x, every vector of v receives the last lane of the previous one, which
+     * is carried over in v24. */
+
+    movi    v24.16b, #0
+    lsr     count, active, #4
+
+.Ldivstep3_vr:
+    ldr     q0, [row_v]
+    ldr     q1, [row_r]
+    ext     v25.16b, v24.16b, v0.16b, #15
+    mov     v24.16b, v0.16b
+    swap    v25, v1
+    update3 v1, v25
+    str     q25, [row_v], #16
+    str     q1, [row_r], #16
+
+    subs    count, count, #1
+    b.ne    .Ldivstep3_vr
+
+    .unreq  row_f
+    .unreq  len
+    .unreq  active
+    .unreq  row_g
+    .unreq  row_v
+    .unreq  row_r
+    .unreq  out
+    .unreq  count
+
+    ret     lr
+
+__asm_divstepq:
+
+    /* Alias registers for a specific purpose (and readability) */
+
+    row_f   .req x0     // Store pointer to the current vector of f
+    len     .req w1     // Store the row length
+    active  .req w2     // Store the number of coefficients of v and r
+    consts  .req x3     // Store pointer to the constants of the division step
+    row_g   .req x4     // Store pointer to the current vector of g
+    row_v   .req x5     // Store pointer to the current vector of v
+    row_r   .req x6     // Store pointer to the current vector of r
+    out     .req x7     // Store pointer to the previous vector of g
+    count   .req w8     // Store the number of remaining vectors
+
+    /* Initialize constant values */
+
+    ldr     q7, [consts]
+    dup     v28.8h, v7.8h[5]
+
+    /* The rows hold 16 bit integer coefficients, i.e. 2n bytes each */
+
+    add     row_g, row_f, len, uxtw #1
+    add     row_v, row_g, len, uxtw #1
+    add     row_r, row_v, len, uxtw #1
+
+    /* The same order of operations as in __asm_divstep3(), on vectors of 8
+     * integer coefficients */
+
+    ldr     q0, [row_f]
+    ldr     q1, [row_g], #16
+    swap    v0, v1
+    updateq v24, v1, v0
+    str     q0, [row_f], #16
+    sub     out, row_g, #16
+
+    lsr     count, len, #3
+    sub     count, count, #1
+
+.Ldivstepq_fg:
+    ldr     q0, [row_f]
+    ldr     q1, [row_g], #16
+    swap    v0, v1
+    updateq v4, v1, v0
+    str     q0, [row_f], #16
+    ext     v25.16b, v24.16b, v4.16b, #2
+    mov     v24.16b, v4.16b
+    str     q25, [out], #16
+
+    subs    count, count, #1
+    b.ne    .Ldivstepq_fg
+
+    movi    v26.16b, #0
+    ext     v25.16b, v24.16b, v26.16b, #2
+    str     q25, [out]
+
+    movi    v24.16b, #0
+    lsr     count, active, #3
+
+.Ldivstepq_vr:
+    ldr     q0, [row_v]
+    ldr     q1, [row_r]
+    ext     v25.16b, v24.16b, v0.16b, #14
+    mov     v24.16b, v0.16b
+    swap    v25, v1
+    updateq v4, v1, v25
+    str     q25, [row_v], #16
+    str     q4, [row_r], #16
+
+    subs    count, count, #1
+    b.ne    .Ldivstepq_vr
+
+    .unreq  row_f
+    .unreq  len
+    .unreq  active
+    .unreq  consts
+    .unreq  row_g
+    .unreq  row_v
+    .unreq  row_r
+    .unreq  out
+    .unreq  count
+
+    ret     lr
@@ -0,0 +1,107 @@
+/* Switch to the text segment - this contains the program code */
+
+.text
+
+/* Provide function declarations */
+
+.global __asm_encode_merge
+.type __asm_encode_merge, %function
+
+/* Provide macro definitions */
+
+/* Load 8 pairs of integers and merge them into v2 (pairs 0 - 3) and v3 (pairs
+ * 4 - 7), i.e. r = R[2i] + R[2i + 1] · m with the radix m stored in v7. The
+ * ld2 instruction splits the pairs into their even (v0) and odd (v1) halves. */
+
+.macro merge
+    ld2     {v0.8h, v1.8h}, [in], #32
+    uxtl    v2.4s, v0.4h
+    uxtl2   v3.4s, v0.8h
+    umlal   v2.4s, v1.4h, v7.4h
+    umlal2  v3.4s, v1.8h, v7.8h
+.endm
+
+/* Store the merged integers shifted right by \shift bits to R2 */
+
+.macro carry shift
+    shrn    v4.4h, v2.4s, #\shift
+    shrn2   v4.8h, v3.4s, #\shift
+    str     q4, [R2], #16
+.endm
+
+__asm_encode_merge:
+
+    /* Due to our choice of registers we do not need (to store) callee-saved
+     * registers. Neither do we use the procedure link register, as we do not
+     * branch to any functions from within this subroutine. The function
+     * prologue is therefore empty. */
+
+    /* Alias registers for a specific purpose (and readability) */
+
+    out     .req x0     // Store pointer to the output bytes
+    R2      .req x1     // Store pointer to the merged integers
+    in      .req x2     // Store pointer to the pairs of integers
+    count   .req w3     // Store the number of remaining vectors
+    radix   .req w4     // Store the radix m
+    bytes   .req w5     // Store the number of output bytes per pair
+
+    /* Initialize constant values */
+
+    dup     v7.8h, radix
+    lsr     count, count, #3
+
+    cmp     bytes, #1
+    b.eq    .Lencode_merge1
+    b.hi    .Lencode_merge2
+
+    /* The merged integers are below 16384, nothing is written to out */
+
+.Lencode_merge0:
+    merge
+    xtn     v4.4h, v2.4s
+    xtn2    v4.8h, v3.4s
+    str     q4, [R2], #16
+
+    subs    count, count, #1
+    b.ne    .Lencode_merge0
+
+    b       .Lencode_done
+
+    /* The lowest byte of every merged integer is written to out */
+
+.Lencode_merge1:
+    merge
+    xtn     v4.4h, v2.4s
+    xtn2    v4.8h, v3.4s
+    xtn     v5.8b, v4.8h
+    str     d5, [out], #8
+    carry   8
+
+    subs    count, count, #1
+    b.ne    .Lencode_merge1
+
+    b       .Lencode_done
+
+    /* The lowest 2 bytes of every merged integer are written to out, which
+     * matches the byte order of the reference on little endian */
+
+.Lencode_merge2:
+    merge
+    xtn     v4.4h, v2.4s
+    xtn2    v4.8h, v3.4s
+    str     q4, [out], #16
+    carry   16
+
+    subs    count, count, #1
+    b.ne    .Lencode_merge2
+
+.Lencode_done:
+
+    .unreq  out
+    .unreq  R2
+    .unreq  in
+    .unreq  count
+    .unreq  radix
+    .unreq  bytes
+
+    ret     lr
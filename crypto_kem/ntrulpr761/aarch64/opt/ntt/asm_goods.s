@@ -0,0 +1,649 @@
+/* Switch to the text segment - this contains the program code */
+
+.text
+
+/* Provide function declarations */
+
+.global __asm_goods_forward16
+.type __asm_goods_forward16, %function
+
+.global __asm_goods_forward8
+.type __asm_goods_forward8, %function
+
+.global __asm_goods_forward16_l1
+.type __asm_goods_forward16_l1, %function
+
+.global __asm_goods_forward8_l1
+.type __asm_goods_forward8_l1, %function
+
+.global __asm_goods_rounded_l1
+.type __asm_goods_rounded_l1, %function
+
+.global __asm_goods_narrow16
+.type __asm_goods_narrow16, %function
+
+.global __asm_goods_narrow8
+.type __asm_goods_narrow8, %function
+
+/* Provide macro definitions */
+
+/* Compute out = in & P_s, where P_s selects the 16 bit lanes l for which
+ * (l + s) % 3 == 0. The masks P_0, P_1 and P_2 are stored in v29, v30, v31. */
+
+.macro mask_and out, in, s
+    .if ((\s) % 3) == 0
+    and     \out\().16b, \in\().16b, v29.16b
+    .endif
+    .if ((\s) % 3) == 1
+    and     \out\().16b, \in\().16b, v30.16b
+    .endif
+    .if ((\s) % 3) == 2
+    and     \out\().16b, \in\().16b, v31.16b
+    .endif
+.endm
+
+/* Insert the lanes of in selected by P_s into out, leaving the others intact */
+
+.macro mask_bit out, in, s
+    .if ((\s) % 3) == 0
+    bit     \out\().16b, \in\().16b, v29.16b
+    .endif
+    .if ((\s) % 3) == 1
+    bit     \out\().16b, \in\().16b, v30.16b
+    .endif
+    .if ((\s) % 3) == 2
+    bit     \out\().16b, \in\().16b, v31.16b
+    .endif
+.endm
+
+/* Compute the 16 bit lane masks P_0 = { 0, 3, 6 }, P_1 = { 2, 5 } and P_2 = {
+ * 1, 4, 7 }. Only three distinct 64 bit halves are needed to build them. */
+
+.macro init_masks
+    mov     mask_a, #0xffff         // Lanes { 0, 3 } of a 64 bit half
+    movk    mask_a, #0xffff, lsl #48
+    mov     mask_b, #0xffff00000000 // Lane { 2 } of a 64 bit half
+    mov     mask_c, #0xffff0000     // Lane { 1 } of a 64 bit half
+
+    mov     v29.d[0], mask_a
+    mov     v29.d[1], mask_b
+    mov     v30.d[0], mask_b
+    mov     v30.d[1], mask_c
+    mov     v31.d[0], mask_c
+    mov     v31.d[1], mask_a
+.endm
+
+/* Scatter 8 consecutive columns 8g, ..., 8g + 7 into the 3 rows of the GP0xGP1
+ * matrix. Column c of row r receives f[c] when c % 3 == r and f[c + 512] when
+ * (c + 512) % 3 == r, i.e. lo = v0 holds f[8g + l] and hi = v1 holds f[8g + l
+ * + 512]. All other entries are the zero padding. Since 8g + l = 2g + l mod 3,
+ * row r selects the lanes P_{2g - r} of lo and P_{2g - r - 1} of hi. The upper
+ * half is all zeros for the groups 32 and up, so it is not inserted there. The
+ * columns of the 3 rows are left in v2, v3 and v4. */
+
+.macro scatter_columns g
+    mask_and v2, v0, 2*(\g)+3
+    mask_and v3, v0, 2*(\g)+2
+    mask_and v4, v0, 2*(\g)+1
+    .if (\g) < 32
+    mask_bit v2, v1, 2*(\g)+2
+    mask_bit v3, v1, 2*(\g)+1
+    mask_bit v4, v1, 2*(\g)+0
+    .endif
+.endm
+
+/* Scatter the 8 columns 8g, ..., 8g + 7 as well as the 8 columns 8g + 256, ...,
+ * 8g + 263 and compute the first forward NTT layer on them. Its root is 1, so
+ * column c of a row becomes a + b and column c + 256 becomes a - b, where a is
+ * scattered by scatter_columns and b is f[c + 256] if (c + 256) % 3 == r. The
+ * indices c, c + 256 and c + 512 are distinct mod 3, so either a or b is zero
+ * and the layer does not need a reduction. mid = v5 holds f[8g + l + 256] and
+ * c + 256 = c + 1 mod 3, i.e. row r selects the lanes P_{2g + 1 - r} of mid.
+ * The columns c of the 3 rows are left in v2, v3 and v4, the columns c + 256
+ * in v6, v7 and v22. */
+
+.macro scatter_layer1 g
+    scatter_columns \g
+    mask_and v23, v5, 2*(\g)+1
+    mask_and v24, v5, 2*(\g)+0
+    mask_and v25, v5, 2*(\g)+2
+
+    sub     v6.8h, v2.8h, v23.8h
+    add     v2.8h, v2.8h, v23.8h
+    sub     v7.8h, v3.8h, v24.8h
+    add     v3.8h, v3.8h, v24.8h
+    sub     v22.8h, v4.8h, v25.8h
+    add     v4.8h, v4.8h, v25.8h
+.endm
+
+/* Store the scattered columns of the 3 rows as 32 bit or 16 bit integers */
+
+.macro store_columns32
+    sxtl    v16.4s, v2.4h
+    sxtl2   v17.4s, v2.8h
+    sxtl    v18.4s, v3.4h
+    sxtl2   v19.4s, v3.8h
+    sxtl    v20.4s, v4.4h
+    sxtl2   v21.4s, v4.8h
+
+    st1     {v16.4s, v17.4s}, [row_0], #32
+    st1     {v18.4s, v19.4s}, [row_1], #32
+    st1     {v20.4s, v21.4s}, [row_2], #32
+.endm
+
+.macro store_upper32
+    sxtl    v16.4s, v6.4h
+    sxtl2   v17.4s, v6.8h
+    sxtl    v18.4s, v7.4h
+    sxtl2   v19.4s, v7.8h
+    sxtl    v20.4s, v22.4h
+    sxtl2   v21.4s, v22.8h
+
+    st1     {v16.4s, v17.4s}, [up_0], #32
+    st1     {v18.4s, v19.4s}, [up_1], #32
+    st1     {v20.4s, v21.4s}, [up_2], #32
+.endm
+
+.macro store_columns16
+    st1     {v2.8h}, [row_0], #16
+    st1     {v3.8h}, [row_1], #16
+    st1     {v4.8h}, [row_2], #16
+.endm
+
+/* Load the coefficients f[8g + l] and f[8g + l + 512] of a group of columns.
+ * Only f[0], ..., f[760] exist, so group 31 takes f[760] on its own and the
+ * groups 32 and up do not have an upper half at all. */
+
+.macro load_columns16 g
+    ld1     {v0.8h}, [in_lo], #16
+    .if (\g) < 31
+    ld1     {v1.8h}, [in_hi], #16
+    .endif
+    .if (\g) == 31
+    movi    v1.2d, #0
+    ld1     {v1.h}[0], [in_hi]
+    .endif
+.endm
+
+.macro load_columns8 g
+    ld1     {v0.8b}, [in_lo], #8
+    sxtl    v0.8h, v0.8b
+    .if (\g) < 31
+    ld1     {v1.8b}, [in_hi], #8
+    sxtl    v1.8h, v1.8b
+    .endif
+    .if (\g) == 31
+    movi    v1.2d, #0
+    ld1     {v1.b}[0], [in_hi]
+    sxtl    v1.8h, v1.8b
+    .endif
+.endm
+
+/* Compute x = x mod m and q = x / m for the 4 lanes of x, with the same steps
+ * as the divmod macro of asm_decode.s. The vectors v26 and v27 hold v = 2^31 /
+ * m and m, the vectors v18 - v21 are used as temporary registers. */
+
+.macro divmod x, q
+    umull   v18.2d, \x\().2s, v26.2s
+    umull2  v19.2d, \x\().4s, v26.4s
+    shrn    \q\().2s, v18.2d, #31
+    shrn2   \q\().4s, v19.2d, #31
+    mls     \x\().4s, \q\().4s, v27.4s
+
+    umull   v18.2d, \x\().2s, v26.2s
+    umull2  v19.2d, \x\().4s, v26.4s
+    shrn    v20.2s, v18.2d, #31
+    shrn2   v20.4s, v19.2d, #31
+    mls     \x\().4s, v20.4s, v27.4s
+    add     \q\().4s, \q\().4s, v20.4s
+
+    sub     \x\().4s, \x\().4s, v27.4s
+    cmge    v20.4s, \x\().4s, #0
+    bic     v21.16b, v27.16b, v20.16b
+    add     \x\().4s, \x\().4s, v21.4s
+    sub     \q\().4s, \q\().4s, v20.4s
+.endm
+
+/* Compute out = 3 · out - (q - 1) / 2 on the 8 lanes of out, i.e. the integer
+ * coefficients of a Rounded polynomial. The vector v28 holds (q - 1) / 2. */
+
+.macro scale_rounded out
+    shl     v18.8h, \out\().8h, #1
+    add     \out\().8h, \out\().8h, v18.8h
+    sub     \out\().8h, \out\().8h, v28.8h
+.endm
+
+/* Split 4 merged integers of the first level of Decode() into the 8 integer
+ * coefficients f[2i] and f[2i + 1] of a Rounded polynomial. Every merged
+ * integer is completed with the next input byte, r = S[i] + R2[i] · 2^8, and
+ * split into r mod m and (r / m) mod m as in decode.c. The second quotient is
+ * not needed, it is left in v2 which is overwritten by scatter_layer1. */
+
+.macro split_rounded out, r2, s
+    ldr     d16, [\r2], #8
+    ldr     s17, [\s], #4
+    ushll   v16.4s, v16.4h, #8
+    uxtl    v17.8h, v17.8b
+    uxtl    v17.4s, v17.4h
+    add     v16.4s, v16.4s, v17.4s
+
+    divmod  v16, v17
+    divmod  v17, v2
+
+    xtn     v16.4h, v16.4s
+    xtn     v17.4h, v17.4s
+    zip1    \out\().8h, v16.8h, v17.8h
+    scale_rounded \out
+.endm
+
+/* Decode the integer coefficients f[8g + l] and f[8g + l + 512] of a group of
+ * columns. Since p = 761 is odd, f[760] is not split but carried over from the
+ * merged integers as R2[380], so group 31 takes it on its own. */
+
+.macro load_rounded g
+    split_rounded v0, r2_lo, s_lo
+    .if (\g) < 31
+    split_rounded v1, r2_hi, s_hi
+    .endif
+    .if (\g) == 31
+    ldr     h16, [r2_hi]
+    scale_rounded v16
+    movi    v1.2d, #0
+    mov     v1.h[0], v16.h[0]
+    .endif
+.endm
+
+__asm_goods_forward16:
+
+    /* Due to our choice of registers we do not need (to store) callee-saved
+     * registers. Neither do we use the procedure link register, as we do not
+     * branch to any functions from within this subroutine. The function
+     * prologue is therefore empty. */
+
+    /* Alias registers for a specific purpose (and readability) */
+
+    row_0   .req x0     // Store pointer to the first row of the matrix
+    in_lo   .req x1     // Store pointer to the integer coefficient f[c]
+    in_hi   .req x2     // Store pointer to the integer coefficient f[c + 512]
+    row_1   .req x3     // Store pointer to the second row of the matrix
+    row_2   .req x4     // Store pointer to the third row of the matrix
+    mask_a  .req x5     // Store the 64 bit halves of the lane masks
+    mask_b  .req x6
+    mask_c  .req x7
+
+    add     in_hi, in_lo, #2 * 512
+    add     row_1, row_0, #4 * 512
+    add     row_2, row_0, #4 * 1024
+
+    init_masks
+
+    /* We need to repeat this sequence 64 times. We can take 8 columns in one
+     * go and 512 / 8 = 64. */
+
+    .set    group, 0
+    .rept 64
+
+    load_columns16 group
+    scatter_columns group
+    store_columns32
+
+    .set    group, group + 1
+    .endr
+
+    .unreq  row_0
+    .unreq  in_lo
+    .unreq  in_hi
+    .unreq  row_1
+    .unreq  row_2
+    .unreq  mask_a
+    .unreq  mask_b
+    .unreq  mask_c
+
+    ret     lr
+
+__asm_goods_forward8:
+
+    /* Due to our choice of registers we do not need (to store) callee-saved
+     * registers. Neither do we use the procedure link register, as we do not
+     * branch to any functions from within this subroutine. The function
+     * prologue is therefore empty. */
+
+    /* Alias registers for a specific purpose (and readability) */
+
+    row_0   .req x0     // Store pointer to the first row of the matrix
+    in_lo   .req x1     // Store pointer to the integer coefficient g[c]
+    in_hi   .req x2     // Store pointer to the integer coefficient g[c + 512]
+    row_1   .req x3     // Store pointer to the second row of the matrix
+    row_2   .req x4     // Store pointer to the third row of the matrix
+    mask_a  .req x5     // Store the 64 bit halves of the lane masks
+    mask_b  .req x6
+    mask_c  .req x7
+
+    add     in_hi, in_lo, #512
+    add     row_1, row_0, #4 * 512
+    add     row_2, row_0, #4 * 1024
+
+    init_masks
+
+    /* We need to repeat this sequence 64 times. We can take 8 columns in one
+     * go and 512 / 8 = 64. */
+
+    .set    group, 0
+    .rept 64
+
+    load_columns8 group
+    scatter_columns group
+    store_columns32
+
+    .set    group, group + 1
+    .endr
+
+    .unreq  row_0
+    .unreq  in_lo
+    .unreq  in_hi
+    .unreq  row_1
+    .unreq  row_2
+    .unreq  mask_a
+    .unreq  mask_b
+    .unreq  mask_c
+
+    ret     lr
+
+__asm_goods_forward16_l1:
+
+    /* Due to our choice of registers we do not need (to store) callee-saved
+     * registers. Neither do we use the procedure link register, as we do not
+     * branch to any functions from within this subroutine. The function
+     * prologue is therefore empty. */
+
+    /* Alias registers for a specific purpose (and readability) */
+
+    row_0   .req x0     // Store pointer to the first row of the matrix
+    in_lo   .req x1     // Store pointer to the integer coefficient f[c]
+    in_hi   .req x2     // Store pointer to the integer coefficient f[c + 512]
+    row_1   .req x3     // Store pointer to the second row of the matrix
+    row_2   .req x4     // Store pointer to the third row of the matrix
+    mask_a  .req x5     // Store the 64 bit halves of the lane masks
+    mask_b  .req x6
+    mask_c  .req x7
+    in_mid  .req x8     // Store pointer to the integer coefficient f[c + 256]
+    up_0    .req x9     // Store pointer to column 256 of the first row
+    up_1    .req x10    // Store pointer to column 256 of the second row
+    up_2    .req x11    // Store pointer to column 256 of the third row
+
+    add     in_mid, in_lo, #2 * 256
+    add     in_hi, in_lo, #2 * 512
+    add     row_1, row_0, #4 * 512
+    add     row_2, row_0, #4 * 1024
+    add     up_0, row_0, #4 * 256
+    add     up_1, row_1, #4 * 256
+    add     up_2, row_2, #4 * 256
+
+    init_masks
+
+    /* We need to repeat this sequence 32 times. We can take 8 columns and
+     * their 8 partners in the first layer in one go and 256 / 8 = 32. */
+
+    .set    group, 0
+    .rept 32
+
+    load_columns16 group
+    ld1     {v5.8h}, [in_mid], #16
+    scatter_layer1 group
+    store_columns32
+    store_upper32
+
+    .set    group, group + 1
+    .endr
+
+    .unreq  row_0
+    .unreq  in_lo
+    .unreq  in_hi
+    .unreq  row_1
+    .unreq  row_2
+    .unreq  mask_a
+    .unreq  mask_b
+    .unreq  mask_c
+    .unreq  in_mid
+    .unreq  up_0
+    .unreq  up_1
+    .unreq  up_2
+
+    ret     lr
+
+__asm_goods_forward8_l1:
+
+    /* Due to our choice of registers we do not need (to store) callee-saved
+     * registers. Neither do we use the procedure link register, as we do not
+     * branch to any functions from within this subroutine. The function
+     * prologue is therefore empty. */
+
+    /* Alias registers for a specific purpose (and readability) */
+
+    row_0   .req x0     // Store pointer to the first row of the matrix
+    in_lo   .req x1     // Store pointer to the integer coefficient g[c]
+    in_hi   .req x2     // Store pointer to the integer coefficient g[c + 512]
+    row_1   .req x3     // Store pointer to the second row of the matrix
+    row_2   .req x4     // Store pointer to the third row of the matrix
+    mask_a  .req x5     // Store the 64 bit halves of the lane masks
+    mask_b  .req x6
+    mask_c  .req x7
+    in_mid  .req x8     // Store pointer to the integer coefficient g[c + 256]
+    up_0    .req x9     // Store pointer to column 256 of the first row
+    up_1    .req x10    // Store pointer to column 256 of the second row
+    up_2    .req x11    // Store pointer to column 256 of the third row
+
+    add     in_mid, in_lo, #256
+    add     in_hi, in_lo, #512
+    add     row_1, row_0, #4 * 512
+    add     row_2, row_0, #4 * 1024
+    add     up_0, row_0, #4 * 256
+    add     up_1, row_1, #4 * 256
+    add     up_2, row_2, #4 * 256
+
+    init_masks
+
+    /* We need to repeat this sequence 32 times. We can take 8 columns and
+     * their 8 partners in the first layer in one go and 256 / 8 = 32. */
+
+    .set    group, 0
+    .rept 32
+
+    load_columns8 group
+    ld1     {v5.8b}, [in_mid], #8
+    sxtl    v5.8h, v5.8b
+    scatter_layer1 group
+    store_columns32
+    store_upper32
+
+    .set    group, group + 1
+    .endr
+
+    .unreq  row_0
+    .unreq  in_lo
+    .unreq  in_hi
+    .unreq  row_1
+    .unreq  row_2
+    .unreq  mask_a
+    .unreq  mask_b
+    .unreq  mask_c
+    .unreq  in_mid
+    .unreq  up_0
+    .unreq  up_1
+    .unreq  up_2
+
+    ret     lr
+
+__asm_goods_rounded_l1:
+
+    /* Due to our choice of registers we do not need (to store) callee-saved
+     * registers. Neither do we use the procedure link register, as we do not
+     * branch to any functions from within this subroutine. The function
+     * prologue is therefore empty. */
+
+    /* Alias registers for a specific purpose (and readability) */
+
+    row_0   .req x0     // Store pointer to the first row of the matrix
+    r2_lo   .req x1     // Store pointer to the merged integer of f[c]
+    s_lo    .req x2     // Store pointer to the input byte of f[c]
+    row_1   .req x3     // Store pointer to the second row of the matrix
+    row_2   .req x4     // Store pointer to the third row of the matrix
+    mask_a  .req x5     // Store the 64 bit halves of the lane masks
+    mask_b  .req x6
+    mask_c  .req x7
+    up_0    .req x9     // Store pointer to column 256 of the first row
+    up_1    .req x10    // Store pointer to column 256 of the second row
+    up_2    .req x11    // Store pointer to column 256 of the third row
+    r2_mid  .req x12    // Store pointer to the merged integer of f[c + 256]
+    r2_hi   .req x13    // Store pointer to the merged integer of f[c + 512]
+    s_mid   .req x14    // Store pointer to the input byte of f[c + 256]
+    s_hi    .req x15    // Store pointer to the input byte of f[c + 512]
+
+    /* Initialize constant values, the radix m, its reciprocal v and (q - 1) /
+     * 2 are passed in w3, w4 and w5 before their registers are reused */
+
+    dup     v27.4s, w3
+    dup     v26.4s, w4
+    dup     v28.8h, w5
+
+    add     r2_mid, r2_lo, #2 * 128
+    add     r2_hi, r2_lo, #2 * 256
+    add     s_mid, s_lo, #128
+    add     s_hi, s_lo, #256
+    add     row_1, row_0, #4 * 512
+    add     row_2, row_0, #4 * 1024
+    add     up_0, row_0, #4 * 256
+    add     up_1, row_1, #4 * 256
+    add     up_2, row_2, #4 * 256
+
+    init_masks
+
+    /* We need to repeat this sequence 32 times. Every group splits 4 merged
+     * integers of each third of the polynomial, which yields 8 columns and
+     * their 8 partners in the first layer, and 256 / 8 = 32. */
+
+    .set    group, 0
+    .rept 32
+
+    load_rounded group
+    split_rounded v5, r2_mid, s_mid
+    scatter_layer1 group
+    store_columns32
+    store_upper32
+
+    .set    group, group + 1
+    .endr
+
+    .unreq  row_0
+    .unreq  r2_lo
+    .unreq  s_lo
+    .unreq  row_1
+    .unreq  row_2
+    .unreq  mask_a
+    .unreq  mask_b
+    .unreq  mask_c
+    .unreq  up_0
+    .unreq  up_1
+    .unreq  up_2
+    .unreq  r2_mid
+    .unreq  r2_hi
+    .unreq  s_mid
+    .unreq  s_hi
+
+    ret     lr
+
+__asm_goods_narrow16:
+
+    /* Due to our choice of registers we do not need (to store) callee-saved
+     * registers. Neither do we use the procedure link register, as we do not
+     * branch to any functions from within this subroutine. The function
+     * prologue is therefore empty. */
+
+    /* Alias registers for a specific purpose (and readability) */
+
+    row_0   .req x0     // Store pointer to the first row of the matrix
+    in_lo   .req x1     // Store pointer to the integer coefficient f[c]
+    in_hi   .req x2     // Store pointer to the integer coefficient f[c + 512]
+    row_1   .req x3     // Store pointer to the second row of the matrix
+    row_2   .req x4     // Store pointer to the third row of the matrix
+    mask_a  .req x5     // Store the 64 bit halves of the lane masks
+    mask_b  .req x6
+    mask_c  .req x7
+
+    add     in_hi, in_lo, #2 * 512
+    add     row_1, row_0, #2 * 512
+    add     row_2, row_0, #2 * 1024
+
+    init_masks
+
+    /* We need to repeat this sequence 64 times. We can take 8 columns in one
+     * go and 512 / 8 = 64. */
+
+    .set    group, 0
+    .rept 64
+
+    load_columns16 group
+    scatter_columns group
+    store_columns16
+
+    .set    group, group + 1
+    .endr
+
+    .unreq  row_0
+    .unreq  in_lo
+    .unreq  in_hi
+    .unreq  row_1
+    .unreq  row_2
+    .unreq  mask_a
+    .unreq  mask_b
+    .unreq  mask_c
+
+    ret     lr
+
+__asm_goods_narrow8:
+
+    /* Due to our choice of registers we do not need (to store) callee-saved
+     * registers. Neither do we use the procedure link register, as we do not
+     * branch to any functions from within this subroutine. The function
+     * prologue is therefore empty. */
+
+    /* Alias registers for a specific purpose (and readability) */
+
+    row_0   .req x0     // Store pointer to the first row of the matrix
+    in_lo   .req x1     // Store pointer to the integer coefficient g[c]
+    in_hi   .req x2     // Store pointer to the integer coefficient g[c + 512]
+    row_1   .req x3     // Store pointer to the second row of the matrix
+    row_2   .req x4     // Store pointer to the third row of the matrix
+    mask_a  .req x5     // Store the 64 bit halves of the lane masks
+    mask_b  .req x6
+    mask_c  .req x7
+
+    add     in_hi, in_lo, #512
+    add     row_1, row_0, #2 * 512
+    add     row_2, row_0, #2 * 1024
+
+    init_masks
+
+    /* We need to repeat this sequence 64 times. We can take 8 columns in one
+     * go and 512 / 8 = 64. */
+
+    .set    group, 0
+    .rept 64
+
+    load_columns8 group
+    scatter_columns group
+    store_columns16
+
+    .set    group, group + 1
+    .endr
+
+    .unreq  row_0
+    .unreq  in_lo
+    .unreq  in_hi
+    .unreq  row_1
+    .unreq  row_2
+    .unreq  mask_a
+    .unreq  mask_b
+    .unreq  mask_c
+
+    ret     lr
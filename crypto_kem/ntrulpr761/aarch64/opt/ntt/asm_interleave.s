@@ -0,0 +1,83 @@
+/* Switch to the text segment - this contains the program code */
+
+.text
+
+/* Provide function declarations */
+
+.global __asm_interleave_x4
+.global __asm_deinterleave_x4
+.type __asm_interleave_x4, %function
+.type __asm_deinterleave_x4, %function
+
+__asm_interleave_x4:
+
+    /* Due to our choice of registers we do not need (to store) callee-saved
+     * registers. Neither do we use the procedure link register, as we do not
+     * branch to any functions from within this subroutine. The function
+     * prologue is therefore empty. */
+
+    /* Alias registers for a specific purpose (and readability) */
+
+    out     .req x0     // Store pointer to the first interleaved coefficient
+    in_0    .req x1     // Store pointer to the first coefficient of polynomial 0
+    in_1    .req x2     // Store pointer to the first coefficient of polynomial 1
+    in_2    .req x3     // Store pointer to the first coefficient of polynomial 2
+    in_3    .req x4     // Store pointer to the first coefficient of polynomial 3
+
+    /* Lane k of vector i of the result holds the integer coefficient i of
+     * polynomial k, which is exactly the layout written by st4. We need to
+     * repeat this sequence 64 times. We take 8 values of every polynomial in
+     * one go and 512 / 8 = 64. */
+
+    .rept 64
+
+    ldp     q0, q4, [in_0], #32
+    ldp     q1, q5, [in_1], #32
+    ldp     q2, q6, [in_2], #32
+    ldp     q3, q7, [in_3], #32
+
+    st4     {v0.4s, v1.4s, v2.4s, v3.4s}, [out], #64
+    st4     {v4.4s, v5.4s, v6.4s, v7.4s}, [out], #64
+
+    .endr
+
+    .unreq  out
+    .unreq  in_0
+    .unreq  in_1
+    .unreq  in_2
+    .unreq  in_3
+
+    ret     lr
+
+__asm_deinterleave_x4:
+
+    /* Alias registers for a specific purpose (and readability) */
+
+    out_0   .req x0     // Store pointer to the first coefficient of polynomial 0
+    out_1   .req x1     // Store pointer to the first coefficient of polynomial 1
+    out_2   .req x2     // Store pointer to the first coefficient of polynomial 2
+    out_3   .req x3     // Store pointer to the first coefficient of polynomial 3
+    in      .req x4     // Store pointer to the first interleaved coefficient
+
+    /* We need to repeat this sequence 64 times. We take 8 values of every
+     * polynomial in one go and 512 / 8 = 64. */
+
+    .rept 64
+
+    ld4     {v0.4s, v1.4s, v2.4s, v3.4s}, [in], #64
+    ld4     {v4.4s, v5.4s, v6.4s, v7.4s}, [in], #64
+
+    stp     q0, q4, [out_0], #32
+    stp     q1, q5, [out_1], #32
+    stp     q2, q6, [out_2], #32
+    stp     q3, q7, [out_3], #32
+
+    .endr
+
+    .unreq  out_0
+    .unreq  out_1
+    .unreq  out_2
+    .unreq  out_3
+    .unreq  in
+
+    ret     lr
@@ -0,0 +1,105 @@
+/* Switch to the text segment - this contains the program code */
+
+.text
+
+/* Provide function declarations */
+
+.global __asm_ntt16_base_multiply
+.type __asm_ntt16_base_multiply, %function
+
+/* Provide macro definitions */
+
+/* Reduce the 32 bit accumulators { lo, hi } = X into a single vector of 16 bit
+ * integer coefficients using Montgomery reduction. We compute m = X · p^-1 mod
+ * 2^16 and subtract m · p, after which the lower 16 bits of every accumulator
+ * are zero. The upper 16 bits are then equal to X · 2^-16 mod p. */
+
+.macro montgomery_reduce out, lo, hi, tmp
+    uzp1    \tmp\().8h, \lo\().8h, \hi\().8h
+    mul     \tmp\().8h, \tmp\().8h, v0.8h[2]
+    smlsl   \lo\().4s, \tmp\().4h, v0.4h[0]
+    smlsl2  \hi\().4s, \tmp\().8h, v0.8h[0]
+    uzp2    \out\().8h, \lo\().8h, \hi\().8h
+.endm
+
+__asm_ntt16_base_multiply:
+
+    /* Due to our choice of registers we do not need (to store) callee-saved
+     * registers. Neither do we use the procedure link register, as we do not
+     * branch to any functions from within this subroutine. The function
+     * prologue is therefore empty. */
+
+    /* Alias registers for a specific purpose (and readability) */
+
+    out     .req x0     // Store pointer to the first product coefficient
+    in_f    .req x1     // Store pointer to the first coefficient of F
+    in_g    .req x2     // Store pointer to the first coefficient of G
+    roots   .req x3     // Store pointer to the precomputed root values
+
+    /* Initialize constant values. The table of roots starts with the constant
+     * values { p, V, p^-1 mod 2^16 }. */
+
+    ldr     q0, [roots]
+
+    /* We multiply two degree 2 polynomials and reduce the result mod (x^3 - 1),
+     * for 8 columns of the GP0xGP1 matrices at a time. The rows of each matrix
+     * are 512 integer coefficients, i.e. 1024 bytes, apart. Each product is
+     * accumulated exactly in 32 bits before it is reduced, since the factors
+     * are bounded by p/2 + 1 in absolute value:
+     *
+     * C[0] = F[0] · G[0] + F[1] · G[2] + F[2] · G[1]
+     * C[1] = F[0] · G[1] + F[1] · G[0] + F[2] · G[2]
+     * C[2] = F[0] · G[2] + F[1] · G[1] + F[2] · G[0]
+     *
+     * We need to repeat this sequence 64 times. We can take 8 columns in one
+     * go and 512 / 8 = 64. */
+
+    .rept 64
+
+    ldr     q1, [in_f, #1024 * 0]
+    ldr     q4, [in_g, #1024 * 0]
+    ldr     q5, [in_g, #1024 * 1]
+    ldr     q6, [in_g, #1024 * 2]
+
+    smull   v16.4s, v1.4h, v4.4h
+    ldr     q2, [in_f, #1024 * 1]
+    smull2  v17.4s, v1.8h, v4.8h
+    ldr     q3, [in_f, #1024 * 2]
+    smull   v18.4s, v1.4h, v5.4h
+    add     in_f, in_f, #16
+    smull2  v19.4s, v1.8h, v5.8h
+    add     in_g, in_g, #16
+    smull   v20.4s, v1.4h, v6.4h
+    smull2  v21.4s, v1.8h, v6.8h
+
+    smlal   v16.4s, v2.4h, v6.4h
+    smlal2  v17.4s, v2.8h, v6.8h
+    smlal   v18.4s, v2.4h, v4.4h
+    smlal2  v19.4s, v2.8h, v4.8h
+    smlal   v20.4s, v2.4h, v5.4h
+    smlal2  v21.4s, v2.8h, v5.8h
+
+    smlal   v16.4s, v3.4h, v5.4h
+    smlal2  v17.4s, v3.8h, v5.8h
+    smlal   v18.4s, v3.4h, v6.4h
+    smlal2  v19.4s, v3.8h, v6.8h
+    smlal   v20.4s, v3.4h, v4.4h
+    smlal2  v21.4s, v3.8h, v4.8h
+
+    montgomery_reduce v24, v16, v17, v7
+    montgomery_reduce v25, v18, v19, v22
+    str     q24, [out, #1024 * 0]
+    montgomery_reduce v26, v20, v21, v23
+    str     q25, [out, #1024 * 1]
+    str     q26, [out, #1024 * 2]
+
+    add     out, out, #16
+
+    .endr
+
+    .unreq  out
+    .unreq  in_f
+    .unreq  in_g
+    .unreq  roots
+
+    ret     lr
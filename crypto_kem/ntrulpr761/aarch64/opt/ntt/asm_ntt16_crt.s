@@ -0,0 +1,102 @@
+/* Switch to the text segment - this contains the program code */
+
+.text
+
+/* Provide function declarations */
+
+.global __asm_ntt16_crt
+.type __asm_ntt16_crt, %function
+
+/* Provide macro definitions */
+
+/* Compute out = in · c mod p using Barrett multiplication, where the constant
+ * value c, c' = round(c · 2^15 / p) and p are the lanes i, i' and j of v0. */
+
+.macro barrett_mul out, in, i, i_p, j, tmp
+    sqrdmulh \tmp\().8h, \in\().8h, v0.8h[\i_p]
+    mul     \out\().8h, \in\().8h, v0.8h[\i]
+    mls     \out\().8h, \tmp\().8h, v0.8h[\j]
+.endm
+
+__asm_ntt16_crt:
+
+    /* Due to our choice of registers we do not need (to store) callee-saved
+     * registers. Neither do we use the procedure link register, as we do not
+     * branch to any functions from within this subroutine. The function
+     * prologue is therefore empty. */
+
+    /* Alias registers for a specific purpose (and readability) */
+
+    out     .req x0     // Store pointer to the first resulting coefficient
+    in_0    .req x1     // Store pointer to the first coefficient mod p0
+    in_1    .req x2     // Store pointer to the first coefficient mod p1
+    value   .req w3     // Store the constant value that is being initialized
+
+    add     in_1, in_0, #2 * 1536
+
+    /* Initialize constant values */
+
+    mov     value, #128             // 2^16 / 512
+    mov     v0.8h[0], value
+    mov     v0.8h[2], value
+    mov     value, #546             // round(128 · 2^15 / p0)
+    mov     v0.8h[1], value
+    mov     value, #341             // round(128 · 2^15 / p1)
+    mov     v0.8h[3], value
+    mov     value, #4099            // p0^-1 mod p1
+    mov     v0.8h[4], value
+    mov     value, #10930           // round(4099 · 2^15 / p1)
+    mov     v0.8h[5], value
+    mov     value, #7681            // p0
+    mov     v0.8h[6], value
+    mov     value, #12289           // p1
+    mov     v0.8h[7], value
+
+    mov     value, #0x9201          // 6984193 (= M)
+    movk    value, #0x6a, lsl #16
+    dup     v31.4s, value
+
+    /* The inverse NTTs leave a factor 512 · 2^-16 in every coefficient, which
+     * is removed by multiplying with 128. The residues u0 mod p0 and u1 mod p1
+     * are then recombined into c = u0 + p0 · ((u1 - u0) · p0^-1 mod p1), which
+     * is congruent to the integer product mod p0 · p1 = 94391809. The Barrett
+     * multiplications bound c by 3/4 · p0 · p1 in absolute value, while the
+     * product of a polynomial with a small polynomial of weight 250 is bounded
+     * by 250 · 2295. Therefore c is exactly the integer coefficient, which is
+     * weighed in { 0, ..., M - 1 } as expected by __asm_reduce_terms_761().
+     *
+     * We need to repeat this sequence 192 times. We can take 8 values in one go
+     * and 1536 / 8 = 192. */
+
+    .rept 192
+
+    ld1     {v1.8h}, [in_0], #16
+    ld1     {v2.8h}, [in_1], #16
+
+    barrett_mul v1, v1, 0, 1, 6, v3
+    barrett_mul v2, v2, 2, 3, 7, v4
+    sub     v2.8h, v2.8h, v1.8h
+    barrett_mul v2, v2, 4, 5, 7, v4
+
+    sxtl    v5.4s, v1.4h
+    sxtl2   v6.4s, v1.8h
+    smlal   v5.4s, v2.4h, v0.4h[6]
+    smlal2  v6.4s, v2.8h, v0.8h[6]
+
+    cmlt    v3.4s, v5.4s, #0
+    cmlt    v4.4s, v6.4s, #0
+    and     v3.16b, v3.16b, v31.16b
+    and     v4.16b, v4.16b, v31.16b
+    add     v5.4s, v5.4s, v3.4s
+    add     v6.4s, v6.4s, v4.4s
+
+    st1     {v5.4s, v6.4s}, [out], #32
+
+    .endr
+
+    .unreq  out
+    .unreq  in_0
+    .unreq  in_1
+    .unreq  value
+
+    ret     lr
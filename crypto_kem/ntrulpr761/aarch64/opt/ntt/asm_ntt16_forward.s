@@ -0,0 +1,232 @@
+/* Switch to the text segment - this contains the program code */
+
+.text
+
+/* Provide function declarations */
+
+.global __asm_ntt16_forward
+.type __asm_ntt16_forward, %function
+
+/* Provide macro definitions */
+
+/* Reduce the 16 bit integer coefficients of a into { -p/2, ..., p/2 } using
+ * Barrett reduction, i.e. a = a - round(a · V / 2^26) · p for V = round(2^26 /
+ * p). The constant values p and V are stored in v0.8h[0] and v0.8h[1]. */
+
+.macro barrett a, tmp
+    sqdmulh \tmp\().8h, \a\().8h, v0.8h[1]
+    srshr   \tmp\().8h, \tmp\().8h, #11
+    mls     \a\().8h, \tmp\().8h, v0.8h[0]
+.endm
+
+/* Compute the Cooley-Tukey butterfly (a, b) = (a + b · w, a - b · w), where the
+ * root w and w' = round(w · 2^15 / p) are the lanes i and i' of root. The
+ * product b · w is computed mod p using Barrett multiplication, such that it is
+ * bounded by p in absolute value. */
+
+.macro ct_lane a, b, root, i, i_p, tmp0, tmp1
+    sqrdmulh \tmp1\().8h, \b\().8h, \root\().8h[\i_p]
+    mul     \tmp0\().8h, \b\().8h, \root\().8h[\i]
+    mls     \tmp0\().8h, \tmp1\().8h, v0.8h[0]
+    sub     \b\().8h, \a\().8h, \tmp0\().8h
+    add     \a\().8h, \a\().8h, \tmp0\().8h
+.endm
+
+/* Compute the Cooley-Tukey butterfly (a, b) = (a + b · w, a - b · w) with a
+ * different root in every lane, where w and w' are stored in root and root'. */
+
+.macro ct_vector a, b, root, root_p, tmp0, tmp1
+    sqrdmulh \tmp1\().8h, \b\().8h, \root_p\().8h
+    mul     \tmp0\().8h, \b\().8h, \root\().8h
+    mls     \tmp0\().8h, \tmp1\().8h, v0.8h[0]
+    sub     \b\().8h, \a\().8h, \tmp0\().8h
+    add     \a\().8h, \a\().8h, \tmp0\().8h
+.endm
+
+/* Compute the NTT layers l and l + 1 on 4 vectors of 8 integer coefficients at
+ * a time. Block b of layer l has length 2d for d = 256 >> l and its vectors j,
+ * j + d/2, j + d and j + 3d/2 form two blocks of layer l + 1. The roots of both
+ * layers are stored as { w_l(b), w_{l+1}(2b), w_{l+1}(2b + 1) } in v1. The
+ * coefficients are read from src and stored to out after a Barrett reduction,
+ * which allows the first pass to read the input polynomial directly. */
+
+.macro ct_pass l, src
+    .set    block, 0
+    .rept   1 << (\l)
+
+    ldr     q1, [roots], #16
+
+    .set    index, 0
+    .rept   (256 >> (\l)) / 16
+
+    .set    offset, 2 * ((512 >> (\l)) * block + index)
+    ldr     q16, [\src, #offset]
+    ldr     q17, [\src, #offset + (256 >> (\l))]
+    ldr     q18, [\src, #offset + (512 >> (\l))]
+    ldr     q19, [\src, #offset + (768 >> (\l))]
+
+    ct_lane v16, v18, v1, 0, 1, v20, v24
+    ct_lane v17, v19, v1, 0, 1, v21, v25
+    ct_lane v16, v17, v1, 2, 3, v20, v24
+    ct_lane v18, v19, v1, 4, 5, v21, v25
+
+    barrett v16, v20
+    barrett v17, v21
+    barrett v18, v22
+    barrett v19, v23
+
+    str     q16, [out, #offset]
+    str     q17, [out, #offset + (256 >> (\l))]
+    str     q18, [out, #offset + (512 >> (\l))]
+    str     q19, [out, #offset + (768 >> (\l))]
+
+    .set    index, index + 8
+    .endr
+
+    .set    block, block + 1
+    .endr
+.endm
+
+/* Transpose the 8x8 matrix of 16 bit integer coefficients in v16, ..., v23 into
+ * v24, ..., v31, i.e. lane g of row r is moved into lane r of row g. */
+
+.macro transpose
+    trn1    v24.8h, v16.8h, v17.8h
+    trn2    v25.8h, v16.8h, v17.8h
+    trn1    v26.8h, v18.8h, v19.8h
+    trn2    v27.8h, v18.8h, v19.8h
+    trn1    v28.8h, v20.8h, v21.8h
+    trn2    v29.8h, v20.8h, v21.8h
+    trn1    v30.8h, v22.8h, v23.8h
+    trn2    v31.8h, v22.8h, v23.8h
+
+    trn1    v16.4s, v24.4s, v26.4s
+    trn2    v18.4s, v24.4s, v26.4s
+    trn1    v17.4s, v25.4s, v27.4s
+    trn2    v19.4s, v25.4s, v27.4s
+    trn1    v20.4s, v28.4s, v30.4s
+    trn2    v22.4s, v28.4s, v30.4s
+    trn1    v21.4s, v29.4s, v31.4s
+    trn2    v23.4s, v29.4s, v31.4s
+
+    trn1    v24.2d, v16.2d, v20.2d
+    trn2    v28.2d, v16.2d, v20.2d
+    trn1    v25.2d, v17.2d, v21.2d
+    trn2    v29.2d, v17.2d, v21.2d
+    trn1    v26.2d, v18.2d, v22.2d
+    trn2    v30.2d, v18.2d, v22.2d
+    trn1    v27.2d, v19.2d, v23.2d
+    trn2    v31.2d, v19.2d, v23.2d
+.endm
+
+__asm_ntt16_forward:
+
+    /* Due to our choice of registers we do not need (to store) callee-saved
+     * registers. Neither do we use the procedure link register, as we do not
+     * branch to any functions from within this subroutine. The function
+     * prologue is therefore empty. */
+
+    /* Alias registers for a specific purpose (and readability) */
+
+    out     .req x0     // Store pointer to the first resulting coefficient
+    in      .req x1     // Store pointer to the first input coefficient
+    roots   .req x2     // Store pointer to the next precomputed root values
+
+    /* Initialize constant values. The table of roots starts with the constant
+     * values { p, V, p^-1 mod 2^16 }. */
+
+    ldr     q0, [roots], #16
+
+    /* Layers 0+1, 2+3 and 4+5 */
+
+    ct_pass 0, in
+    ct_pass 2, out
+    ct_pass 4, out
+
+    /* Layers 6+7+8 */
+
+    /* The remaining layers only combine coefficients within 64 consecutive
+     * coefficients. We transpose each chunk of 8 vectors, such that lane g of
+     * row r holds the coefficient 8g + r. The butterflies then operate on whole
+     * vectors with a different root in every lane. The chunk is stored without
+     * transposing it back, i.e. coefficient 64c + 8g + r of the NTT domain is
+     * stored at 64c + 8r + g. The base multiplication is point-wise and the
+     * inverse NTT expects this order, so this permutation does not matter. */
+
+    .set    chunk, 0
+    .rept 8
+
+    .set    offset, 128 * chunk
+    ldr     q16, [out, #offset + 16 * 0]
+    ldr     q17, [out, #offset + 16 * 1]
+    ldr     q18, [out, #offset + 16 * 2]
+    ldr     q19, [out, #offset + 16 * 3]
+    ldr     q20, [out, #offset + 16 * 4]
+    ldr     q21, [out, #offset + 16 * 5]
+    ldr     q22, [out, #offset + 16 * 6]
+    ldr     q23, [out, #offset + 16 * 7]
+
+    transpose
+
+    /* NTT forward layer 6: rows (r, r + 4), root w_6(8c + g) */
+    /* NTT forward layer 7: rows (r, r + 2), root w_7(16c + 2g + r / 4) */
+
+    ld1     {v1.8h, v2.8h}, [roots], #32
+    ld1     {v3.8h, v4.8h, v5.8h, v6.8h}, [roots], #64
+
+    ct_vector v24, v28, v1, v2, v16, v20
+    ct_vector v25, v29, v1, v2, v17, v21
+    ct_vector v26, v30, v1, v2, v18, v22
+    ct_vector v27, v31, v1, v2, v19, v23
+
+    ct_vector v24, v26, v3, v4, v16, v20
+    ct_vector v25, v27, v3, v4, v17, v21
+    ct_vector v28, v30, v5, v6, v18, v22
+    ct_vector v29, v31, v5, v6, v19, v23
+
+    barrett v24, v16
+    barrett v25, v17
+    barrett v26, v18
+    barrett v27, v19
+    barrett v28, v20
+    barrett v29, v21
+    barrett v30, v22
+    barrett v31, v16
+
+    /* NTT forward layer 8: rows (r, r + 1), root w_8(32c + 4g + r / 2) */
+
+    ld1     {v1.8h, v2.8h, v3.8h, v4.8h}, [roots], #64
+    ld1     {v5.8h, v6.8h, v7.8h}, [roots], #48
+    ldr     q23, [roots], #16
+
+    ct_vector v24, v25, v1, v2, v16, v20
+    ct_vector v26, v27, v3, v4, v17, v21
+    ct_vector v28, v29, v5, v6, v18, v22
+    ct_vector v30, v31, v7, v23, v19, v20
+
+    barrett v24, v16
+    barrett v25, v17
+    barrett v26, v18
+    barrett v27, v19
+    barrett v28, v20
+    barrett v29, v21
+    barrett v30, v22
+    barrett v31, v23
+
+    str     q24, [out, #offset + 16 * 0]
+    str     q25, [out, #offset + 16 * 1]
+    str     q26, [out, #offset + 16 * 2]
+    str     q27, [out, #offset + 16 * 3]
+    str     q28, [out, #offset + 16 * 4]
+    str     q29, [out, #offset + 16 * 5]
+    str     q30, [out, #offset + 16 * 6]
+    str     q31, [out, #offset + 16 * 7]
+
+    .set    chunk, chunk + 1
+    .endr
+
+    .unreq  out
+    .unreq  in
+    .unreq  roots
+
+    ret     lr
@@ -0,0 +1,208 @@
+/* Switch to the text segment - this contains the program code */
+
+.text
+
+/* Provide function declarations */
+
+.global __asm_ntt16_inverse
+.type __asm_ntt16_inverse, %function
+
+/* Provide macro definitions */
+
+/* Reduce the 16 bit integer coefficients of a into { -p/2, ..., p/2 } using
+ * Barrett reduction, i.e. a = a - round(a · V / 2^26) · p for V = round(2^26 /
+ * p). The constant values p and V are stored in v0.8h[0] and v0.8h[1]. */
+
+.macro barrett a, tmp
+    sqdmulh \tmp\().8h, \a\().8h, v0.8h[1]
+    srshr   \tmp\().8h, \tmp\().8h, #11
+    mls     \a\().8h, \tmp\().8h, v0.8h[0]
+.endm
+
+/* Compute the Gentleman-Sande butterfly (a, b) = (a + b, (a - b) · w), where
+ * the root w and w' = round(w · 2^15 / p) are the lanes i and i' of root.
+ * The sum is Barrett reduced and the product is computed mod p using Barrett
+ * multiplication, such that both are bounded by p in absolute value. */
+
+.macro gs_lane a, b, root, i, i_p, tmp0, tmp1
+    sub     \tmp0\().8h, \a\().8h, \b\().8h
+    add     \a\().8h, \a\().8h, \b\().8h
+    sqrdmulh \tmp1\().8h, \tmp0\().8h, \root\().8h[\i_p]
+    mul     \b\().8h, \tmp0\().8h, \root\().8h[\i]
+    mls     \b\().8h, \tmp1\().8h, v0.8h[0]
+    barrett \a, \tmp0
+.endm
+
+/* Compute the Gentleman-Sande butterfly (a, b) = (a + b, (a - b) · w) with a
+ * different root in every lane, where w and w' are stored in root and root'. */
+
+.macro gs_vector a, b, root, root_p, tmp0, tmp1
+    sub     \tmp0\().8h, \a\().8h, \b\().8h
+    add     \a\().8h, \a\().8h, \b\().8h
+    sqrdmulh \tmp1\().8h, \tmp0\().8h, \root_p\().8h
+    mul     \b\().8h, \tmp0\().8h, \root\().8h
+    mls     \b\().8h, \tmp1\().8h, v0.8h[0]
+    barrett \a, \tmp0
+.endm
+
+/* Compute the inverse NTT layers l + 1 and l on 4 vectors of 8 integer
+ * coefficients at a time. Block b of layer l has length 2d for d = 256 >> l and
+ * its vectors j, j + d/2, j + d and j + 3d/2 form two blocks of layer l + 1.
+ * The roots of both layers are stored as { w_{l+1}(2b), w_{l+1}(2b + 1), w_l(b)
+ * } in v1. */
+
+.macro gs_pass l
+    .set    block, 0
+    .rept   1 << (\l)
+
+    ldr     q1, [roots], #16
+
+    .set    index, 0
+    .rept   (256 >> (\l)) / 16
+
+    .set    offset, 2 * ((512 >> (\l)) * block + index)
+    ldr     q16, [start, #offset]
+    ldr     q17, [start, #offset + (256 >> (\l))]
+    ldr     q18, [start, #offset + (512 >> (\l))]
+    ldr     q19, [start, #offset + (768 >> (\l))]
+
+    gs_lane v16, v17, v1, 0, 1, v20, v24
+    gs_lane v18, v19, v1, 2, 3, v21, v25
+    gs_lane v16, v18, v1, 4, 5, v20, v24
+    gs_lane v17, v19, v1, 4, 5, v21, v25
+
+    str     q16, [start, #offset]
+    str     q17, [start, #offset + (256 >> (\l))]
+    str     q18, [start, #offset + (512 >> (\l))]
+    str     q19, [start, #offset + (768 >> (\l))]
+
+    .set    index, index + 8
+    .endr
+
+    .set    block, block + 1
+    .endr
+.endm
+
+/* Transpose the 8x8 matrix of 16 bit integer coefficients in v16, ..., v23 into
+ * v24, ..., v31, i.e. lane g of row r is moved into lane r of row g. */
+
+.macro transpose
+    trn1    v24.8h, v16.8h, v17.8h
+    trn2    v25.8h, v16.8h, v17.8h
+    trn1    v26.8h, v18.8h, v19.8h
+    trn2    v27.8h, v18.8h, v19.8h
+    trn1    v28.8h, v20.8h, v21.8h
+    trn2    v29.8h, v20.8h, v21.8h
+    trn1    v30.8h, v22.8h, v23.8h
+    trn2    v31.8h, v22.8h, v23.8h
+
+    trn1    v16.4s, v24.4s, v26.4s
+    trn2    v18.4s, v24.4s, v26.4s
+    trn1    v17.4s, v25.4s, v27.4s
+    trn2    v19.4s, v25.4s, v27.4s
+    trn1    v20.4s, v28.4s, v30.4s
+    trn2    v22.4s, v28.4s, v30.4s
+    trn1    v21.4s, v29.4s, v31.4s
+    trn2    v23.4s, v29.4s, v31.4s
+
+    trn1    v24.2d, v16.2d, v20.2d
+    trn2    v28.2d, v16.2d, v20.2d
+    trn1    v25.2d, v17.2d, v21.2d
+    trn2    v29.2d, v17.2d, v21.2d
+    trn1    v26.2d, v18.2d, v22.2d
+    trn2    v30.2d, v18.2d, v22.2d
+    trn1    v27.2d, v19.2d, v23.2d
+    trn2    v31.2d, v19.2d, v23.2d
+.endm
+
+__asm_ntt16_inverse:
+
+    /* Due to our choice of registers we do not need (to store) callee-saved
+     * registers. Neither do we use the procedure link register, as we do not
+     * branch to any functions from within this subroutine. The function
+     * prologue is therefore empty. */
+
+    /* Alias registers for a specific purpose (and readability) */
+
+    start   .req x0     // Store pointer to the first integer coefficient
+    roots   .req x1     // Store pointer to the next precomputed root values
+
+    /* Initialize constant values. The table of roots starts with the constant
+     * values { p, V, p^-1 mod 2^16 }. */
+
+    ldr     q0, [roots], #16
+
+    /* Layers 8+7+6 */
+
+    /* The coefficients are stored in the order of __asm_ntt16_forward(), i.e.
+     * lane g of row r of each chunk of 64 coefficients holds coefficient 8g + r.
+     * The first layers therefore operate on whole vectors with a different root
+     * in every lane, after which the chunk is transposed back into place. */
+
+    .set    chunk, 0
+    .rept 8
+
+    .set    offset, 128 * chunk
+    ldr     q16, [start, #offset + 16 * 0]
+    ldr     q17, [start, #offset + 16 * 1]
+    ldr     q18, [start, #offset + 16 * 2]
+    ldr     q19, [start, #offset + 16 * 3]
+    ldr     q20, [start, #offset + 16 * 4]
+    ldr     q21, [start, #offset + 16 * 5]
+    ldr     q22, [start, #offset + 16 * 6]
+    ldr     q23, [start, #offset + 16 * 7]
+
+    /* NTT inverse layer 8: rows (r, r + 1), root w_8(32c + 4g + r / 2)^-1 */
+
+    ld1     {v1.8h, v2.8h, v3.8h, v4.8h}, [roots], #64
+    ld1     {v5.8h, v6.8h, v7.8h}, [roots], #48
+    ldr     q31, [roots], #16
+
+    gs_vector v16, v17, v1, v2, v24, v28
+    gs_vector v18, v19, v3, v4, v25, v29
+    gs_vector v20, v21, v5, v6, v26, v30
+    gs_vector v22, v23, v7, v31, v27, v28
+
+    /* NTT inverse layer 7: rows (r, r + 2), root w_7(16c + 2g + r / 4)^-1 */
+    /* NTT inverse layer 6: rows (r, r + 4), root w_6(8c + g)^-1 */
+
+    ld1     {v1.8h, v2.8h, v3.8h, v4.8h}, [roots], #64
+    ld1     {v5.8h, v6.8h}, [roots], #32
+
+    gs_vector v16, v18, v1, v2, v24, v28
+    gs_vector v17, v19, v1, v2, v25, v29
+    gs_vector v20, v22, v3, v4, v26, v30
+    gs_vector v21, v23, v3, v4, v27, v31
+
+    gs_vector v16, v20, v5, v6, v24, v28
+    gs_vector v17, v21, v5, v6, v25, v29
+    gs_vector v18, v22, v5, v6, v26, v30
+    gs_vector v19, v23, v5, v6, v27, v31
+
+    transpose
+
+    str     q24, [start, #offset + 16 * 0]
+    str     q25, [start, #offset + 16 * 1]
+    str     q26, [start, #offset + 16 * 2]
+    str     q27, [start, #offset + 16 * 3]
+    str     q28, [start, #offset + 16 * 4]
+    str     q29, [start, #offset + 16 * 5]
+    str     q30, [start, #offset + 16 * 6]
+    str     q31, [start, #offset + 16 * 7]
+
+    .set    chunk, chunk + 1
+    .endr
+
+    /* Layers 5+4, 3+2 and 1+0 */
+
+    /* The result is scaled by 512, which is compensated for together with the
+     * Montgomery factor of the base multiplication during CRT recombination. */
+
+    gs_pass 4
+    gs_pass 2
+    gs_pass 0
+
+    .unreq  start
+    .unreq  roots
+
+    ret     lr
@@ -0,0 +1,1921 @@
+/* This file has been generated by samples/polymult_py/gen_ntt_asm.py, please
+ * change the strategy and regenerate it instead of editing it. Strategy:
+ * groups = 4+4, twiddles = block, batch = 4, data = v0
+ *
+ * The first layer is not computed here, it has been merged into the Good's
+ * permutation (see asm_goods.s) */
+
+/* Switch to the text segment - this contains the program code */
+
+.text
+
+/* Provide function declarations */
+
+.global __asm_ntt_forward_l2
+.type __asm_ntt_forward_l2, %function
+
+__asm_ntt_forward_l2:
+
+    /* Store the callee-saved registers v8 - v15 (their lower 64 bits) that
+     * are used by this subroutine */
+
+    stp     d8, d9, [sp, #-64]!
+    stp     d10, d11, [sp, #16]
+    stp     d12, d13, [sp, #32]
+    stp     d14, d15, [sp, #48]
+
+    /* Alias registers for a specific purpose (and readability) */
+
+    start   .req x0     // Store pointer to the first integer coefficient
+    M       .req w15    // Store the constant value M = 6984193
+
+    /* Initialize constant values */
+
+    mov     M, #0x9201              // 6984193 (= M)
+    movk    M, #0x6a, lsl #16
+    dup     v16.4s, M
+
+    /* Layers 2+3+4+5 */
+    /* NTT forward layer 2: length = 128, ridx = 1, loops = 2 */
+    /* NTT forward layer 3: length = 64, ridx = 3, loops = 4 */
+    /* NTT forward layer 4: length = 32, ridx = 7, loops = 8 */
+    /* NTT forward layer 5: length = 16, ridx = 15, loops = 16 */
+
+    add     x3, x1, #4 * 15
+    ldr     q17, [x3]
+    add     x4, x2, #4 * 15
+    ldr     q18, [x4]
+    add     x3, x1, #4 * 19
+    ldr     q19, [x3]
+    add     x4, x2, #4 * 19
+    ldr     q20, [x4]
+    ldr     q0, [start, #4 * 0]
+    ldr     q1, [start, #4 * 16]
+    ldr     q2, [start, #4 * 32]
+    ldr     q3, [start, #4 * 48]
+    ldr     q4, [start, #4 * 64]
+    ldr     q5, [start, #4 * 80]
+    ldr     q6, [start, #4 * 96]
+    ldr     q7, [start, #4 * 112]
+    ldr     q8, [start, #4 * 128]
+    ldr     q9, [start, #4 * 144]
+    ldr     q10, [start, #4 * 160]
+    ldr     q11, [start, #4 * 176]
+    ldr     q12, [start, #4 * 192]
+    ldr     q13, [start, #4 * 208]
+    ldr     q14, [start, #4 * 224]
+    ldr     q15, [start, #4 * 240]
+    sub     v21.4s, v0.4s, v8.4s
+    add     v0.4s, v0.4s, v8.4s
+    sub     v22.4s, v1.4s, v9.4s
+    add     v1.4s, v1.4s, v9.4s
+    sub     v23.4s, v2.4s, v10.4s
+    add     v2.4s, v2.4s, v10.4s
+    sub     v24.4s, v3.4s, v11.4s
+    add     v3.4s, v3.4s, v11.4s
+    sub     v25.4s, v4.4s, v12.4s
+    add     v4.4s, v4.4s, v12.4s
+    sub     v26.4s, v5.4s, v13.4s
+    add     v5.4s, v5.4s, v13.4s
+    sub     v27.4s, v6.4s, v14.4s
+    add     v6.4s, v6.4s, v14.4s
+    sub     v28.4s, v7.4s, v15.4s
+    add     v7.4s, v7.4s, v15.4s
+    sub     v29.4s, v0.4s, v4.4s
+    add     v0.4s, v0.4s, v4.4s
+    sub     v30.4s, v1.4s, v5.4s
+    add     v1.4s, v1.4s, v5.4s
+    sub     v31.4s, v2.4s, v6.4s
+    add     v2.4s, v2.4s, v6.4s
+    sub     v4.4s, v3.4s, v7.4s
+    add     v3.4s, v3.4s, v7.4s
+    sqdmulh v5.4s, v25.4s, v17.4s[1]
+    sqdmulh v7.4s, v26.4s, v17.4s[1]
+    sqdmulh v9.4s, v27.4s, v17.4s[1]
+    sqdmulh v11.4s, v28.4s, v17.4s[1]
+    mul     v6.4s, v25.4s, v18.4s[1]
+    mul     v8.4s, v26.4s, v18.4s[1]
+    mul     v10.4s, v27.4s, v18.4s[1]
+    mul     v12.4s, v28.4s, v18.4s[1]
+    sqdmulh v6.4s, v6.4s, v16.4s[0]
+    sqdmulh v8.4s, v8.4s, v16.4s[0]
+    sqdmulh v10.4s, v10.4s, v16.4s[0]
+    sqdmulh v12.4s, v12.4s, v16.4s[0]
+    sub     v5.4s, v5.4s, v6.4s
+    sub     v7.4s, v7.4s, v8.4s
+    sub     v9.4s, v9.4s, v10.4s
+    sub     v11.4s, v11.4s, v12.4s
+    sub     v25.4s, v21.4s, v5.4s
+    add     v21.4s, v21.4s, v5.4s
+    sub     v26.4s, v22.4s, v7.4s
+    add     v22.4s, v22.4s, v7.4s
+    sub     v27.4s, v23.4s, v9.4s
+    add     v23.4s, v23.4s, v9.4s
+    sub     v28.4s, v24.4s, v11.4s
+    add     v24.4s, v24.4s, v11.4s
+    sub     v5.4s, v0.4s, v2.4s
+    add     v0.4s, v0.4s, v2.4s
+    sub     v2.4s, v1.4s, v3.4s
+    add     v1.4s, v1.4s, v3.4s
+    sqdmulh v3.4s, v31.4s, v17.4s[1]
+    sqdmulh v7.4s, v4.4s, v17.4s[1]
+    sqdmulh v9.4s, v23.4s, v17.4s[2]
+    sqdmulh v11.4s, v24.4s, v17.4s[2]
+    mul     v6.4s, v31.4s, v18.4s[1]
+    mul     v8.4s, v4.4s, v18.4s[1]
+    mul     v10.4s, v23.4s, v18.4s[2]
+    mul     v12.4s, v24.4s, v18.4s[2]
+    sqdmulh v6.4s, v6.4s, v16.4s[0]
+    sqdmulh v8.4s, v8.4s, v16.4s[0]
+    sqdmulh v10.4s, v10.4s, v16.4s[0]
+    sqdmulh v12.4s, v12.4s, v16.4s[0]
+    sub     v3.4s, v3.4s, v6.4s
+    sub     v7.4s, v7.4s, v8.4s
+    sub     v9.4s, v9.4s, v10.4s
+    sub     v11.4s, v11.4s, v12.4s
+    sub     v31.4s, v29.4s, v3.4s
+    add     v29.4s, v29.4s, v3.4s
+    sub     v4.4s, v30.4s, v7.4s
+    add     v30.4s, v30.4s, v7.4s
+    sub     v23.4s, v21.4s, v9.4s
+    add     v21.4s, v21.4s, v9.4s
+    sub     v24.4s, v22.4s, v11.4s
+    add     v22.4s, v22.4s, v11.4s
+    sqdmulh v3.4s, v27.4s, v17.4s[3]
+    sqdmulh v7.4s, v28.4s, v17.4s[3]
+    mul     v6.4s, v27.4s, v18.4s[3]
+    mul     v8.4s, v28.4s, v18.4s[3]
+    sqdmulh v6.4s, v6.4s, v16.4s[0]
+    sqdmulh v8.4s, v8.4s, v16.4s[0]
+    sub     v3.4s, v3.4s, v6.4s
+    sub     v7.4s, v7.4s, v8.4s
+    sub     v27.4s, v25.4s, v3.4s
+    add     v25.4s, v25.4s, v3.4s
+    sub     v28.4s, v26.4s, v7.4s
+    add     v26.4s, v26.4s, v7.4s
+    sub     v3.4s, v0.4s, v1.4s
+    add     v0.4s, v0.4s, v1.4s
+    sqdmulh v1.4s, v2.4s, v17.4s[1]
+    sqdmulh v7.4s, v30.4s, v17.4s[2]
+    sqdmulh v9.4s, v4.4s, v17.4s[3]
+    sqdmulh v11.4s, v22.4s, v19.4s[0]
+    mul     v6.4s, v2.4s, v18.4s[1]
+    mul     v8.4s, v30.4s, v18.4s[2]
+    mul     v10.4s, v4.4s, v18.4s[3]
+    mul     v12.4s, v22.4s, v20.4s[0]
+    sqdmulh v6.4s, v6.4s, v16.4s[0]
+    sqdmulh v8.4s, v8.4s, v16.4s[0]
+    sqdmulh v10.4s, v10.4s, v16.4s[0]
+    sqdmulh v12.4s, v12.4s, v16.4s[0]
+    sub     v1.4s, v1.4s, v6.4s
+    sub     v7.4s, v7.4s, v8.4s
+    sub     v9.4s, v9.4s, v10.4s
+    sub     v11.4s, v11.4s, v12.4s
+    sub     v2.4s, v5.4s, v1.4s
+    add     v5.4s, v5.4s, v1.4s
+    sub     v30.4s, v29.4s, v7.4s
+    add     v29.4s, v29.4s, v7.4s
+    sub     v4.4s, v31.4s, v9.4s
+    add     v31.4s, v31.4s, v9.4s
+    sub     v22.4s, v21.4s, v11.4s
+    add     v21.4s, v21.4s, v11.4s
+    sqdmulh v1.4s, v24.4s, v19.4s[1]
+    sqdmulh v7.4s, v26.4s, v19.4s[2]
+    sqdmulh v9.4s, v28.4s, v19.4s[3]
+    mul     v6.4s, v24.4s, v20.4s[1]
+    mul     v8.4s, v26.4s, v20.4s[2]
+    mul     v10.4s, v28.4s, v20.4s[3]
+    sqdmulh v6.4s, v6.4s, v16.4s[0]
+    sqdmulh v8.4s, v8.4s, v16.4s[0]
+    sqdmulh v10.4s, v10.4s, v16.4s[0]
+    sub     v1.4s, v1.4s, v6.4s
+    sub     v7.4s, v7.4s, v8.4s
+    sub     v9.4s, v9.4s, v10.4s
+    sub     v24.4s, v23.4s, v1.4s
+    add     v23.4s, v23.4s, v1.4s
+    sub     v26.4s, v25.4s, v7.4s
+    add     v25.4s, v25.4s, v7.4s
+    sub     v28.4s, v27.4s, v9.4s
+    add     v27.4s, v27.4s, v9.4s
+    str     q0, [start, #4 * 0]
+    str     q3, [start, #4 * 16]
+    str     q5, [start, #4 * 32]
+    str     q2, [start, #4 * 48]
+    str     q29, [start, #4 * 64]
+    str     q30, [start, #4 * 80]
+    str     q31, [start, #4 * 96]
+    str     q4, [start, #4 * 112]
+    str     q21, [start, #4 * 128]
+    str     q22, [start, #4 * 144]
+    str     q23, [start, #4 * 160]
+    str     q24, [start, #4 * 176]
+    str     q25, [start, #4 * 192]
+    str     q26, [start, #4 * 208]
+    str     q27, [start, #4 * 224]
+    str     q28, [start, #4 * 240]
+
+    ldr     q0, [start, #4 * 4]
+    ldr     q1, [start, #4 * 20]
+    ldr     q2, [start, #4 * 36]
+    ldr     q3, [start, #4 * 52]
+    ldr     q4, [start, #4 * 68]
+    ldr     q5, [start, #4 * 84]
+    ldr     q6, [start, #4 * 100]
+    ldr     q7, [start, #4 * 116]
+    ldr     q8, [start, #4 * 132]
+    ldr     q9, [start, #4 * 148]
+    ldr     q10, [start, #4 * 164]
+    ldr     q11, [start, #4 * 180]
+    ldr     q12, [start, #4 * 196]
+    ldr     q13, [start, #4 * 212]
+    ldr     q14, [start, #4 * 228]
+    ldr     q15, [start, #4 * 244]
+    sub     v21.4s, v0.4s, v8.4s
+    add     v0.4s, v0.4s, v8.4s
+    sub     v22.4s, v1.4s, v9.4s
+    add     v1.4s, v1.4s, v9.4s
+    sub     v23.4s, v2.4s, v10.4s
+    add     v2.4s, v2.4s, v10.4s
+    sub     v24.4s, v3.4s, v11.4s
+    add     v3.4s, v3.4s, v11.4s
+    sub     v25.4s, v4.4s, v12.4s
+    add     v4.4s, v4.4s, v12.4s
+    sub     v26.4s, v5.4s, v13.4s
+    add     v5.4s, v5.4s, v13.4s
+    sub     v27.4s, v6.4s, v14.4s
+    add     v6.4s, v6.4s, v14.4s
+    sub     v28.4s, v7.4s, v15.4s
+    add     v7.4s, v7.4s, v15.4s
+    sub     v29.4s, v0.4s, v4.4s
+    add     v0.4s, v0.4s, v4.4s
+    sub     v30.4s, v1.4s, v5.4s
+    add     v1.4s, v1.4s, v5.4s
+    sub     v31.4s, v2.4s, v6.4s
+    add     v2.4s, v2.4s, v6.4s
+    sub     v4.4s, v3.4s, v7.4s
+    add     v3.4s, v3.4s, v7.4s
+    sqdmulh v5.4s, v25.4s, v17.4s[1]
+    sqdmulh v7.4s, v26.4s, v17.4s[1]
+    sqdmulh v9.4s, v27.4s, v17.4s[1]
+    sqdmulh v11.4s, v28.4s, v17.4s[1]
+    mul     v6.4s, v25.4s, v18.4s[1]
+    mul     v8.4s, v26.4s, v18.4s[1]
+    mul     v10.4s, v27.4s, v18.4s[1]
+    mul     v12.4s, v28.4s, v18.4s[1]
+    sqdmulh v6.4s, v6.4s, v16.4s[0]
+    sqdmulh v8.4s, v8.4s, v16.4s[0]
+    sqdmulh v10.4s, v10.4s, v16.4s[0]
+    sqdmulh v12.4s, v12.4s, v16.4s[0]
+    sub     v5.4s, v5.4s, v6.4s
+    sub     v7.4s, v7.4s, v8.4s
+    sub     v9.4s, v9.4s, v10.4s
+    sub     v11.4s, v11.4s, v12.4s
+    sub     v25.4s, v21.4s, v5.4s
+    add     v21.4s, v21.4s, v5.4s
+    sub     v26.4s, v22.4s, v7.4s
+    add     v22.4s, v22.4s, v7.4s
+    sub     v27.4s, v23.4s, v9.4s
+    add     v23.4s, v23.4s, v9.4s
+    sub     v28.4s, v24.4s, v11.4s
+    add     v24.4s, v24.4s, v11.4s
+    sub     v5.4s, v0.4s, v2.4s
+    add     v0.4s, v0.4s, v2.4s
+    sub     v2.4s, v1.4s, v3.4s
+    add     v1.4s, v1.4s, v3.4s
+    sqdmulh v3.4s, v31.4s, v17.4s[1]
+    sqdmulh v7.4s, v4.4s, v17.4s[1]
+    sqdmulh v9.4s, v23.4s, v17.4s[2]
+    sqdmulh v11.4s, v24.4s, v17.4s[2]
+    mul     v6.4s, v31.4s, v18.4s[1]
+    mul     v8.4s, v4.4s, v18.4s[1]
+    mul     v10.4s, v23.4s, v18.4s[2]
+    mul     v12.4s, v24.4s, v18.4s[2]
+    sqdmulh v6.4s, v6.4s, v16.4s[0]
+    sqdmulh v8.4s, v8.4s, v16.4s[0]
+    sqdmulh v10.4s, v10.4s, v16.4s[0]
+    sqdmulh v12.4s, v12.4s, v16.4s[0]
+    sub     v3.4s, v3.4s, v6.4s
+    sub     v7.4s, v7.4s, v8.4s
+    sub     v9.4s, v9.4s, v10.4s
+    sub     v11.4s, v11.4s, v12.4s
+    sub     v31.4s, v29.4s, v3.4s
+    add     v29.4s, v29.4s, v3.4s
+    sub     v4.4s, v30.4s, v7.4s
+    add     v30.4s, v30.4s, v7.4s
+    sub     v23.4s, v21.4s, v9.4s
+    add     v21.4s, v21.4s, v9.4s
+    sub     v24.4s, v22.4s, v11.4s
+    add     v22.4s, v22.4s, v11.4s
+    sqdmulh v3.4s, v27.4s, v17.4s[3]
+    sqdmulh v7.4s, v28.4s, v17.4s[3]
+    mul     v6.4s, v27.4s, v18.4s[3]
+    mul     v8.4s, v28.4s, v18.4s[3]
+    sqdmulh v6.4s, v6.4s, v16.4s[0]
+    sqdmulh v8.4s, v8.4s, v16.4s[0]
+    sub     v3.4s, v3.4s, v6.4s
+    sub     v7.4s, v7.4s, v8.4s
+    sub     v27.4s, v25.4s, v3.4s
+    add     v25.4s, v25.4s, v3.4s
+    sub     v28.4s, v26.4s, v7.4s
+    add     v26.4s, v26.4s, v7.4s
+    sub     v3.4s, v0.4s, v1.4s
+    add     v0.4s, v0.4s, v1.4s
+    sqdmulh v1.4s, v2.4s, v17.4s[1]
+    sqdmulh v7.4s, v30.4s, v17.4s[2]
+    sqdmulh v9.4s, v4.4s, v17.4s[3]
+    sqdmulh v11.4s, v22.4s, v19.4s[0]
+    mul     v6.4s, v2.4s, v18.4s[1]
+    mul     v8.4s, v30.4s, v18.4s[2]
+    mul     v10.4s, v4.4s, v18.4s[3]
+    mul     v12.4s, v22.4s, v20.4s[0]
+    sqdmulh v6.4s, v6.4s, v16.4s[0]
+    sqdmulh v8.4s, v8.4s, v16.4s[0]
+    sqdmulh v10.4s, v10.4s, v16.4s[0]
+    sqdmulh v12.4s, v12.4s, v16.4s[0]
+    sub     v1.4s, v1.4s, v6.4s
+    sub     v7.4s, v7.4s, v8.4s
+    sub     v9.4s, v9.4s, v10.4s
+    sub     v11.4s, v11.4s, v12.4s
+    sub     v2.4s, v5.4s, v1.4s
+    add     v5.4s, v5.4s, v1.4s
+    sub     v30.4s, v29.4s, v7.4s
+    add     v29.4s, v29.4s, v7.4s
+    sub     v4.4s, v31.4s, v9.4s
+    add     v31.4s, v31.4s, v9.4s
+    sub     v22.4s, v21.4s, v11.4s
+    add     v21.4s, v21.4s, v11.4s
+    sqdmulh v1.4s, v24.4s, v19.4s[1]
+    sqdmulh v7.4s, v26.4s, v19.4s[2]
+    sqdmulh v9.4s, v28.4s, v19.4s[3]
+    mul     v6.4s, v24.4s, v20.4s[1]
+    mul     v8.4s, v26.4s, v20.4s[2]
+    mul     v10.4s, v28.4s, v20.4s[3]
+    sqdmulh v6.4s, v6.4s, v16.4s[0]
+    sqdmulh v8.4s, v8.4s, v16.4s[0]
+    sqdmulh v10.4s, v10.4s, v16.4s[0]
+    sub     v1.4s, v1.4s, v6.4s
+    sub     v7.4s, v7.4s, v8.4s
+    sub     v9.4s, v9.4s, v10.4s
+    sub     v24.4s, v23.4s, v1.4s
+    add     v23.4s, v23.4s, v1.4s
+    sub     v26.4s, v25.4s, v7.4s
+    add     v25.4s, v25.4s, v7.4s
+    sub     v28.4s, v27.4s, v9.4s
+    add     v27.4s, v27.4s, v9.4s
+    str     q0, [start, #4 * 4]
+    str     q3, [start, #4 * 20]
+    str     q5, [start, #4 * 36]
+    str     q2, [start, #4 * 52]
+    str     q29, [start, #4 * 68]
+    str     q30, [start, #4 * 84]
+    str     q31, [start, #4 * 100]
+    str     q4, [start, #4 * 116]
+    str     q21, [start, #4 * 132]
+    str     q22, [start, #4 * 148]
+    str     q23, [start, #4 * 164]
+    str     q24, [start, #4 * 180]
+    str     q25, [start, #4 * 196]
+    str     q26, [start, #4 * 212]
+    str     q27, [start, #4 * 228]
+    str     q28, [start, #4 * 244]
+
+    ldr     q0, [start, #4 * 8]
+    ldr     q1, [start, #4 * 24]
+    ldr     q2, [start, #4 * 40]
+    ldr     q3, [start, #4 * 56]
+    ldr     q4, [start, #4 * 72]
+    ldr     q5, [start, #4 * 88]
+    ldr     q6, [start, #4 * 104]
+    ldr     q7, [start, #4 * 120]
+    ldr     q8, [start, #4 * 136]
+    ldr     q9, [start, #4 * 152]
+    ldr     q10, [start, #4 * 168]
+    ldr     q11, [start, #4 * 184]
+    ldr     q12, [start, #4 * 200]
+    ldr     q13, [start, #4 * 216]
+    ldr     q14, [start, #4 * 232]
+    ldr     q15, [start, #4 * 248]
+    sub     v21.4s, v0.4s, v8.4s
+    add     v0.4s, v0.4s, v8.4s
+    sub     v22.4s, v1.4s, v9.4s
+    add     v1.4s, v1.4s, v9.4s
+    sub     v23.4s, v2.4s, v10.4s
+    add     v2.4s, v2.4s, v10.4s
+    sub     v24.4s, v3.4s, v11.4s
+    add     v3.4s, v3.4s, v11.4s
+    sub     v25.4s, v4.4s, v12.4s
+    add     v4.4s, v4.4s, v12.4s
+    sub     v26.4s, v5.4s, v13.4s
+    add     v5.4s, v5.4s, v13.4s
+    sub     v27.4s, v6.4s, v14.4s
+    add     v6.4s, v6.4s, v14.4s
+    sub     v28.4s, v7.4s, v15.4s
+    add     v7.4s, v7.4s, v15.4s
+    sub     v29.4s, v0.4s, v4.4s
+    add     v0.4s, v0.4s, v4.4s
+    sub     v30.4s, v1.4s, v5.4s
+    add     v1.4s, v1.4s, v5.4s
+    sub     v31.4s, v2.4s, v6.4s
+    add     v2.4s, v2.4s, v6.4s
+    sub     v4.4s, v3.4s, v7.4s
+    add     v3.4s, v3.4s, v7.4s
+    sqdmulh v5.4s, v25.4s, v17.4s[1]
+    sqdmulh v7.4s, v26.4s, v17.4s[1]
+    sqdmulh v9.4s, v27.4s, v17.4s[1]
+    sqdmulh v11.4s, v28.4s, v17.4s[1]
+    mul     v6.4s, v25.4s, v18.4s[1]
+    mul     v8.4s, v26.4s, v18.4s[1]
+    mul     v10.4s, v27.4s, v18.4s[1]
+    mul     v12.4s, v28.4s, v18.4s[1]
+    sqdmulh v6.4s, v6.4s, v16.4s[0]
+    sqdmulh v8.4s, v8.4s, v16.4s[0]
+    sqdmulh v10.4s, v10.4s, v16.4s[0]
+    sqdmulh v12.4s, v12.4s, v16.4s[0]
+    sub     v5.4s, v5.4s, v6.4s
+    sub     v7.4s, v7.4s, v8.4s
+    sub     v9.4s, v9.4s, v10.4s
+    sub     v11.4s, v11.4s, v12.4s
+    sub     v25.4s, v21.4s, v5.4s
+    add     v21.4s, v21.4s, v5.4s
+    sub     v26.4s, v22.4s, v7.4s
+    add     v22.4s, v22.4s, v7.4s
+    sub     v27.4s, v23.4s, v9.4s
+    add     v23.4s, v23.4s, v9.4s
+    sub     v28.4s, v24.4s, v11.4s
+    add     v24.4s, v24.4s, v11.4s
+    sub     v5.4s, v0.4s, v2.4s
+    add     v0.4s, v0.4s, v2.4s
+    sub     v2.4s, v1.4s, v3.4s
+    add     v1.4s, v1.4s, v3.4s
+    sqdmulh v3.4s, v31.4s, v17.4s[1]
+    sqdmulh v7.4s, v4.4s, v17.4s[1]
+    sqdmulh v9.4s, v23.4s, v17.4s[2]
+    sqdmulh v11.4s, v24.4s, v17.4s[2]
+    mul     v6.4s, v31.4s, v18.4s[1]
+    mul     v8.4s, v4.4s, v18.4s[1]
+    mul     v10.4s, v23.4s, v18.4s[2]
+    mul     v12.4s, v24.4s, v18.4s[2]
+    sqdmulh v6.4s, v6.4s, v16.4s[0]
+    sqdmulh v8.4s, v8.4s, v16.4s[0]
+    sqdmulh v10.4s, v10.4s, v16.4s[0]
+    sqdmulh v12.4s, v12.4s, v16.4s[0]
+    sub     v3.4s, v3.4s, v6.4s
+    sub     v7.4s, v7.4s, v8.4s
+    sub     v9.4s, v9.4s, v10.4s
+    sub     v11.4s, v11.4s, v12.4s
+    sub     v31.4s, v29.4s, v3.4s
+    add     v29.4s, v29.4s, v3.4s
+    sub     v4.4s, v30.4s, v7.4s
+    add     v30.4s, v30.4s, v7.4s
+    sub     v23.4s, v21.4s, v9.4s
+    add     v21.4s, v21.4s, v9.4s
+    sub     v24.4s, v22.4s, v11.4s
+    add     v22.4s, v22.4s, v11.4s
+    sqdmulh v3.4s, v27.4s, v17.4s[3]
+    sqdmulh v7.4s, v28.4s, v17.4s[3]
+    mul     v6.4s, v27.4s, v18.4s[3]
+    mul     v8.4s, v28.4s, v18.4s[3]
+    sqdmulh v6.4s, v6.4s, v16.4s[0]
+    sqdmulh v8.4s, v8.4s, v16.4s[0]
+    sub     v3.4s, v3.4s, v6.4s
+    sub     v7.4s, v7.4s, v8.4s
+    sub     v27.4s, v25.4s, v3.4s
+    add     v25.4s, v25.4s, v3.4s
+    sub     v28.4s, v26.4s, v7.4s
+    add     v26.4s, v26.4s, v7.4s
+    sub     v3.4s, v0.4s, v1.4s
+    add     v0.4s, v0.4s, v1.4s
+    sqdmulh v1.4s, v2.4s, v17.4s[1]
+    sqdmulh v7.4s, v30.4s, v17.4s[2]
+    sqdmulh v9.4s, v4.4s, v17.4s[3]
+    sqdmulh v11.4s, v22.4s, v19.4s[0]
+    mul     v6.4s, v2.4s, v18.4s[1]
+    mul     v8.4s, v30.4s, v18.4s[2]
+    mul     v10.4s, v4.4s, v18.4s[3]
+    mul     v12.4s, v22.4s, v20.4s[0]
+    sqdmulh v6.4s, v6.4s, v16.4s[0]
+    sqdmulh v8.4s, v8.4s, v16.4s[0]
+    sqdmulh v10.4s, v10.4s, v16.4s[0]
+    sqdmulh v12.4s, v12.4s, v16.4s[0]
+    sub     v1.4s, v1.4s, v6.4s
+    sub     v7.4s, v7.4s, v8.4s
+    sub     v9.4s, v9.4s, v10.4s
+    sub     v11.4s, v11.4s, v12.4s
+    sub     v2.4s, v5.4s, v1.4s
+    add     v5.4s, v5.4s, v1.4s
+    sub     v30.4s, v29.4s, v7.4s
+    add     v29.4s, v29.4s, v7.4s
+    sub     v4.4s, v31.4s, v9.4s
+    add     v31.4s, v31.4s, v9.4s
+    sub     v22.4s, v21.4s, v11.4s
+    add     v21.4s, v21.4s, v11.4s
+    sqdmulh v1.4s, v24.4s, v19.4s[1]
+    sqdmulh v7.4s, v26.4s, v19.4s[2]
+    sqdmulh v9.4s, v28.4s, v19.4s[3]
+    mul     v6.4s, v24.4s, v20.4s[1]
+    mul     v8.4s, v26.4s, v20.4s[2]
+    mul     v10.4s, v28.4s, v20.4s[3]
+    sqdmulh v6.4s, v6.4s, v16.4s[0]
+    sqdmulh v8.4s, v8.4s, v16.4s[0]
+    sqdmulh v10.4s, v10.4s, v16.4s[0]
+    sub     v1.4s, v1.4s, v6.4s
+    sub     v7.4s, v7.4s, v8.4s
+    sub     v9.4s, v9.4s, v10.4s
+    sub     v24.4s, v23.4s, v1.4s
+    add     v23.4s, v23.4s, v1.4s
+    sub     v26.4s, v25.4s, v7.4s
+    add     v25.4s, v25.4s, v7.4s
+    sub     v28.4s, v27.4s, v9.4s
+    add     v27.4s, v27.4s, v9.4s
+    str     q0, [start, #4 * 8]
+    str     q3, [start, #4 * 24]
+    str     q5, [start, #4 * 40]
+    str     q2, [start, #4 * 56]
+    str     q29, [start, #4 * 72]
+    str     q30, [start, #4 * 88]
+    str     q31, [start, #4 * 104]
+    str     q4, [start, #4 * 120]
+    str     q21, [start, #4 * 136]
+    str     q22, [start, #4 * 152]
+    str     q23, [start, #4 * 168]
+    str     q24, [start, #4 * 184]
+    str     q25, [start, #4 * 200]
+    str     q26, [start, #4 * 216]
+    str     q27, [start, #4 * 232]
+    str     q28, [start, #4 * 248]
+
+    ldr     q0, [start, #4 * 12]
+    ldr     q1, [start, #4 * 28]
+    ldr     q2, [start, #4 * 44]
+    ldr     q3, [start, #4 * 60]
+    ldr     q4, [start, #4 * 76]
+    ldr     q5, [start, #4 * 92]
+    ldr     q6, [start, #4 * 108]
+    ldr     q7, [start, #4 * 124]
+    ldr     q8, [start, #4 * 140]
+    ldr     q9, [start, #4 * 156]
+    ldr     q10, [start, #4 * 172]
+    ldr     q11, [start, #4 * 188]
+    ldr     q12, [start, #4 * 204]
+    ldr     q13, [start, #4 * 220]
+    ldr     q14, [start, #4 * 236]
+    ldr     q15, [start, #4 * 252]
+    sub     v21.4s, v0.4s, v8.4s
+    add     v0.4s, v0.4s, v8.4s
+    sub     v22.4s, v1.4s, v9.4s
+    add     v1.4s, v1.4s, v9.4s
+    sub     v23.4s, v2.4s, v10.4s
+    add     v2.4s, v2.4s, v10.4s
+    sub     v24.4s, v3.4s, v11.4s
+    add     v3.4s, v3.4s, v11.4s
+    sub     v25.4s, v4.4s, v12.4s
+    add     v4.4s, v4.4s, v12.4s
+    sub     v26.4s, v5.4s, v13.4s
+    add     v5.4s, v5.4s, v13.4s
+    sub     v27.4s, v6.4s, v14.4s
+    add     v6.4s, v6.4s, v14.4s
+    sub     v28.4s, v7.4s, v15.4s
+    add     v7.4s, v7.4s, v15.4s
+    sub     v29.4s, v0.4s, v4.4s
+    add     v0.4s, v0.4s, v4.4s
+    sub     v30.4s, v1.4s, v5.4s
+    add     v1.4s, v1.4s, v5.4s
+    sub     v31.4s, v2.4s, v6.4s
+    add     v2.4s, v2.4s, v6.4s
+    sub     v4.4s, v3.4s, v7.4s
+    add     v3.4s, v3.4s, v7.4s
+    sqdmulh v5.4s, v25.4s, v17.4s[1]
+    sqdmulh v7.4s, v26.4s, v17.4s[1]
+    sqdmulh v9.4s, v27.4s, v17.4s[1]
+    sqdmulh v11.4s, v28.4s, v17.4s[1]
+    mul     v6.4s, v25.4s, v18.4s[1]
+    mul     v8.4s, v26.4s, v18.4s[1]
+    mul     v10.4s, v27.4s, v18.4s[1]
+    mul     v12.4s, v28.4s, v18.4s[1]
+    sqdmulh v6.4s, v6.4s, v16.4s[0]
+    sqdmulh v8.4s, v8.4s, v16.4s[0]
+    sqdmulh v10.4s, v10.4s, v16.4s[0]
+    sqdmulh v12.4s, v12.4s, v16.4s[0]
+    sub     v5.4s, v5.4s, v6.4s
+    sub     v7.4s, v7.4s, v8.4s
+    sub     v9.4s, v9.4s, v10.4s
+    sub     v11.4s, v11.4s, v12.4s
+    sub     v25.4s, v21.4s, v5.4s
+    add     v21.4s, v21.4s, v5.4s
+    sub     v26.4s, v22.4s, v7.4s
+    add     v22.4s, v22.4s, v7.4s
+    sub     v27.4s, v23.4s, v9.4s
+    add     v23.4s, v23.4s, v9.4s
+    sub     v28.4s, v24.4s, v11.4s
+    add     v24.4s, v24.4s, v11.4s
+    sub     v5.4s, v0.4s, v2.4s
+    add     v0.4s, v0.4s, v2.4s
+    sub     v2.4s, v1.4s, v3.4s
+    add     v1.4s, v1.4s, v3.4s
+    sqdmulh v3.4s, v31.4s, v17.4s[1]
+    sqdmulh v7.4s, v4.4s, v17.4s[1]
+    sqdmulh v9.4s, v23.4s, v17.4s[2]
+    sqdmulh v11.4s, v24.4s, v17.4s[2]
+    mul     v6.4s, v31.4s, v18.4s[1]
+    mul     v8.4s, v4.4s, v18.4s[1]
+    mul     v10.4s, v23.4s, v18.4s[2]
+    mul     v12.4s, v24.4s, v18.4s[2]
+    sqdmulh v6.4s, v6.4s, v16.4s[0]
+    sqdmulh v8.4s, v8.4s, v16.4s[0]
+    sqdmulh v10.4s, v10.4s, v16.4s[0]
+    sqdmulh v12.4s, v12.4s, v16.4s[0]
+    sub     v3.4s, v3.4s, v6.4s
+    sub     v7.4s, v7.4s, v8.4s
+    sub     v9.4s, v9.4s, v10.4s
+    sub     v11.4s, v11.4s, v12.4s
+    sub     v31.4s, v29.4s, v3.4s
+    add     v29.4s, v29.4s, v3.4s
+    sub     v4.4s, v30.4s, v7.4s
+    add     v30.4s, v30.4s, v7.4s
+    sub     v23.4s, v21.4s, v9.4s
+    add     v21.4s, v21.4s, v9.4s
+    sub     v24.4s, v22.4s, v11.4s
+    add     v22.4s, v22.4s, v11.4s
+    sqdmulh v3.4s, v27.4s, v17.4s[3]
+    sqdmulh v7.4s, v28.4s, v17.4s[3]
+    mul     v6.4s, v27.4s, v18.4s[3]
+    mul     v8.4s, v28.4s, v18.4s[3]
+    sqdmulh v6.4s, v6.4s, v16.4s[0]
+    sqdmulh v8.4s, v8.4s, v16.4s[0]
+    sub     v3.4s, v3.4s, v6.4s
+    sub     v7.4s, v7.4s, v8.4s
+    sub     v27.4s, v25.4s, v3.4s
+    add     v25.4s, v25.4s, v3.4s
+    sub     v28.4s, v26.4s, v7.4s
+    add     v26.4s, v26.4s, v7.4s
+    sub     v3.4s, v0.4s, v1.4s
+    add     v0.4s, v0.4s, v1.4s
+    sqdmulh v1.4s, v2.4s, v17.4s[1]
+    sqdmulh v7.4s, v30.4s, v17.4s[2]
+    sqdmulh v9.4s, v4.4s, v17.4s[3]
+    sqdmulh v11.4s, v22.4s, v19.4s[0]
+    mul     v6.4s, v2.4s, v18.4s[1]
+    mul     v8.4s, v30.4s, v18.4s[2]
+    mul     v10.4s, v4.4s, v18.4s[3]
+    mul     v12.4s, v22.4s, v20.4s[0]
+    sqdmulh v6.4s, v6.4s, v16.4s[0]
+    sqdmulh v8.4s, v8.4s, v16.4s[0]
+    sqdmulh v10.4s, v10.4s, v16.4s[0]
+    sqdmulh v12.4s, v12.4s, v16.4s[0]
+    sub     v1.4s, v1.4s, v6.4s
+    sub     v7.4s, v7.4s, v8.4s
+    sub     v9.4s, v9.4s, v10.4s
+    sub     v11.4s, v11.4s, v12.4s
+    sub     v2.4s, v5.4s, v1.4s
+    add     v5.4s, v5.4s, v1.4s
+    sub     v30.4s, v29.4s, v7.4s
+    add     v29.4s, v29.4s, v7.4s
+    sub     v4.4s, v31.4s, v9.4s
+    add     v31.4s, v31.4s, v9.4s
+    sub     v22.4s, v21.4s, v11.4s
+    add     v21.4s, v21.4s, v11.4s
+    sqdmulh v1.4s, v24.4s, v19.4s[1]
+    sqdmulh v7.4s, v26.4s, v19.4s[2]
+    sqdmulh v9.4s, v28.4s, v19.4s[3]
+    mul     v6.4s, v24.4s, v20.4s[1]
+    mul     v8.4s, v26.4s, v20.4s[2]
+    mul     v10.4s, v28.4s, v20.4s[3]
+    sqdmulh v6.4s, v6.4s, v16.4s[0]
+    sqdmulh v8.4s, v8.4s, v16.4s[0]
+    sqdmulh v10.4s, v10.4s, v16.4s[0]
+    sub     v1.4s, v1.4s, v6.4s
+    sub     v7.4s, v7.4s, v8.4s
+    sub     v9.4s, v9.4s, v10.4s
+    sub     v24.4s, v23.4s, v1.4s
+    add     v23.4s, v23.4s, v1.4s
+    sub     v26.4s, v25.4s, v7.4s
+    add     v25.4s, v25.4s, v7.4s
+    sub     v28.4s, v27.4s, v9.4s
+    add     v27.4s, v27.4s, v9.4s
+    str     q0, [start, #4 * 12]
+    str     q3, [start, #4 * 28]
+    str     q5, [start, #4 * 44]
+    str     q2, [start, #4 * 60]
+    str     q29, [start, #4 * 76]
+    str     q30, [start, #4 * 92]
+    str     q31, [start, #4 * 108]
+    str     q4, [start, #4 * 124]
+    str     q21, [start, #4 * 140]
+    str     q22, [start, #4 * 156]
+    str     q23, [start, #4 * 172]
+    str     q24, [start, #4 * 188]
+    str     q25, [start, #4 * 204]
+    str     q26, [start, #4 * 220]
+    str     q27, [start, #4 * 236]
+    str     q28, [start, #4 * 252]
+
+    add     x3, x1, #4 * 23
+    ldr     q17, [x3]
+    add     x4, x2, #4 * 23
+    ldr     q18, [x4]
+    add     x3, x1, #4 * 27
+    ldr     q19, [x3]
+    add     x4, x2, #4 * 27
+    ldr     q20, [x4]
+    add     x3, x1, #4 * 11
+    ldr     q21, [x3]
+    add     x4, x2, #4 * 11
+    ldr     q22, [x4]
+    add     x3, x1, #4 * 5
+    ldr     d23, [x3]
+    add     x4, x2, #4 * 5
+    ldr     d24, [x4]
+    ldr     s25, [x1, #4 * 2]
+    ldr     s26, [x2, #4 * 2]
+    ldr     q0, [start, #4 * 256]
+    ldr     q1, [start, #4 * 272]
+    ldr     q2, [start, #4 * 288]
+    ldr     q3, [start, #4 * 304]
+    ldr     q4, [start, #4 * 320]
+    ldr     q5, [start, #4 * 336]
+    ldr     q6, [start, #4 * 352]
+    ldr     q7, [start, #4 * 368]
+    ldr     q8, [start, #4 * 384]
+    ldr     q9, [start, #4 * 400]
+    ldr     q10, [start, #4 * 416]
+    ldr     q11, [start, #4 * 432]
+    ldr     q12, [start, #4 * 448]
+    ldr     q13, [start, #4 * 464]
+    ldr     q14, [start, #4 * 480]
+    ldr     q15, [start, #4 * 496]
+    sqdmulh v27.4s, v8.4s, v25.4s[0]
+    sqdmulh v29.4s, v9.4s, v25.4s[0]
+    mul     v28.4s, v8.4s, v26.4s[0]
+    mul     v30.4s, v9.4s, v26.4s[0]
+    sqdmulh v28.4s, v28.4s, v16.4s[0]
+    sqdmulh v30.4s, v30.4s, v16.4s[0]
+    sub     v27.4s, v27.4s, v28.4s
+    sub     v29.4s, v29.4s, v30.4s
+    sub     v8.4s, v0.4s, v27.4s
+    add     v0.4s, v0.4s, v27.4s
+    sub     v9.4s, v1.4s, v29.4s
+    add     v1.4s, v1.4s, v29.4s
+    sqdmulh v27.4s, v10.4s, v25.4s[0]
+    sqdmulh v29.4s, v11.4s, v25.4s[0]
+    mul     v28.4s, v10.4s, v26.4s[0]
+    mul     v30.4s, v11.4s, v26.4s[0]
+    sqdmulh v28.4s, v28.4s, v16.4s[0]
+    sqdmulh v30.4s, v30.4s, v16.4s[0]
+    sub     v27.4s, v27.4s, v28.4s
+    sub     v29.4s, v29.4s, v30.4s
+    sub     v10.4s, v2.4s, v27.4s
+    add     v2.4s, v2.4s, v27.4s
+    sub     v11.4s, v3.4s, v29.4s
+    add     v3.4s, v3.4s, v29.4s
+    sqdmulh v27.4s, v12.4s, v25.4s[0]
+    sqdmulh v29.4s, v13.4s, v25.4s[0]
+    mul     v28.4s, v12.4s, v26.4s[0]
+    mul     v30.4s, v13.4s, v26.4s[0]
+    sqdmulh v28.4s, v28.4s, v16.4s[0]
+    sqdmulh v30.4s, v30.4s, v16.4s[0]
+    sub     v27.4s, v27.4s, v28.4s
+    sub     v29.4s, v29.4s, v30.4s
+    sub     v12.4s, v4.4s, v27.4s
+    add     v4.4s, v4.4s, v27.4s
+    sub     v13.4s, v5.4s, v29.4s
+    add     v5.4s, v5.4s, v29.4s
+    sqdmulh v27.4s, v14.4s, v25.4s[0]
+    sqdmulh v29.4s, v15.4s, v25.4s[0]
+    mul     v28.4s, v14.4s, v26.4s[0]
+    mul     v30.4s, v15.4s, v26.4s[0]
+    sqdmulh v28.4s, v28.4s, v16.4s[0]
+    sqdmulh v30.4s, v30.4s, v16.4s[0]
+    sub     v27.4s, v27.4s, v28.4s
+    sub     v29.4s, v29.4s, v30.4s
+    sub     v14.4s, v6.4s, v27.4s
+    add     v6.4s, v6.4s, v27.4s
+    sub     v15.4s, v7.4s, v29.4s
+    add     v7.4s, v7.4s, v29.4s
+    sqdmulh v27.4s, v4.4s, v23.4s[0]
+    sqdmulh v29.4s, v5.4s, v23.4s[0]
+    mul     v28.4s, v4.4s, v24.4s[0]
+    mul     v30.4s, v5.4s, v24.4s[0]
+    sqdmulh v28.4s, v28.4s, v16.4s[0]
+    sqdmulh v30.4s, v30.4s, v16.4s[0]
+    sub     v27.4s, v27.4s, v28.4s
+    sub     v29.4s, v29.4s, v30.4s
+    sub     v4.4s, v0.4s, v27.4s
+    add     v0.4s, v0.4s, v27.4s
+    sub     v5.4s, v1.4s, v29.4s
+    add     v1.4s, v1.4s, v29.4s
+    sqdmulh v27.4s, v6.4s, v23.4s[0]
+    sqdmulh v29.4s, v7.4s, v23.4s[0]
+    mul     v28.4s, v6.4s, v24.4s[0]
+    mul     v30.4s, v7.4s, v24.4s[0]
+    sqdmulh v28.4s, v28.4s, v16.4s[0]
+    sqdmulh v30.4s, v30.4s, v16.4s[0]
+    sub     v27.4s, v27.4s, v28.4s
+    sub     v29.4s, v29.4s, v30.4s
+    sub     v6.4s, v2.4s, v27.4s
+    add     v2.4s, v2.4s, v27.4s
+    sub     v7.4s, v3.4s, v29.4s
+    add     v3.4s, v3.4s, v29.4s
+    sqdmulh v27.4s, v12.4s, v23.4s[1]
+    sqdmulh v29.4s, v13.4s, v23.4s[1]
+    mul     v28.4s, v12.4s, v24.4s[1]
+    mul     v30.4s, v13.4s, v24.4s[1]
+    sqdmulh v28.4s, v28.4s, v16.4s[0]
+    sqdmulh v30.4s, v30.4s, v16.4s[0]
+    sub     v27.4s, v27.4s, v28.4s
+    sub     v29.4s, v29.4s, v30.4s
+    sub     v12.4s, v8.4s, v27.4s
+    add     v8.4s, v8.4s, v27.4s
+    sub     v13.4s, v9.4s, v29.4s
+    add     v9.4s, v9.4s, v29.4s
+    sqdmulh v27.4s, v14.4s, v23.4s[1]
+    sqdmulh v29.4s, v15.4s, v23.4s[1]
+    mul     v28.4s, v14.4s, v24.4s[1]
+    mul     v30.4s, v15.4s, v24.4s[1]
+    sqdmulh v28.4s, v28.4s, v16.4s[0]
+    sqdmulh v30.4s, v30.4s, v16.4s[0]
+    sub     v27.4s, v27.4s, v28.4s
+    sub     v29.4s, v29.4s, v30.4s
+    sub     v14.4s, v10.4s, v27.4s
+    add     v10.4s, v10.4s, v27.4s
+    sub     v15.4s, v11.4s, v29.4s
+    add     v11.4s, v11.4s, v29.4s
+    sqdmulh v27.4s, v2.4s, v21.4s[0]
+    sqdmulh v29.4s, v3.4s, v21.4s[0]
+    mul     v28.4s, v2.4s, v22.4s[0]
+    mul     v30.4s, v3.4s, v22.4s[0]
+    sqdmulh v28.4s, v28.4s, v16.4s[0]
+    sqdmulh v30.4s, v30.4s, v16.4s[0]
+    sub     v27.4s, v27.4s, v28.4s
+    sub     v29.4s, v29.4s, v30.4s
+    sub     v2.4s, v0.4s, v27.4s
+    add     v0.4s, v0.4s, v27.4s
+    sub     v3.4s, v1.4s, v29.4s
+    add     v1.4s, v1.4s, v29.4s
+    sqdmulh v27.4s, v6.4s, v21.4s[1]
+    sqdmulh v29.4s, v7.4s, v21.4s[1]
+    mul     v28.4s, v6.4s, v22.4s[1]
+    mul     v30.4s, v7.4s, v22.4s[1]
+    sqdmulh v28.4s, v28.4s, v16.4s[0]
+    sqdmulh v30.4s, v30.4s, v16.4s[0]
+    sub     v27.4s, v27.4s, v28.4s
+    sub     v29.4s, v29.4s, v30.4s
+    sub     v6.4s, v4.4s, v27.4s
+    add     v4.4s, v4.4s, v27.4s
+    sub     v7.4s, v5.4s, v29.4s
+    add     v5.4s, v5.4s, v29.4s
+    sqdmulh v27.4s, v10.4s, v21.4s[2]
+    sqdmulh v29.4s, v11.4s, v21.4s[2]
+    mul     v28.4s, v10.4s, v22.4s[2]
+    mul     v30.4s, v11.4s, v22.4s[2]
+    sqdmulh v28.4s, v28.4s, v16.4s[0]
+    sqdmulh v30.4s, v30.4s, v16.4s[0]
+    sub     v27.4s, v27.4s, v28.4s
+    sub     v29.4s, v29.4s, v30.4s
+    sub     v10.4s, v8.4s, v27.4s
+    add     v8.4s, v8.4s, v27.4s
+    sub     v11.4s, v9.4s, v29.4s
+    add     v9.4s, v9.4s, v29.4s
+    sqdmulh v27.4s, v14.4s, v21.4s[3]
+    sqdmulh v29.4s, v15.4s, v21.4s[3]
+    mul     v28.4s, v14.4s, v22.4s[3]
+    mul     v30.4s, v15.4s, v22.4s[3]
+    sqdmulh v28.4s, v28.4s, v16.4s[0]
+    sqdmulh v30.4s, v30.4s, v16.4s[0]
+    sub     v27.4s, v27.4s, v28.4s
+    sub     v29.4s, v29.4s, v30.4s
+    sub     v14.4s, v12.4s, v27.4s
+    add     v12.4s, v12.4s, v27.4s
+    sub     v15.4s, v13.4s, v29.4s
+    add     v13.4s, v13.4s, v29.4s
+    sqdmulh v27.4s, v1.4s, v17.4s[0]
+    sqdmulh v29.4s, v3.4s, v17.4s[1]
+    mul     v28.4s, v1.4s, v18.4s[0]
+    mul     v30.4s, v3.4s, v18.4s[1]
+    sqdmulh v28.4s, v28.4s, v16.4s[0]
+    sqdmulh v30.4s, v30.4s, v16.4s[0]
+    sub     v27.4s, v27.4s, v28.4s
+    sub     v29.4s, v29.4s, v30.4s
+    sub     v1.4s, v0.4s, v27.4s
+    add     v0.4s, v0.4s, v27.4s
+    sub     v3.4s, v2.4s, v29.4s
+    add     v2.4s, v2.4s, v29.4s
+    sqdmulh v27.4s, v5.4s, v17.4s[2]
+    sqdmulh v29.4s, v7.4s, v17.4s[3]
+    mul     v28.4s, v5.4s, v18.4s[2]
+    mul     v30.4s, v7.4s, v18.4s[3]
+    sqdmulh v28.4s, v28.4s, v16.4s[0]
+    sqdmulh v30.4s, v30.4s, v16.4s[0]
+    sub     v27.4s, v27.4s, v28.4s
+    sub     v29.4s, v29.4s, v30.4s
+    sub     v5.4s, v4.4s, v27.4s
+    add     v4.4s, v4.4s, v27.4s
+    sub     v7.4s, v6.4s, v29.4s
+    add     v6.4s, v6.4s, v29.4s
+    sqdmulh v27.4s, v9.4s, v19.4s[0]
+    sqdmulh v29.4s, v11.4s, v19.4s[1]
+    mul     v28.4s, v9.4s, v20.4s[0]
+    mul     v30.4s, v11.4s, v20.4s[1]
+    sqdmulh v28.4s, v28.4s, v16.4s[0]
+    sqdmulh v30.4s, v30.4s, v16.4s[0]
+    sub     v27.4s, v27.4s, v28.4s
+    sub     v29.4s, v29.4s, v30.4s
+    sub     v9.4s, v8.4s, v27.4s
+    add     v8.4s, v8.4s, v27.4s
+    sub     v11.4s, v10.4s, v29.4s
+    add     v10.4s, v10.4s, v29.4s
+    sqdmulh v27.4s, v13.4s, v19.4s[2]
+    sqdmulh v29.4s, v15.4s, v19.4s[3]
+    mul     v28.4s, v13.4s, v20.4s[2]
+    mul     v30.4s, v15.4s, v20.4s[3]
+    sqdmulh v28.4s, v28.4s, v16.4s[0]
+    sqdmulh v30.4s, v30.4s, v16.4s[0]
+    sub     v27.4s, v27.4s, v28.4s
+    sub     v29.4s, v29.4s, v30.4s
+    sub     v13.4s, v12.4s, v27.4s
+    add     v12.4s, v12.4s, v27.4s
+    sub     v15.4s, v14.4s, v29.4s
+    add     v14.4s, v14.4s, v29.4s
+    str     q0, [start, #4 * 256]
+    str     q1, [start, #4 * 272]
+    str     q2, [start, #4 * 288]
+    str     q3, [start, #4 * 304]
+    str     q4, [start, #4 * 320]
+    str     q5, [start, #4 * 336]
+    str     q6, [start, #4 * 352]
+    str     q7, [start, #4 * 368]
+    str     q8, [start, #4 * 384]
+    str     q9, [start, #4 * 400]
+    str     q10, [start, #4 * 416]
+    str     q11, [start, #4 * 432]
+    str     q12, [start, #4 * 448]
+    str     q13, [start, #4 * 464]
+    str     q14, [start, #4 * 480]
+    str     q15, [start, #4 * 496]
+
+    ldr     q0, [start, #4 * 260]
+    ldr     q1, [start, #4 * 276]
+    ldr     q2, [start, #4 * 292]
+    ldr     q3, [start, #4 * 308]
+    ldr     q4, [start, #4 * 324]
+    ldr     q5, [start, #4 * 340]
+    ldr     q6, [start, #4 * 356]
+    ldr     q7, [start, #4 * 372]
+    ldr     q8, [start, #4 * 388]
+    ldr     q9, [start, #4 * 404]
+    ldr     q10, [start, #4 * 420]
+    ldr     q11, [start, #4 * 436]
+    ldr     q12, [start, #4 * 452]
+    ldr     q13, [start, #4 * 468]
+    ldr     q14, [start, #4 * 484]
+    ldr     q15, [start, #4 * 500]
+    sqdmulh v27.4s, v8.4s, v25.4s[0]
+    sqdmulh v29.4s, v9.4s, v25.4s[0]
+    mul     v28.4s, v8.4s, v26.4s[0]
+    mul     v30.4s, v9.4s, v26.4s[0]
+    sqdmulh v28.4s, v28.4s, v16.4s[0]
+    sqdmulh v30.4s, v30.4s, v16.4s[0]
+    sub     v27.4s, v27.4s, v28.4s
+    sub     v29.4s, v29.4s, v30.4s
+    sub     v8.4s, v0.4s, v27.4s
+    add     v0.4s, v0.4s, v27.4s
+    sub     v9.4s, v1.4s, v29.4s
+    add     v1.4s, v1.4s, v29.4s
+    sqdmulh v27.4s, v10.4s, v25.4s[0]
+    sqdmulh v29.4s, v11.4s, v25.4s[0]
+    mul     v28.4s, v10.4s, v26.4s[0]
+    mul     v30.4s, v11.4s, v26.4s[0]
+    sqdmulh v28.4s, v28.4s, v16.4s[0]
+    sqdmulh v30.4s, v30.4s, v16.4s[0]
+    sub     v27.4s, v27.4s, v28.4s
+    sub     v29.4s, v29.4s, v30.4s
+    sub     v10.4s, v2.4s, v27.4s
+    add     v2.4s, v2.4s, v27.4s
+    sub     v11.4s, v3.4s, v29.4s
+    add     v3.4s, v3.4s, v29.4s
+    sqdmulh v27.4s, v12.4s, v25.4s[0]
+    sqdmulh v29.4s, v13.4s, v25.4s[0]
+    mul     v28.4s, v12.4s, v26.4s[0]
+    mul     v30.4s, v13.4s, v26.4s[0]
+    sqdmulh v28.4s, v28.4s, v16.4s[0]
+    sqdmulh v30.4s, v30.4s, v16.4s[0]
+    sub     v27.4s, v27.4s, v28.4s
+    sub     v29.4s, v29.4s, v30.4s
+    sub     v12.4s, v4.4s, v27.4s
+    add     v4.4s, v4.4s, v27.4s
+    sub     v13.4s, v5.4s, v29.4s
+    add     v5.4s, v5.4s, v29.4s
+    sqdmulh v27.4s, v14.4s, v25.4s[0]
+    sqdmulh v29.4s, v15.4s, v25.4s[0]
+    mul     v28.4s, v14.4s, v26.4s[0]
+    mul     v30.4s, v15.4s, v26.4s[0]
+    sqdmulh v28.4s, v28.4s, v16.4s[0]
+    sqdmulh v30.4s, v30.4s, v16.4s[0]
+    sub     v27.4s, v27.4s, v28.4s
+    sub     v29.4s, v29.4s, v30.4s
+    sub     v14.4s, v6.4s, v27.4s
+    add     v6.4s, v6.4s, v27.4s
+    sub     v15.4s, v7.4s, v29.4s
+    add     v7.4s, v7.4s, v29.4s
+    sqdmulh v27.4s, v4.4s, v23.4s[0]
+    sqdmulh v29.4s, v5.4s, v23.4s[0]
+    mul     v28.4s, v4.4s, v24.4s[0]
+    mul     v30.4s, v5.4s, v24.4s[0]
+    sqdmulh v28.4s, v28.4s, v16.4s[0]
+    sqdmulh v30.4s, v30.4s, v16.4s[0]
+    sub     v27.4s, v27.4s, v28.4s
+    sub     v29.4s, v29.4s, v30.4s
+    sub     v4.4s, v0.4s, v27.4s
+    add     v0.4s, v0.4s, v27.4s
+    sub     v5.4s, v1.4s, v29.4s
+    add     v1.4s, v1.4s, v29.4s
+    sqdmulh v27.4s, v6.4s, v23.4s[0]
+    sqdmulh v29.4s, v7.4s, v23.4s[0]
+    mul     v28.4s, v6.4s, v24.4s[0]
+    mul     v30.4s, v7.4s, v24.4s[0]
+    sqdmulh v28.4s, v28.4s, v16.4s[0]
+    sqdmulh v30.4s, v30.4s, v16.4s[0]
+    sub     v27.4s, v27.4s, v28.4s
+    sub     v29.4s, v29.4s, v30.4s
+    sub     v6.4s, v2.4s, v27.4s
+    add     v2.4s, v2.4s, v27.4s
+    sub     v7.4s, v3.4s, v29.4s
+    add     v3.4s, v3.4s, v29.4s
+    sqdmulh v27.4s, v12.4s, v23.4s[1]
+    sqdmulh v29.4s, v13.4s, v23.4s[1]
+    mul     v28.4s, v12.4s, v24.4s[1]
+    mul     v30.4s, v13.4s, v24.4s[1]
+    sqdmulh v28.4s, v28.4s, v16.4s[0]
+    sqdmulh v30.4s, v30.4s, v16.4s[0]
+    sub     v27.4s, v27.4s, v28.4s
+    sub     v29.4s, v29.4s, v30.4s
+    sub     v12.4s, v8.4s, v27.4s
+    add     v8.4s, v8.4s, v27.4s
+    sub     v13.4s, v9.4s, v29.4s
+    add     v9.4s, v9.4s, v29.4s
+    sqdmulh v27.4s, v14.4s, v23.4s[1]
+    sqdmulh v29.4s, v15.4s, v23.4s[1]
+    mul     v28.4s, v14.4s, v24.4s[1]
+    mul     v30.4s, v15.4s, v24.4s[1]
+    sqdmulh v28.4s, v28.4s, v16.4s[0]
+    sqdmulh v30.4s, v30.4s, v16.4s[0]
+    sub     v27.4s, v27.4s, v28.4s
+    sub     v29.4s, v29.4s, v30.4s
+    sub     v14.4s, v10.4s, v27.4s
+    add     v10.4s, v10.4s, v27.4s
+    sub     v15.4s, v11.4s, v29.4s
+    add     v11.4s, v11.4s, v29.4s
+    sqdmulh v27.4s, v2.4s, v21.4s[0]
+    sqdmulh v29.4s, v3.4s, v21.4s[0]
+    mul     v28.4s, v2.4s, v22.4s[0]
+    mul     v30.4s, v3.4s, v22.4s[0]
+    sqdmulh v28.4s, v28.4s, v16.4s[0]
+    sqdmulh v30.4s, v30.4s, v16.4s[0]
+    sub     v27.4s, v27.4s, v28.4s
+    sub     v29.4s, v29.4s, v30.4s
+    sub     v2.4s, v0.4s, v27.4s
+    add     v0.4s, v0.4s, v27.4s
+    sub     v3.4s, v1.4s, v29.4s
+    add     v1.4s, v1.4s, v29.4s
+    sqdmulh v27.4s, v6.4s, v21.4s[1]
+    sqdmulh v29.4s, v7.4s, v21.4s[1]
+    mul     v28.4s, v6.4s, v22.4s[1]
+    mul     v30.4s, v7.4s, v22.4s[1]
+    sqdmulh v28.4s, v28.4s, v16.4s[0]
+    sqdmulh v30.4s, v30.4s, v16.4s[0]
+    sub     v27.4s, v27.4s, v28.4s
+    sub     v29.4s, v29.4s, v30.4s
+    sub     v6.4s, v4.4s, v27.4s
+    add     v4.4s, v4.4s, v27.4s
+    sub     v7.4s, v5.4s, v29.4s
+    add     v5.4s, v5.4s, v29.4s
+    sqdmulh v27.4s, v10.4s, v21.4s[2]
+    sqdmulh v29.4s, v11.4s, v21.4s[2]
+    mul     v28.4s, v10.4s, v22.4s[2]
+    mul     v30.4s, v11.4s, v22.4s[2]
+    sqdmulh v28.4s, v28.4s, v16.4s[0]
+    sqdmulh v30.4s, v30.4s, v16.4s[0]
+    sub     v27.4s, v27.4s, v28.4s
+    sub     v29.4s, v29.4s, v30.4s
+    sub     v10.4s, v8.4s, v27.4s
+    add     v8.4s, v8.4s, v27.4s
+    sub     v11.4s, v9.4s, v29.4s
+    add     v9.4s, v9.4s, v29.4s
+    sqdmulh v27.4s, v14.4s, v21.4s[3]
+    sqdmulh v29.4s, v15.4s, v21.4s[3]
+    mul     v28.4s, v14.4s, v22.4s[3]
+    mul     v30.4s, v15.4s, v22.4s[3]
+    sqdmulh v28.4s, v28.4s, v16.4s[0]
+    sqdmulh v30.4s, v30.4s, v16.4s[0]
+    sub     v27.4s, v27.4s, v28.4s
+    sub     v29.4s, v29.4s, v30.4s
+    sub     v14.4s, v12.4s, v27.4s
+    add     v12.4s, v12.4s, v27.4s
+    sub     v15.4s, v13.4s, v29.4s
+    add     v13.4s, v13.4s, v29.4s
+    sqdmulh v27.4s, v1.4s, v17.4s[0]
+    sqdmulh v29.4s, v3.4s, v17.4s[1]
+    mul     v28.4s, v1.4s, v18.4s[0]
+    mul     v30.4s, v3.4s, v18.4s[1]
+    sqdmulh v28.4s, v28.4s, v16.4s[0]
+    sqdmulh v30.4s, v30.4s, v16.4s[0]
+    sub     v27.4s, v27.4s, v28.4s
+    sub     v29.4s, v29.4s, v30.4s
+    sub     v1.4s, v0.4s, v27.4s
+    add     v0.4s, v0.4s, v27.4s
+    sub     v3.4s, v2.4s, v29.4s
+    add     v2.4s, v2.4s, v29.4s
+    sqdmulh v27.4s, v5.4s, v17.4s[2]
+    sqdmulh v29.4s, v7.4s, v17.4s[3]
+    mul     v28.4s, v5.4s, v18.4s[2]
+    mul     v30.4s, v7.4s, v18.4s[3]
+    sqdmulh v28.4s, v28.4s, v16.4s[0]
+    sqdmulh v30.4s, v30.4s, v16.4s[0]
+    sub     v27.4s, v27.4s, v28.4s
+    sub     v29.4s, v29.4s, v30.4s
+    sub     v5.4s, v4.4s, v27.4s
+    add     v4.4s, v4.4s, v27.4s
+    sub     v7.4s, v6.4s, v29.4s
+    add     v6.4s, v6.4s, v29.4s
+    sqdmulh v27.4s, v9.4s, v19.4s[0]
+    sqdmulh v29.4s, v11.4s, v19.4s[1]
+    mul     v28.4s, v9.4s, v20.4s[0]
+    mul     v30.4s, v11.4s, v20.4s[1]
+    sqdmulh v28.4s, v28.4s, v16.4s[0]
+    sqdmulh v30.4s, v30.4s, v16.4s[0]
+    sub     v27.4s, v27.4s, v28.4s
+    sub     v29.4s, v29.4s, v30.4s
+    sub     v9.4s, v8.4s, v27.4s
+    add     v8.4s, v8.4s, v27.4s
+    sub     v11.4s, v10.4s, v29.4s
+    add     v10.4s, v10.4s, v29.4s
+    sqdmulh v27.4s, v13.4s, v19.4s[2]
+    sqdmulh v29.4s, v15.4s, v19.4s[3]
+    mul     v28.4s, v13.4s, v20.4s[2]
+    mul     v30.4s, v15.4s, v20.4s[3]
+    sqdmulh v28.4s, v28.4s, v16.4s[0]
+    sqdmulh v30.4s, v30.4s, v16.4s[0]
+    sub     v27.4s, v27.4s, v28.4s
+    sub     v29.4s, v29.4s, v30.4s
+    sub     v13.4s, v12.4s, v27.4s
+    add     v12.4s, v12.4s, v27.4s
+    sub     v15.4s, v14.4s, v29.4s
+    add     v14.4s, v14.4s, v29.4s
+    str     q0, [start, #4 * 260]
+    str     q1, [start, #4 * 276]
+    str     q2, [start, #4 * 292]
+    str     q3, [start, #4 * 308]
+    str     q4, [start, #4 * 324]
+    str     q5, [start, #4 * 340]
+    str     q6, [start, #4 * 356]
+    str     q7, [start, #4 * 372]
+    str     q8, [start, #4 * 388]
+    str     q9, [start, #4 * 404]
+    str     q10, [start, #4 * 420]
+    str     q11, [start, #4 * 436]
+    str     q12, [start, #4 * 452]
+    str     q13, [start, #4 * 468]
+    str     q14, [start, #4 * 484]
+    str     q15, [start, #4 * 500]
+
+    ldr     q0, [start, #4 * 264]
+    ldr     q1, [start, #4 * 280]
+    ldr     q2, [start, #4 * 296]
+    ldr     q3, [start, #4 * 312]
+    ldr     q4, [start, #4 * 328]
+    ldr     q5, [start, #4 * 344]
+    ldr     q6, [start, #4 * 360]
+    ldr     q7, [start, #4 * 376]
+    ldr     q8, [start, #4 * 392]
+    ldr     q9, [start, #4 * 408]
+    ldr     q10, [start, #4 * 424]
+    ldr     q11, [start, #4 * 440]
+    ldr     q12, [start, #4 * 456]
+    ldr     q13, [start, #4 * 472]
+    ldr     q14, [start, #4 * 488]
+    ldr     q15, [start, #4 * 504]
+    sqdmulh v27.4s, v8.4s, v25.4s[0]
+    sqdmulh v29.4s, v9.4s, v25.4s[0]
+    mul     v28.4s, v8.4s, v26.4s[0]
+    mul     v30.4s, v9.4s, v26.4s[0]
+    sqdmulh v28.4s, v28.4s, v16.4s[0]
+    sqdmulh v30.4s, v30.4s, v16.4s[0]
+    sub     v27.4s, v27.4s, v28.4s
+    sub     v29.4s, v29.4s, v30.4s
+    sub     v8.4s, v0.4s, v27.4s
+    add     v0.4s, v0.4s, v27.4s
+    sub     v9.4s, v1.4s, v29.4s
+    add     v1.4s, v1.4s, v29.4s
+    sqdmulh v27.4s, v10.4s, v25.4s[0]
+    sqdmulh v29.4s, v11.4s, v25.4s[0]
+    mul     v28.4s, v10.4s, v26.4s[0]
+    mul     v30.4s, v11.4s, v26.4s[0]
+    sqdmulh v28.4s, v28.4s, v16.4s[0]
+    sqdmulh v30.4s, v30.4s, v16.4s[0]
+    sub     v27.4s, v27.4s, v28.4s
+    sub     v29.4s, v29.4s, v30.4s
+    sub     v10.4s, v2.4s, v27.4s
+    add     v2.4s, v2.4s, v27.4s
+    sub     v11.4s, v3.4s, v29.4s
+    add     v3.4s, v3.4s, v29.4s
+    sqdmulh v27.4s, v12.4s, v25.4s[0]
+    sqdmulh v29.4s, v13.4s, v25.4s[0]
+    mul     v28.4s, v12.4s, v26.4s[0]
+    mul     v30.4s, v13.4s, v26.4s[0]
+    sqdmulh v28.4s, v28.4s, v16.4s[0]
+    sqdmulh v30.4s, v30.4s, v16.4s[0]
+    sub     v27.4s, v27.4s, v28.4s
+    sub     v29.4s, v29.4s, v30.4s
+    sub     v12.4s, v4.4s, v27.4s
+    add     v4.4s, v4.4s, v27.4s
+    sub     v13.4s, v5.4s, v29.4s
+    add     v5.4s, v5.4s, v29.4s
+    sqdmulh v27.4s, v14.4s, v25.4s[0]
+    sqdmulh v29.4s, v15.4s, v25.4s[0]
+    mul     v28.4s, v14.4s, v26.4s[0]
+    mul     v30.4s, v15.4s, v26.4s[0]
+    sqdmulh v28.4s, v28.4s, v16.4s[0]
+    sqdmulh v30.4s, v30.4s, v16.4s[0]
+    sub     v27.4s, v27.4s, v28.4s
+    sub     v29.4s, v29.4s, v30.4s
+    sub     v14.4s, v6.4s, v27.4s
+    add     v6.4s, v6.4s, v27.4s
+    sub     v15.4s, v7.4s, v29.4s
+    add     v7.4s, v7.4s, v29.4s
+    sqdmulh v27.4s, v4.4s, v23.4s[0]
+    sqdmulh v29.4s, v5.4s, v23.4s[0]
+    mul     v28.4s, v4.4s, v24.4s[0]
+    mul     v30.4s, v5.4s, v24.4s[0]
+    sqdmulh v28.4s, v28.4s, v16.4s[0]
+    sqdmulh v30.4s, v30.4s, v16.4s[0]
+    sub     v27.4s, v27.4s, v28.4s
+    sub     v29.4s, v29.4s, v30.4s
+    sub     v4.4s, v0.4s, v27.4s
+    add     v0.4s, v0.4s, v27.4s
+    sub     v5.4s, v1.4s, v29.4s
+    add     v1.4s, v1.4s, v29.4s
+    sqdmulh v27.4s, v6.4s, v23.4s[0]
+    sqdmulh v29.4s, v7.4s, v23.4s[0]
+    mul     v28.4s, v6.4s, v24.4s[0]
+    mul     v30.4s, v7.4s, v24.4s[0]
+    sqdmulh v28.4s, v28.4s, v16.4s[0]
+    sqdmulh v30.4s, v30.4s, v16.4s[0]
+    sub     v27.4s, v27.4s, v28.4s
+    sub     v29.4s, v29.4s, v30.4s
+    sub     v6.4s, v2.4s, v27.4s
+    add     v2.4s, v2.4s, v27.4s
+    sub     v7.4s, v3.4s, v29.4s
+    add     v3.4s, v3.4s, v29.4s
+    sqdmulh v27.4s, v12.4s, v23.4s[1]
+    sqdmulh v29.4s, v13.4s, v23.4s[1]
+    mul     v28.4s, v12.4s, v24.4s[1]
+    mul     v30.4s, v13.4s, v24.4s[1]
+    sqdmulh v28.4s, v28.4s, v16.4s[0]
+    sqdmulh v30.4s, v30.4s, v16.4s[0]
+    sub     v27.4s, v27.4s, v28.4s
+    sub     v29.4s, v29.4s, v30.4s
+    sub     v12.4s, v8.4s, v27.4s
+    add     v8.4s, v8.4s, v27.4s
+    sub     v13.4s, v9.4s, v29.4s
+    add     v9.4s, v9.4s, v29.4s
+    sqdmulh v27.4s, v14.4s, v23.4s[1]
+    sqdmulh v29.4s, v15.4s, v23.4s[1]
+    mul     v28.4s, v14.4s, v24.4s[1]
+    mul     v30.4s, v15.4s, v24.4s[1]
+    sqdmulh v28.4s, v28.4s, v16.4s[0]
+    sqdmulh v30.4s, v30.4s, v16.4s[0]
+    sub     v27.4s, v27.4s, v28.4s
+    sub     v29.4s, v29.4s, v30.4s
+    sub     v14.4s, v10.4s, v27.4s
+    add     v10.4s, v10.4s, v27.4s
+    sub     v15.4s, v11.4s, v29.4s
+    add     v11.4s, v11.4s, v29.4s
+    sqdmulh v27.4s, v2.4s, v21.4s[0]
+    sqdmulh v29.4s, v3.4s, v21.4s[0]
+    mul     v28.4s, v2.4s, v22.4s[0]
+    mul     v30.4s, v3.4s, v22.4s[0]
+    sqdmulh v28.4s, v28.4s, v16.4s[0]
+    sqdmulh v30.4s, v30.4s, v16.4s[0]
+    sub     v27.4s, v27.4s, v28.4s
+    sub     v29.4s, v29.4s, v30.4s
+    sub     v2.4s, v0.4s, v27.4s
+    add     v0.4s, v0.4s, v27.4s
+    sub     v3.4s, v1.4s, v29.4s
+    add     v1.4s, v1.4s, v29.4s
+    sqdmulh v27.4s, v6.4s, v21.4s[1]
+    sqdmulh v29.4s, v7.4s, v21.4s[1]
+    mul     v28.4s, v6.4s, v22.4s[1]
+    mul     v30.4s, v7.4s, v22.4s[1]
+    sqdmulh v28.4s, v28.4s, v16.4s[0]
+    sqdmulh v30.4s, v30.4s, v16.4s[0]
+    sub     v27.4s, v27.4s, v28.4s
+    sub     v29.4s, v29.4s, v30.4s
+    sub     v6.4s, v4.4s, v27.4s
+    add     v4.4s, v4.4s, v27.4s
+    sub     v7.4s, v5.4s, v29.4s
+    add     v5.4s, v5.4s, v29.4s
+    sqdmulh v27.4s, v10.4s, v21.4s[2]
+    sqdmulh v29.4s, v11.4s, v21.4s[2]
+    mul     v28.4s, v10.4s, v22.4s[2]
+    mul     v30.4s, v11.4s, v22.4s[2]
+    sqdmulh v28.4s, v28.4s, v16.4s[0]
+    sqdmulh v30.4s, v30.4s, v16.4s[0]
+    sub     v27.4s, v27.4s, v28.4s
+    sub     v29.4s, v29.4s, v30.4s
+    sub     v10.4s, v8.4s, v27.4s
+    add     v8.4s, v8.4s, v27.4s
+    sub     v11.4s, v9.4s, v29.4s
+    add     v9.4s, v9.4s, v29.4s
+    sqdmulh v27.4s, v14.4s, v21.4s[3]
+    sqdmulh v29.4s, v15.4s, v21.4s[3]
+    mul     v28.4s, v14.4s, v22.4s[3]
+    mul     v30.4s, v15.4s, v22.4s[3]
+    sqdmulh v28.4s, v28.4s, v16.4s[0]
+    sqdmulh v30.4s, v30.4s, v16.4s[0]
+    sub     v27.4s, v27.4s, v28.4s
+    sub     v29.4s, v29.4s, v30.4s
+    sub     v14.4s, v12.4s, v27.4s
+    add     v12.4s, v12.4s, v27.4s
+    sub     v15.4s, v13.4s, v29.4s
+    add     v13.4s, v13.4s, v29.4s
+    sqdmulh v27.4s, v1.4s, v17.4s[0]
+    sqdmulh v29.4s, v3.4s, v17.4s[1]
+    mul     v28.4s, v1.4s, v18.4s[0]
+    mul     v30.4s, v3.4s, v18.4s[1]
+    sqdmulh v28.4s, v28.4s, v16.4s[0]
+    sqdmulh v30.4s, v30.4s, v16.4s[0]
+    sub     v27.4s, v27.4s, v28.4s
+    sub     v29.4s, v29.4s, v30.4s
+    sub     v1.4s, v0.4s, v27.4s
+    add     v0.4s, v0.4s, v27.4s
+    sub     v3.4s, v2.4s, v29.4s
+    add     v2.4s, v2.4s, v29.4s
+    sqdmulh v27.4s, v5.4s, v17.4s[2]
+    sqdmulh v29.4s, v7.4s, v17.4s[3]
+    mul     v28.4s, v5.4s, v18.4s[2]
+    mul     v30.4s, v7.4s, v18.4s[3]
+    sqdmulh v28.4s, v28.4s, v16.4s[0]
+    sqdmulh v30.4s, v30.4s, v16.4s[0]
+    sub     v27.4s, v27.4s, v28.4s
+    sub     v29.4s, v29.4s, v30.4s
+    sub     v5.4s, v4.4s, v27.4s
+    add     v4.4s, v4.4s, v27.4s
+    sub     v7.4s, v6.4s, v29.4s
+    add     v6.4s, v6.4s, v29.4s
+    sqdmulh v27.4s, v9.4s, v19.4s[0]
+    sqdmulh v29.4s, v11.4s, v19.4s[1]
+    mul     v28.4s, v9.4s, v20.4s[0]
+    mul     v30.4s, v11.4s, v20.4s[1]
+    sqdmulh v28.4s, v28.4s, v16.4s[0]
+    sqdmulh v30.4s, v30.4s, v16.4s[0]
+    sub     v27.4s, v27.4s, v28.4s
+    sub     v29.4s, v29.4s, v30.4s
+    sub     v9.4s, v8.4s, v27.4s
+    add     v8.4s, v8.4s, v27.4s
+    sub     v11.4s, v10.4s, v29.4s
+    add     v10.4s, v10.4s, v29.4s
+    sqdmulh v27.4s, v13.4s, v19.4s[2]
+    sqdmulh v29.4s, v15.4s, v19.4s[3]
+    mul     v28.4s, v13.4s, v20.4s[2]
+    mul     v30.4s, v15.4s, v20.4s[3]
+    sqdmulh v28.4s, v28.4s, v16.4s[0]
+    sqdmulh v30.4s, v30.4s, v16.4s[0]
+    sub     v27.4s, v27.4s, v28.4s
+    sub     v29.4s, v29.4s, v30.4s
+    sub     v13.4s, v12.4s, v27.4s
+    add     v12.4s, v12.4s, v27.4s
+    sub     v15.4s, v14.4s, v29.4s
+    add     v14.4s, v14.4s, v29.4s
+    str     q0, [start, #4 * 264]
+    str     q1, [start, #4 * 280]
+    str     q2, [start, #4 * 296]
+    str     q3, [start, #4 * 312]
+    str     q4, [start, #4 * 328]
+    str     q5, [start, #4 * 344]
+    str     q6, [start, #4 * 360]
+    str     q7, [start, #4 * 376]
+    str     q8, [start, #4 * 392]
+    str     q9, [start, #4 * 408]
+    str     q10, [start, #4 * 424]
+    str     q11, [start, #4 * 440]
+    str     q12, [start, #4 * 456]
+    str     q13, [start, #4 * 472]
+    str     q14, [start, #4 * 488]
+    str     q15, [start, #4 * 504]
+
+    ldr     q0, [start, #4 * 268]
+    ldr     q1, [start, #4 * 284]
+    ldr     q2, [start, #4 * 300]
+    ldr     q3, [start, #4 * 316]
+    ldr     q4, [start, #4 * 332]
+    ldr     q5, [start, #4 * 348]
+    ldr     q6, [start, #4 * 364]
+    ldr     q7, [start, #4 * 380]
+    ldr     q8, [start, #4 * 396]
+    ldr     q9, [start, #4 * 412]
+    ldr     q10, [start, #4 * 428]
+    ldr     q11, [start, #4 * 444]
+    ldr     q12, [start, #4 * 460]
+    ldr     q13, [start, #4 * 476]
+    ldr     q14, [start, #4 * 492]
+    ldr     q15, [start, #4 * 508]
+    sqdmulh v27.4s, v8.4s, v25.4s[0]
+    sqdmulh v29.4s, v9.4s, v25.4s[0]
+    mul     v28.4s, v8.4s, v26.4s[0]
+    mul     v30.4s, v9.4s, v26.4s[0]
+    sqdmulh v28.4s, v28.4s, v16.4s[0]
+    sqdmulh v30.4s, v30.4s, v16.4s[0]
+    sub     v27.4s, v27.4s, v28.4s
+    sub     v29.4s, v29.4s, v30.4s
+    sub     v8.4s, v0.4s, v27.4s
+    add     v0.4s, v0.4s, v27.4s
+    sub     v9.4s, v1.4s, v29.4s
+    add     v1.4s, v1.4s, v29.4s
+    sqdmulh v27.4s, v10.4s, v25.4s[0]
+    sqdmulh v29.4s, v11.4s, v25.4s[0]
+    mul     v28.4s, v10.4s, v26.4s[0]
+    mul     v30.4s, v11.4s, v26.4s[0]
+    sqdmulh v28.4s, v28.4s, v16.4s[0]
+    sqdmulh v30.4s, v30.4s, v16.4s[0]
+    sub     v27.4s, v27.4s, v28.4s
+    sub     v29.4s, v29.4s, v30.4s
+    sub     v10.4s, v2.4s, v27.4s
+    add     v2.4s, v2.4s, v27.4s
+    sub     v11.4s, v3.4s, v29.4s
+    add     v3.4s, v3.4s, v29.4s
+    sqdmulh v27.4s, v12.4s, v25.4s[0]
+    sqdmulh v29.4s, v13.4s, v25.4s[0]
+    mul     v28.4s, v12.4s, v26.4s[0]
+    mul     v30.4s, v13.4s, v26.4s[0]
+    sqdmulh v28.4s, v28.4s, v16.4s[0]
+    sqdmulh v30.4s, v30.4s, v16.4s[0]
+    sub     v27.4s, v27.4s, v28.4s
+    sub     v29.4s, v29.4s, v30.4s
+    sub     v12.4s, v4.4s, v27.4s
+    add     v4.4s, v4.4s, v27.4s
+    sub     v13.4s, v5.4s, v29.4s
+    add     v5.4s, v5.4s, v29.4s
+    sqdmulh v27.4s, v14.4s, v25.4s[0]
+    sqdmulh v29.4s, v15.4s, v25.4s[0]
+    mul     v28.4s, v14.4s, v26.4s[0]
+    mul     v30.4s, v15.4s, v26.4s[0]
+    sqdmulh v28.4s, v28.4s, v16.4s[0]
+    sqdmulh v30.4s, v30.4s, v16.4s[0]
+    sub     v27.4s, v27.4s, v28.4s
+    sub     v29.4s, v29.4s, v30.4s
+    sub     v14.4s, v6.4s, v27.4s
+    add     v6.4s, v6.4s, v27.4s
+    sub     v15.4s, v7.4s, v29.4s
+    add     v7.4s, v7.4s, v29.4s
+    sqdmulh v27.4s, v4.4s, v23.4s[0]
+    sqdmulh v29.4s, v5.4s, v23.4s[0]
+    mul     v28.4s, v4.4s, v24.4s[0]
+    mul     v30.4s, v5.4s, v24.4s[0]
+    sqdmulh v28.4s, v28.4s, v16.4s[0]
+    sqdmulh v30.4s, v30.4s, v16.4s[0]
+    sub     v27.4s, v27.4s, v28.4s
+    sub     v29.4s, v29.4s, v30.4s
+    sub     v4.4s, v0.4s, v27.4s
+    add     v0.4s, v0.4s, v27.4s
+    sub     v5.4s, v1.4s, v29.4s
+    add     v1.4s, v1.4s, v29.4s
+    sqdmulh v27.4s, v6.4s, v23.4s[0]
+    sqdmulh v29.4s, v7.4s, v23.4s[0]
+    mul     v28.4s, v6.4s, v24.4s[0]
+    mul     v30.4s, v7.4s, v24.4s[0]
+    sqdmulh v28.4s, v28.4s, v16.4s[0]
+    sqdmulh v30.4s, v30.4s, v16.4s[0]
+    sub     v27.4s, v27.4s, v28.4s
+    sub     v29.4s, v29.4s, v30.4s
+    sub     v6.4s, v2.4s, v27.4s
+    add     v2.4s, v2.4s, v27.4s
+    sub     v7.4s, v3.4s, v29.4s
+    add     v3.4s, v3.4s, v29.4s
+    sqdmulh v27.4s, v12.4s, v23.4s[1]
+    sqdmulh v29.4s, v13.4s, v23.4s[1]
+    mul     v28.4s, v12.4s, v24.4s[1]
+    mul     v30.4s, v13.4s, v24.4s[1]
+    sqdmulh v28.4s, v28.4s, v16.4s[0]
+    sqdmulh v30.4s, v30.4s, v16.4s[0]
+    sub     v27.4s, v27.4s, v28.4s
+    sub     v29.4s, v29.4s, v30.4s
+    sub     v12.4s, v8.4s, v27.4s
+    add     v8.4s, v8.4s, v27.4s
+    sub     v13.4s, v9.4s, v29.4s
+    add     v9.4s, v9.4s, v29.4s
+    sqdmulh v27.4s, v14.4s, v23.4s[1]
+    sqdmulh v29.4s, v15.4s, v23.4s[1]
+    mul     v28.4s, v14.4s, v24.4s[1]
+    mul     v30.4s, v15.4s, v24.4s[1]
+    sqdmulh v28.4s, v28.4s, v16.4s[0]
+    sqdmulh v30.4s, v30.4s, v16.4s[0]
+    sub     v27.4s, v27.4s, v28.4s
+    sub     v29.4s, v29.4s, v30.4s
+    sub     v14.4s, v10.4s, v27.4s
+    add     v10.4s, v10.4s, v27.4s
+    sub     v15.4s, v11.4s, v29.4s
+    add     v11.4s, v11.4s, v29.4s
+    sqdmulh v27.4s, v2.4s, v21.4s[0]
+    sqdmulh v29.4s, v3.4s, v21.4s[0]
+    mul     v28.4s, v2.4s, v22.4s[0]
+    mul     v30.4s, v3.4s, v22.4s[0]
+    sqdmulh v28.4s, v28.4s, v16.4s[0]
+    sqdmulh v30.4s, v30.4s, v16.4s[0]
+    sub     v27.4s, v27.4s, v28.4s
+    sub     v29.4s, v29.4s, v30.4s
+    sub     v2.4s, v0.4s, v27.4s
+    add     v0.4s, v0.4s, v27.4s
+    sub     v3.4s, v1.4s, v29.4s
+    add     v1.4s, v1.4s, v29.4s
+    sqdmulh v27.4s, v6.4s, v21.4s[1]
+    sqdmulh v29.4s, v7.4s, v21.4s[1]
+    mul     v28.4s, v6.4s, v22.4s[1]
+    mul     v30.4s, v7.4s, v22.4s[1]
+    sqdmulh v28.4s, v28.4s, v16.4s[0]
+    sqdmulh v30.4s, v30.4s, v16.4s[0]
+    sub     v27.4s, v27.4s, v28.4s
+    sub     v29.4s, v29.4s, v30.4s
+    sub     v6.4s, v4.4s, v27.4s
+    add     v4.4s, v4.4s, v27.4s
+    sub     v7.4s, v5.4s, v29.4s
+    add     v5.4s, v5.4s, v29.4s
+    sqdmulh v27.4s, v10.4s, v21.4s[2]
+    sqdmulh v29.4s, v11.4s, v21.4s[2]
+    mul     v28.4s, v10.4s, v22.4s[2]
+    mul     v30.4s, v11.4s, v22.4s[2]
+    sqdmulh v28.4s, v28.4s, v16.4s[0]
+    sqdmulh v30.4s, v30.4s, v16.4s[0]
+    sub     v27.4s, v27.4s, v28.4s
+    sub     v29.4s, v29.4s, v30.4s
+    sub     v10.4s, v8.4s, v27.4s
+    add     v8.4s, v8.4s, v27.4s
+    sub     v11.4s, v9.4s, v29.4s
+    add     v9.4s, v9.4s, v29.4s
+    sqdmulh v27.4s, v14.4s, v21.4s[3]
+    sqdmulh v29.4s, v15.4s, v21.4s[3]
+    mul     v28.4s, v14.4s, v22.4s[3]
+    mul     v30.4s, v15.4s, v22.4s[3]
+    sqdmulh v28.4s, v28.4s, v16.4s[0]
+    sqdmulh v30.4s, v30.4s, v16.4s[0]
+    sub     v27.4s, v27.4s, v28.4s
+    sub     v29.4s, v29.4s, v30.4s
+    sub     v14.4s, v12.4s, v27.4s
+    add     v12.4s, v12.4s, v27.4s
+    sub     v15.4s, v13.4s, v29.4s
+    add     v13.4s, v13.4s, v29.4s
+    sqdmulh v27.4s, v1.4s, v17.4s[0]
+    sqdmulh v29.4s, v3.4s, v17.4s[1]
+    mul     v28.4s, v1.4s, v18.4s[0]
+    mul     v30.4s, v3.4s, v18.4s[1]
+    sqdmulh v28.4s, v28.4s, v16.4s[0]
+    sqdmulh v30.4s, v30.4s, v16.4s[0]
+    sub     v27.4s, v27.4s, v28.4s
+    sub     v29.4s, v29.4s, v30.4s
+    sub     v1.4s, v0.4s, v27.4s
+    add     v0.4s, v0.4s, v27.4s
+    sub     v3.4s, v2.4s, v29.4s
+    add     v2.4s, v2.4s, v29.4s
+    sqdmulh v27.4s, v5.4s, v17.4s[2]
+    sqdmulh v29.4s, v7.4s, v17.4s[3]
+    mul     v28.4s, v5.4s, v18.4s[2]
+    mul     v30.4s, v7.4s, v18.4s[3]
+    sqdmulh v28.4s, v28.4s, v16.4s[0]
+    sqdmulh v30.4s, v30.4s, v16.4s[0]
+    sub     v27.4s, v27.4s, v28.4s
+    sub     v29.4s, v29.4s, v30.4s
+    sub     v5.4s, v4.4s, v27.4s
+    add     v4.4s, v4.4s, v27.4s
+    sub     v7.4s, v6.4s, v29.4s
+    add     v6.4s, v6.4s, v29.4s
+    sqdmulh v27.4s, v9.4s, v19.4s[0]
+    sqdmulh v29.4s, v11.4s, v19.4s[1]
+    mul     v28.4s, v9.4s, v20.4s[0]
+    mul     v30.4s, v11.4s, v20.4s[1]
+    sqdmulh v28.4s, v28.4s, v16.4s[0]
+    sqdmulh v30.4s, v30.4s, v16.4s[0]
+    sub     v27.4s, v27.4s, v28.4s
+    sub     v29.4s, v29.4s, v30.4s
+    sub     v9.4s, v8.4s, v27.4s
+    add     v8.4s, v8.4s, v27.4s
+    sub     v11.4s, v10.4s, v29.4s
+    add     v10.4s, v10.4s, v29.4s
+    sqdmulh v27.4s, v13.4s, v19.4s[2]
+    sqdmulh v29.4s, v15.4s, v19.4s[3]
+    mul     v28.4s, v13.4s, v20.4s[2]
+    mul     v30.4s, v15.4s, v20.4s[3]
+    sqdmulh v28.4s, v28.4s, v16.4s[0]
+    sqdmulh v30.4s, v30.4s, v16.4s[0]
+    sub     v27.4s, v27.4s, v28.4s
+    sub     v29.4s, v29.4s, v30.4s
+    sub     v13.4s, v12.4s, v27.4s
+    add     v12.4s, v12.4s, v27.4s
+    sub     v15.4s, v14.4s, v29.4s
+    add     v14.4s, v14.4s, v29.4s
+    str     q0, [start, #4 * 268]
+    str     q1, [start, #4 * 284]
+    str     q2, [start, #4 * 300]
+    str     q3, [start, #4 * 316]
+    str     q4, [start, #4 * 332]
+    str     q5, [start, #4 * 348]
+    str     q6, [start, #4 * 364]
+    str     q7, [start, #4 * 380]
+    str     q8, [start, #4 * 396]
+    str     q9, [start, #4 * 412]
+    str     q10, [start, #4 * 428]
+    str     q11, [start, #4 * 444]
+    str     q12, [start, #4 * 460]
+    str     q13, [start, #4 * 476]
+    str     q14, [start, #4 * 492]
+    str     q15, [start, #4 * 508]
+
+
+    /* Layers 6+7+8+9 */
+    /* NTT forward layer 6: length = 8, ridx = 31, loops = 32 */
+    /* NTT forward layer 7: length = 4, ridx = 63, loops = 64 */
+    /* NTT forward layer 8: length = 2, ridx = 127, loops = 128 */
+    /* NTT forward layer 9: length = 1, ridx = 255, loops = 256 */
+
+    mov     x3, start
+    mov     x4, start
+    add     x5, x1, #4 * 31
+    add     x6, x2, #4 * 31
+    add     x7, x1, #4 * 63
+    add     x9, x2, #4 * 63
+    add     x10, x1, #4 * 127
+    add     x11, x2, #4 * 127
+    add     x12, x1, #4 * 255
+    add     x13, x2, #4 * 255
+
+    .rept 8
+
+    ld1     {v0.4s, v1.4s, v2.4s, v3.4s}, [x3], #64
+    ld1     {v4.4s, v5.4s, v6.4s, v7.4s}, [x3], #64
+    ld1     {v8.4s, v9.4s, v10.4s, v11.4s}, [x3], #64
+    ld1     {v12.4s, v13.4s, v14.4s, v15.4s}, [x3], #64
+    ldr     q17, [x5], #16
+    ldr     q18, [x6], #16
+    sqdmulh v19.4s, v2.4s, v17.4s[0]
+    sqdmulh v21.4s, v3.4s, v17.4s[0]
+    sqdmulh v23.4s, v6.4s, v17.4s[1]
+    sqdmulh v25.4s, v7.4s, v17.4s[1]
+    mul     v20.4s, v2.4s, v18.4s[0]
+    mul     v22.4s, v3.4s, v18.4s[0]
+    mul     v24.4s, v6.4s, v18.4s[1]
+    mul     v26.4s, v7.4s, v18.4s[1]
+    sqdmulh v20.4s, v20.4s, v16.4s[0]
+    sqdmulh v22.4s, v22.4s, v16.4s[0]
+    sqdmulh v24.4s, v24.4s, v16.4s[0]
+    sqdmulh v26.4s, v26.4s, v16.4s[0]
+    sub     v19.4s, v19.4s, v20.4s
+    sub     v21.4s, v21.4s, v22.4s
+    sub     v23.4s, v23.4s, v24.4s
+    sub     v25.4s, v25.4s, v26.4s
+    sub     v2.4s, v0.4s, v19.4s
+    add     v0.4s, v0.4s, v19.4s
+    sub     v3.4s, v1.4s, v21.4s
+    add     v1.4s, v1.4s, v21.4s
+    sub     v6.4s, v4.4s, v23.4s
+    add     v4.4s, v4.4s, v23.4s
+    sub     v7.4s, v5.4s, v25.4s
+    add     v5.4s, v5.4s, v25.4s
+    sqdmulh v19.4s, v10.4s, v17.4s[2]
+    sqdmulh v21.4s, v11.4s, v17.4s[2]
+    sqdmulh v23.4s, v14.4s, v17.4s[3]
+    sqdmulh v25.4s, v15.4s, v17.4s[3]
+    mul     v20.4s, v10.4s, v18.4s[2]
+    mul     v22.4s, v11.4s, v18.4s[2]
+    mul     v24.4s, v14.4s, v18.4s[3]
+    mul     v26.4s, v15.4s, v18.4s[3]
+    sqdmulh v20.4s, v20.4s, v16.4s[0]
+    sqdmulh v22.4s, v22.4s, v16.4s[0]
+    sqdmulh v24.4s, v24.4s, v16.4s[0]
+    sqdmulh v26.4s, v26.4s, v16.4s[0]
+    sub     v19.4s, v19.4s, v20.4s
+    sub     v21.4s, v21.4s, v22.4s
+    sub     v23.4s, v23.4s, v24.4s
+    sub     v25.4s, v25.4s, v26.4s
+    sub     v10.4s, v8.4s, v19.4s
+    add     v8.4s, v8.4s, v19.4s
+    sub     v11.4s, v9.4s, v21.4s
+    add     v9.4s, v9.4s, v21.4s
+    sub     v14.4s, v12.4s, v23.4s
+    add     v12.4s, v12.4s, v23.4s
+    sub     v15.4s, v13.4s, v25.4s
+    add     v13.4s, v13.4s, v25.4s
+    ldr     q17, [x7], #16
+    ldr     q18, [x7], #16
+    ldr     q19, [x9], #16
+    ldr     q20, [x9], #16
+    sqdmulh v21.4s, v1.4s, v17.4s[0]
+    sqdmulh v23.4s, v3.4s, v17.4s[1]
+    sqdmulh v25.4s, v5.4s, v17.4s[2]
+    sqdmulh v27.4s, v7.4s, v17.4s[3]
+    mul     v22.4s, v1.4s, v19.4s[0]
+    mul     v24.4s, v3.4s, v19.4s[1]
+    mul     v26.4s, v5.4s, v19.4s[2]
+    mul     v28.4s, v7.4s, v19.4s[3]
+    sqdmulh v22.4s, v22.4s, v16.4s[0]
+    sqdmulh v24.4s, v24.4s, v16.4s[0]
+    sqdmulh v26.4s, v26.4s, v16.4s[0]
+    sqdmulh v28.4s, v28.4s, v16.4s[0]
+    sub     v21.4s, v21.4s, v22.4s
+    sub     v23.4s, v23.4s, v24.4s
+    sub     v25.4s, v25.4s, v26.4s
+    sub     v27.4s, v27.4s, v28.4s
+    sub     v1.4s, v0.4s, v21.4s
+    add     v0.4s, v0.4s, v21.4s
+    sub     v3.4s, v2.4s, v23.4s
+    add     v2.4s, v2.4s, v23.4s
+    sub     v5.4s, v4.4s, v25.4s
+    add     v4.4s, v4.4s, v25.4s
+    sub     v7.4s, v6.4s, v27.4s
+    add     v6.4s, v6.4s, v27.4s
+    sqdmulh v21.4s, v9.4s, v18.4s[0]
+    sqdmulh v23.4s, v11.4s, v18.4s[1]
+    sqdmulh v25.4s, v13.4s, v18.4s[2]
+    sqdmulh v27.4s, v15.4s, v18.4s[3]
+    mul     v22.4s, v9.4s, v20.4s[0]
+    mul     v24.4s, v11.4s, v20.4s[1]
+    mul     v26.4s, v13.4s, v20.4s[2]
+    mul     v28.4s, v15.4s, v20.4s[3]
+    sqdmulh v22.4s, v22.4s, v16.4s[0]
+    sqdmulh v24.4s, v24.4s, v16.4s[0]
+    sqdmulh v26.4s, v26.4s, v16.4s[0]
+    sqdmulh v28.4s, v28.4s, v16.4s[0]
+    sub     v21.4s, v21.4s, v22.4s
+    sub     v23.4s, v23.4s, v24.4s
+    sub     v25.4s, v25.4s, v26.4s
+    sub     v27.4s, v27.4s, v28.4s
+    sub     v9.4s, v8.4s, v21.4s
+    add     v8.4s, v8.4s, v21.4s
+    sub     v11.4s, v10.4s, v23.4s
+    add     v10.4s, v10.4s, v23.4s
+    sub     v13.4s, v12.4s, v25.4s
+    add     v12.4s, v12.4s, v25.4s
+    sub     v15.4s, v14.4s, v27.4s
+    add     v14.4s, v14.4s, v27.4s
+
+    trn1    v17.4s, v0.4s, v1.4s
+    trn2    v18.4s, v0.4s, v1.4s
+    trn1    v19.4s, v2.4s, v3.4s
+    trn2    v20.4s, v2.4s, v3.4s
+    trn1    v0.2d, v17.2d, v19.2d
+    trn1    v1.2d, v18.2d, v20.2d
+    trn2    v2.2d, v17.2d, v19.2d
+    trn2    v3.2d, v18.2d, v20.2d
+    ldr     q17, [x10], #16
+    ldr     q18, [x11], #16
+    ld2     {v19.4s, v20.4s}, [x12], #32
+    ld2     {v21.4s, v22.4s}, [x13], #32
+    sqdmulh v23.4s, v2.4s, v17.4s
+    sqdmulh v25.4s, v3.4s, v17.4s
+    mul     v24.4s, v2.4s, v18.4s
+    mul     v26.4s, v3.4s, v18.4s
+    sqdmulh v24.4s, v24.4s, v16.4s[0]
+    sqdmulh v26.4s, v26.4s, v16.4s[0]
+    sub     v23.4s, v23.4s, v24.4s
+    sub     v25.4s, v25.4s, v26.4s
+    sub     v2.4s, v0.4s, v23.4s
+    add     v0.4s, v0.4s, v23.4s
+    sub     v3.4s, v1.4s, v25.4s
+    add     v1.4s, v1.4s, v25.4s
+    sqdmulh v23.4s, v1.4s, v19.4s
+    sqdmulh v25.4s, v3.4s, v20.4s
+    mul     v24.4s, v1.4s, v21.4s
+    mul     v26.4s, v3.4s, v22.4s
+    sqdmulh v24.4s, v24.4s, v16.4s[0]
+    sqdmulh v26.4s, v26.4s, v16.4s[0]
+    sub     v23.4s, v23.4s, v24.4s
+    sub     v25.4s, v25.4s, v26.4s
+    sub     v1.4s, v0.4s, v23.4s
+    add     v0.4s, v0.4s, v23.4s
+    sub     v3.4s, v2.4s, v25.4s
+    add     v2.4s, v2.4s, v25.4s
+    st4     {v0.4s, v1.4s, v2.4s, v3.4s}, [x4], #64
+
+    trn1    v17.4s, v4.4s, v5.4s
+    trn2    v18.4s, v4.4s, v5.4s
+    trn1    v19.4s, v6.4s, v7.4s
+    trn2    v20.4s, v6.4s, v7.4s
+    trn1    v4.2d, v17.2d, v19.2d
+    trn1    v5.2d, v18.2d, v20.2d
+    trn2    v6.2d, v17.2d, v19.2d
+    trn2    v7.2d, v18.2d, v20.2d
+    ldr     q17, [x10], #16
+    ldr     q18, [x11], #16
+    ld2     {v19.4s, v20.4s}, [x12], #32
+    ld2     {v21.4s, v22.4s}, [x13], #32
+    sqdmulh v23.4s, v6.4s, v17.4s
+    sqdmulh v25.4s, v7.4s, v17.4s
+    mul     v24.4s, v6.4s, v18.4s
+    mul     v26.4s, v7.4s, v18.4s
+    sqdmulh v24.4s, v24.4s, v16.4s[0]
+    sqdmulh v26.4s, v26.4s, v16.4s[0]
+    sub     v23.4s, v23.4s, v24.4s
+    sub     v25.4s, v25.4s, v26.4s
+    sub     v6.4s, v4.4s, v23.4s
+    add     v4.4s, v4.4s, v23.4s
+    sub     v7.4s, v5.4s, v25.4s
+    add     v5.4s, v5.4s, v25.4s
+    sqdmulh v23.4s, v5.4s, v19.4s
+    sqdmulh v25.4s, v7.4s, v20.4s
+    mul     v24.4s, v5.4s, v21.4s
+    mul     v26.4s, v7.4s, v22.4s
+    sqdmulh v24.4s, v24.4s, v16.4s[0]
+    sqdmulh v26.4s, v26.4s, v16.4s[0]
+    sub     v23.4s, v23.4s, v24.4s
+    sub     v25.4s, v25.4s, v26.4s
+    sub     v5.4s, v4.4s, v23.4s
+    add     v4.4s, v4.4s, v23.4s
+    sub     v7.4s, v6.4s, v25.4s
+    add     v6.4s, v6.4s, v25.4s
+    st4     {v4.4s, v5.4s, v6.4s, v7.4s}, [x4], #64
+
+    trn1    v17.4s, v8.4s, v9.4s
+    trn2    v18.4s, v8.4s, v9.4s
+    trn1    v19.4s, v10.4s, v11.4s
+    trn2    v20.4s, v10.4s, v11.4s
+    trn1    v8.2d, v17.2d, v19.2d
+    trn1    v9.2d, v18.2d, v20.2d
+    trn2    v10.2d, v17.2d, v19.2d
+    trn2    v11.2d, v18.2d, v20.2d
+    ldr     q17, [x10], #16
+    ldr     q18, [x11], #16
+    ld2     {v19.4s, v20.4s}, [x12], #32
+    ld2     {v21.4s, v22.4s}, [x13], #32
+    sqdmulh v23.4s, v10.4s, v17.4s
+    sqdmulh v25.4s, v11.4s, v17.4s
+    mul     v24.4s, v10.4s, v18.4s
+    mul     v26.4s, v11.4s, v18.4s
+    sqdmulh v24.4s, v24.4s, v16.4s[0]
+    sqdmulh v26.4s, v26.4s, v16.4s[0]
+    sub     v23.4s, v23.4s, v24.4s
+    sub     v25.4s, v25.4s, v26.4s
+    sub     v10.4s, v8.4s, v23.4s
+    add     v8.4s, v8.4s, v23.4s
+    sub     v11.4s, v9.4s, v25.4s
+    add     v9.4s, v9.4s, v25.4s
+    sqdmulh v23.4s, v9.4s, v19.4s
+    sqdmulh v25.4s, v11.4s, v20.4s
+    mul     v24.4s, v9.4s, v21.4s
+    mul     v26.4s, v11.4s, v22.4s
+    sqdmulh v24.4s, v24.4s, v16.4s[0]
+    sqdmulh v26.4s, v26.4s, v16.4s[0]
+    sub     v23.4s, v23.4s, v24.4s
+    sub     v25.4s, v25.4s, v26.4s
+    sub     v9.4s, v8.4s, v23.4s
+    add     v8.4s, v8.4s, v23.4s
+    sub     v11.4s, v10.4s, v25.4s
+    add     v10.4s, v10.4s, v25.4s
+    st4     {v8.4s, v9.4s, v10.4s, v11.4s}, [x4], #64
+
+    trn1    v17.4s, v12.4s, v13.4s
+    trn2    v18.4s, v12.4s, v13.4s
+    trn1    v19.4s, v14.4s, v15.4s
+    trn2    v20.4s, v14.4s, v15.4s
+    trn1    v12.2d, v17.2d, v19.2d
+    trn1    v13.2d, v18.2d, v20.2d
+    trn2    v14.2d, v17.2d, v19.2d
+    trn2    v15.2d, v18.2d, v20.2d
+    ldr     q17, [x10], #16
+    ldr     q18, [x11], #16
+    ld2     {v19.4s, v20.4s}, [x12], #32
+    ld2     {v21.4s, v22.4s}, [x13], #32
+    sqdmulh v23.4s, v14.4s, v17.4s
+    sqdmulh v25.4s, v15.4s, v17.4s
+    mul     v24.4s, v14.4s, v18.4s
+    mul     v26.4s, v15.4s, v18.4s
+    sqdmulh v24.4s, v24.4s, v16.4s[0]
+    sqdmulh v26.4s, v26.4s, v16.4s[0]
+    sub     v23.4s, v23.4s, v24.4s
+    sub     v25.4s, v25.4s, v26.4s
+    sub     v14.4s, v12.4s, v23.4s
+    add     v12.4s, v12.4s, v23.4s
+    sub     v15.4s, v13.4s, v25.4s
+    add     v13.4s, v13.4s, v25.4s
+    sqdmulh v23.4s, v13.4s, v19.4s
+    sqdmulh v25.4s, v15.4s, v20.4s
+    mul     v24.4s, v13.4s, v21.4s
+    mul     v26.4s, v15.4s, v22.4s
+    sqdmulh v24.4s, v24.4s, v16.4s[0]
+    sqdmulh v26.4s, v26.4s, v16.4s[0]
+    sub     v23.4s, v23.4s, v24.4s
+    sub     v25.4s, v25.4s, v26.4s
+    sub     v13.4s, v12.4s, v23.4s
+    add     v12.4s, v12.4s, v23.4s
+    sub     v15.4s, v14.4s, v25.4s
+    add     v14.4s, v14.4s, v25.4s
+    st4     {v12.4s, v13.4s, v14.4s, v15.4s}, [x4], #64
+
+    .endr
+
+    .unreq  start
+    .unreq  M
+
+    /* Restore the callee-saved registers */
+
+    ldp     d10, d11, [sp, #16]
+    ldp     d12, d13, [sp, #32]
+    ldp     d14, d15, [sp, #48]
+    ldp     d8, d9, [sp], #64
+
+    ret     lr
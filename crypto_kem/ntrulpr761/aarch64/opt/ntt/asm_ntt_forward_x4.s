@@ -0,0 +1,167 @@
+/* Switch to the text segment - this contains the program code */
+
+.text
+
+/* Provide function declarations */
+
+.global __asm_ntt_forward_x4
+.type __asm_ntt_forward_x4, %function
+
+/* Provide macro definitions */
+
+.macro sub_add lower, upper_in, upper_out
+    sub \upper_out, \lower, \upper_in
+    add \lower, \lower, \upper_in
+.endm
+
+/* Compute (a, b) = (a + b, a - b) without a temporary register, using a + b =
+ * 2a - (a - b). Any overflow of 2a cancels out in two's complement. */
+
+.macro sub_add_inplace a, b
+    sub     \b\().4s, \a\().4s, \b\().4s
+    add     \a\().4s, \a\().4s, \a\().4s
+    sub     \a\().4s, \a\().4s, \b\().4s
+.endm
+
+/* Compute 4 independent Cooley-Tukey butterflies (a, b) = (a + b · w, a - b ·
+ * w), where w is given by the lanes l0, ..., l3 of the roots B and B'. The
+ * products are computed using the same Montgomery multiplication as
+ * __asm_ntt_forward(). The instructions of the 4 butterflies are interleaved to
+ * hide their latencies. */
+
+.macro ct4 a0, b0, a1, b1, a2, b2, a3, b3, root, root_p, l0, l1, l2, l3
+    sqdmulh v24.4s, \b0\().4s, \root\().4s[\l0]
+    sqdmulh v25.4s, \b1\().4s, \root\().4s[\l1]
+    sqdmulh v26.4s, \b2\().4s, \root\().4s[\l2]
+    sqdmulh v27.4s, \b3\().4s, \root\().4s[\l3]
+
+    mul     v28.4s, \b0\().4s, \root_p\().4s[\l0]
+    mul     v29.4s, \b1\().4s, \root_p\().4s[\l1]
+    mul     v30.4s, \b2\().4s, \root_p\().4s[\l2]
+    mul     v31.4s, \b3\().4s, \root_p\().4s[\l3]
+
+    sqdmulh v28.4s, v28.4s, v6.4s[0]
+    sqdmulh v29.4s, v29.4s, v6.4s[0]
+    sqdmulh v30.4s, v30.4s, v6.4s[0]
+    sqdmulh v31.4s, v31.4s, v6.4s[0]
+
+    sub     v24.4s, v24.4s, v28.4s
+    sub     v25.4s, v25.4s, v29.4s
+    sub     v26.4s, v26.4s, v30.4s
+    sub     v27.4s, v27.4s, v31.4s
+
+    sub_add \a0\().4s, v24.4s, \b0\().4s
+    sub_add \a1\().4s, v25.4s, \b1\().4s
+    sub_add \a2\().4s, v26.4s, \b2\().4s
+    sub_add \a3\().4s, v27.4s, \b3\().4s
+.endm
+
+/* Compute the NTT layers t, t + 1 and t + 2 on 8 vectors at a time. Block j of
+ * layer t has length 2L for L = 512 >> t, and its vectors i + m · L/4 for m = 0,
+ * ..., 7 form 2 blocks of layer t + 1 and 4 blocks of layer t + 2. The roots of
+ * these blocks are B[2^(t-1) - 1 + j], B[2^t - 1 + 2j, ...] and B[2^(t+1) - 1 +
+ * 4j, ...], which are loaded into v2, v1 and v0 (and v5, v4 and v3 for B'). The
+ * root of the first block of every layer is 1, so the layer t multiplications
+ * are skipped for j = 0. */
+
+.macro ct_group t
+    .set    block, 0
+    .rept   1 << ((\t) - 1)
+
+    .set    ridx, (1 << ((\t) - 1)) - 1 + block
+    ldr     s2, [x1, #4 * ridx]
+    ldr     s5, [x2, #4 * ridx]
+
+    .set    ridx, (1 << (\t)) - 1 + 2 * block
+    add     x3, x1, #4 * ridx
+    add     x4, x2, #4 * ridx
+    ldr     d1, [x3]
+    ldr     d4, [x4]
+
+    .set    ridx, (1 << ((\t) + 1)) - 1 + 4 * block
+    add     x3, x1, #4 * ridx
+    add     x4, x2, #4 * ridx
+    ldr     q0, [x3]
+    ldr     q3, [x4]
+
+    .set    index, 0
+    .rept   (512 >> (\t)) / 4
+
+    .set    offset, 16 * (2 * (512 >> (\t)) * block + index)
+    .set    step, 16 * ((512 >> (\t)) / 4)
+    ldr     q16, [start, #offset + 0 * step]
+    ldr     q17, [start, #offset + 1 * step]
+    ldr     q18, [start, #offset + 2 * step]
+    ldr     q19, [start, #offset + 3 * step]
+    ldr     q20, [start, #offset + 4 * step]
+    ldr     q21, [start, #offset + 5 * step]
+    ldr     q22, [start, #offset + 6 * step]
+    ldr     q23, [start, #offset + 7 * step]
+
+    .if block == 0
+    sub_add_inplace v16, v20
+    sub_add_inplace v17, v21
+    sub_add_inplace v18, v22
+    sub_add_inplace v19, v23
+    .else
+    ct4     v16, v20, v17, v21, v18, v22, v19, v23, v2, v5, 0, 0, 0, 0
+    .endif
+
+    ct4     v16, v18, v17, v19, v20, v22, v21, v23, v1, v4, 0, 0, 1, 1
+    ct4     v16, v17, v18, v19, v20, v21, v22, v23, v0, v3, 0, 1, 2, 3
+
+    str     q16, [start, #offset + 0 * step]
+    str     q17, [start, #offset + 1 * step]
+    str     q18, [start, #offset + 2 * step]
+    str     q19, [start, #offset + 3 * step]
+    str     q20, [start, #offset + 4 * step]
+    str     q21, [start, #offset + 5 * step]
+    str     q22, [start, #offset + 6 * step]
+    str     q23, [start, #offset + 7 * step]
+
+    .set    index, index + 1
+    .endr
+
+    .set    block, block + 1
+    .endr
+.endm
+
+__asm_ntt_forward_x4:
+
+    /* Due to our choice of registers we do not need (to store) callee-saved
+     * registers. Neither do we use the procedure link register, as we do not
+     * branch to any functions from within this subroutine. The function
+     * prologue is therefore empty. */
+
+    /* Alias registers for a specific purpose (and readability) */
+
+    start   .req x0     // Store pointer to the first integer coefficient
+    M       .req w5     // Store the constant value M = 6984193
+
+    /* Initialize constant values */
+
+    mov     M, #0x9201              // 6984193 (= M)
+    movk    M, #0x6a, lsl #16
+    mov     v6.4s[0], M
+
+    /* The 4 polynomials are interleaved, i.e. lane k of vector i holds the
+     * integer coefficient i of polynomial k. Every butterfly therefore operates
+     * on whole vectors using a single root, and none of the layers needs to
+     * shuffle integer coefficients between lanes. */
+
+    /* Layers 1+2+3: length = 256, 128, 64 */
+
+    ct_group 1
+
+    /* Layers 4+5+6: length = 32, 16, 8 */
+
+    ct_group 4
+
+    /* Layers 7+8+9: length = 4, 2, 1 */
+
+    ct_group 7
+
+    .unreq  start
+    .unreq  M
+
+    ret     lr
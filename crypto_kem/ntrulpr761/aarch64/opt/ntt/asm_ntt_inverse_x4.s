@@ -0,0 +1,235 @@
+/* Switch to the text segment - this contains the program code */
+
+.text
+
+/* Provide function declarations */
+
+.global __asm_ntt_inverse_x4
+.type __asm_ntt_inverse_x4, %function
+
+/* Provide macro definitions */
+
+/* Compute (a, b) = (a + b, a - b) without a temporary register, using a + b =
+ * 2a - (a - b). Any overflow of 2a cancels out in two's complement. */
+
+.macro sub_add_inplace a, b
+    sub     \b\().4s, \a\().4s, \b\().4s
+    add     \a\().4s, \a\().4s, \a\().4s
+    sub     \a\().4s, \a\().4s, \b\().4s
+.endm
+
+/* Compute 4 independent Gentleman-Sande butterflies (a, b) = (a + b, (a - b) ·
+ * w), where w is given by the lanes l0, ..., l3 of the roots B and B'. The
+ * products are computed using the same Montgomery multiplication as
+ * __asm_ntt_inverse(). The instructions of the 4 butterflies are interleaved to
+ * hide their latencies. */
+
+.macro gs4 a0, b0, a1, b1, a2, b2, a3, b3, root, root_p, l0, l1, l2, l3
+    sub     v24.4s, \a0\().4s, \b0\().4s
+    sub     v25.4s, \a1\().4s, \b1\().4s
+    sub     v26.4s, \a2\().4s, \b2\().4s
+    sub     v27.4s, \a3\().4s, \b3\().4s
+
+    add     \a0\().4s, \a0\().4s, \b0\().4s
+    add     \a1\().4s, \a1\().4s, \b1\().4s
+    add     \a2\().4s, \a2\().4s, \b2\().4s
+    add     \a3\().4s, \a3\().4s, \b3\().4s
+
+    sqdmulh \b0\().4s, v24.4s, \root\().4s[\l0]
+    sqdmulh \b1\().4s, v25.4s, \root\().4s[\l1]
+    sqdmulh \b2\().4s, v26.4s, \root\().4s[\l2]
+    sqdmulh \b3\().4s, v27.4s, \root\().4s[\l3]
+
+    mul     v28.4s, v24.4s, \root_p\().4s[\l0]
+    mul     v29.4s, v25.4s, \root_p\().4s[\l1]
+    mul     v30.4s, v26.4s, \root_p\().4s[\l2]
+    mul     v31.4s, v27.4s, \root_p\().4s[\l3]
+
+    sqdmulh v28.4s, v28.4s, v6.4s[0]
+    sqdmulh v29.4s, v29.4s, v6.4s[0]
+    sqdmulh v30.4s, v30.4s, v6.4s[0]
+    sqdmulh v31.4s, v31.4s, v6.4s[0]
+
+    sub     \b0\().4s, \b0\().4s, v28.4s
+    sub     \b1\().4s, \b1\().4s, v29.4s
+    sub     \b2\().4s, \b2\().4s, v30.4s
+    sub     \b3\().4s, \b3\().4s, v31.4s
+.endm
+
+/* Multiply the 4 vectors a0, ..., a3 by the scaling factor 512^-1 · 2^32, given
+ * by the lanes 1 and 2 (B and B') of v6, using the same Montgomery
+ * multiplication. */
+
+.macro scale4 a0, a1, a2, a3
+    sqdmulh v24.4s, \a0\().4s, v6.4s[1]
+    sqdmulh v25.4s, \a1\().4s, v6.4s[1]
+    sqdmulh v26.4s, \a2\().4s, v6.4s[1]
+    sqdmulh v27.4s, \a3\().4s, v6.4s[1]
+
+    mul     v28.4s, \a0\().4s, v6.4s[2]
+    mul     v29.4s, \a1\().4s, v6.4s[2]
+    mul     v30.4s, \a2\().4s, v6.4s[2]
+    mul     v31.4s, \a3\().4s, v6.4s[2]
+
+    sqdmulh v28.4s, v28.4s, v6.4s[0]
+    sqdmulh v29.4s, v29.4s, v6.4s[0]
+    sqdmulh v30.4s, v30.4s, v6.4s[0]
+    sqdmulh v31.4s, v31.4s, v6.4s[0]
+
+    sub     \a0\().4s, v24.4s, v28.4s
+    sub     \a1\().4s, v25.4s, v29.4s
+    sub     \a2\().4s, v26.4s, v30.4s
+    sub     \a3\().4s, v27.4s, v31.4s
+.endm
+
+/* Reduce the 4 vectors a0, ..., a3 from (-2M, 2M) to [0, M), i.e. add 2M (lane
+ * 3 of v6) to the negative integer coefficients and subtract M (v7) from the
+ * ones that are at least M, which is selected using an unsigned minimum. */
+
+.macro freeze4 a0, a1, a2, a3
+    ushr    v24.4s, \a0\().4s, #31
+    ushr    v25.4s, \a1\().4s, #31
+    ushr    v26.4s, \a2\().4s, #31
+    ushr    v27.4s, \a3\().4s, #31
+
+    mla     \a0\().4s, v24.4s, v6.4s[3]
+    mla     \a1\().4s, v25.4s, v6.4s[3]
+    mla     \a2\().4s, v26.4s, v6.4s[3]
+    mla     \a3\().4s, v27.4s, v6.4s[3]
+
+    sub     v28.4s, \a0\().4s, v7.4s
+    sub     v29.4s, \a1\().4s, v7.4s
+    sub     v30.4s, \a2\().4s, v7.4s
+    sub     v31.4s, \a3\().4s, v7.4s
+
+    umin    \a0\().4s, \a0\().4s, v28.4s
+    umin    \a1\().4s, \a1\().4s, v29.4s
+    umin    \a2\().4s, \a2\().4s, v30.4s
+    umin    \a3\().4s, \a3\().4s, v31.4s
+.endm
+
+/* Compute the inverse NTT layers t + 2, t + 1 and t on 8 vectors at a time.
+ * Block j of layer t has length 2L for L = 512 >> t, and its vectors i + m · L/4
+ * for m = 0, ..., 7 form 2 blocks of layer t + 1 and 4 blocks of layer t + 2.
+ * The inverse roots of block b of layer l are stored at B[512 - 2^l + b], i.e.
+ * those of the 3 layers are loaded into v0, v1 and v2 (and v3, v4 and v5 for
+ * B'). The inverse root of the first block of every layer is 1, so the layer t
+ * multiplications are skipped for j = 0. The last layer (t = 1) scales its
+ * results and reduces them to [0, M) instead, see __asm_ntt_inverse(). */
+
+.macro gs_group t
+    .set    block, 0
+    .rept   1 << ((\t) - 1)
+
+    ldr     q0, [x1, #4 * (512 - (1 << ((\t) + 2)) + 4 * block)]
+    ldr     q3, [x2, #4 * (512 - (1 << ((\t) + 2)) + 4 * block)]
+    ldr     d1, [x1, #4 * (512 - (1 << ((\t) + 1)) + 2 * block)]
+    ldr     d4, [x2, #4 * (512 - (1 << ((\t) + 1)) + 2 * block)]
+    ldr     s2, [x1, #4 * (512 - (1 << (\t)) + block)]
+    ldr     s5, [x2, #4 * (512 - (1 << (\t)) + block)]
+
+    .set    index, 0
+    .rept   (512 >> (\t)) / 4
+
+    .set    offset, 16 * (2 * (512 >> (\t)) * block + index)
+    .set    step, 16 * ((512 >> (\t)) / 4)
+    ldr     q16, [start, #offset + 0 * step]
+    ldr     q17, [start, #offset + 1 * step]
+    ldr     q18, [start, #offset + 2 * step]
+    ldr     q19, [start, #offset + 3 * step]
+    ldr     q20, [start, #offset + 4 * step]
+    ldr     q21, [start, #offset + 5 * step]
+    ldr     q22, [start, #offset + 6 * step]
+    ldr     q23, [start, #offset + 7 * step]
+
+    gs4     v16, v17, v18, v19, v20, v21, v22, v23, v0, v3, 0, 1, 2, 3
+    gs4     v16, v18, v17, v19, v20, v22, v21, v23, v1, v4, 0, 0, 1, 1
+
+    .if block == 0
+    sub_add_inplace v16, v20
+    sub_add_inplace v17, v21
+    sub_add_inplace v18, v22
+    sub_add_inplace v19, v23
+    .if (\t) == 1
+    scale4  v16, v17, v18, v19
+    scale4  v20, v21, v22, v23
+    freeze4 v16, v17, v18, v19
+    freeze4 v20, v21, v22, v23
+    .endif
+    .else
+    gs4     v16, v20, v17, v21, v18, v22, v19, v23, v2, v5, 0, 0, 0, 0
+    .endif
+
+    str     q16, [start, #offset + 0 * step]
+    str     q17, [start, #offset + 1 * step]
+    str     q18, [start, #offset + 2 * step]
+    str     q19, [start, #offset + 3 * step]
+    str     q20, [start, #offset + 4 * step]
+    str     q21, [start, #offset + 5 * step]
+    str     q22, [start, #offset + 6 * step]
+    str     q23, [start, #offset + 7 * step]
+
+    .set    index, index + 1
+    .endr
+
+    .set    block, block + 1
+    .endr
+.endm
+
+__asm_ntt_inverse_x4:
+
+    /* Due to our choice of registers we do not need (to store) callee-saved
+     * registers. Neither do we use the procedure link register, as we do not
+     * branch to any functions from within this subroutine. The function
+     * prologue is therefore empty. */
+
+    /* Alias registers for a specific purpose (and readability) */
+
+    start   .req x0     // Store pointer to the first integer coefficient
+    M       .req w5     // Store the constant value M = 6984193
+    factor  .req w6     // Store the constant values (B, B') and 2M
+
+    /* Initialize constant values */
+
+    mov     M, #0x9201              // 6984193 (= M)
+    movk    M, #0x6a, lsl #16
+    mov     v6.4s[0], M
+    dup     v7.4s, M
+
+    // The base multiplication leaves a factor 2^-32 in every coefficient,
+    // which we compensate for together with the factor 512^-1.
+    // 512^-1 mod 6984193              = 6970552
+    // B  = 6970552 · 2^32 · R mod M   = 4877441
+    // B' = B · M' mod R               = 1715657345
+
+    mov     factor, #0x6c81         // 4877441 (= B)
+    movk    factor, #0x4a, lsl #16
+    mov     v6.4s[1], factor
+
+    mov     factor, #0xda81         // 1715657345 (= B')
+    movk    factor, #0x6642, lsl #16
+    mov     v6.4s[2], factor
+
+    mov     factor, #0x2402         // 13968386 (= 2M)
+    movk    factor, #0xd5, lsl #16
+    mov     v6.4s[3], factor
+
+    /* The 4 polynomials are interleaved as in __asm_ntt_forward_x4() */
+
+    /* Layers 9+8+7: length = 1, 2, 4 */
+
+    gs_group 7
+
+    /* Layers 6+5+4: length = 8, 16, 32 */
+
+    gs_group 4
+
+    /* Layers 3+2+1: length = 64, 128, 256 */
+
+    gs_group 1
+
+    .unreq  start
+    .unreq  M
+    .unreq  factor
+
+    ret     lr
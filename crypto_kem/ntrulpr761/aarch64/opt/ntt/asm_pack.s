@@ -0,0 +1,198 @@
+/* Switch to the text segment - this contains the program code */
+
+.text
+
+/* Provide function declarations */
+
+.global __asm_pack_small
+.global __asm_unpack_small
+.global __asm_pack_top
+.global __asm_unpack_top
+.global __asm_pack_inputs
+.type __asm_pack_small, %function
+.type __asm_unpack_small, %function
+.type __asm_pack_top, %function
+.type __asm_unpack_top, %function
+.type __asm_pack_inputs, %function
+
+__asm_pack_small:
+
+    /* Due to our choice of registers we do not need (to store) callee-saved
+     * registers. Neither do we use the procedure link register, as we do not
+     * branch to any functions from within this subroutine. The function
+     * prologue is therefore empty. */
+
+    /* Alias registers for a specific purpose (and readability) */
+
+    out     .req x0     // Store pointer to the output bytes
+    in      .req x1     // Store pointer to the integer coefficients
+    count   .req w2     // Store the number of remaining vectors
+
+    /* Initialize constant values */
+
+    movi    v31.16b, #1
+    lsr     count, count, #4
+
+    /* The ld4 instruction splits 64 integer coefficients into the 16 first,
+     * second, third and fourth coefficients of each output byte. After adding
+     * 1 they are in { 0, 1, 2 }, such that sli can shift and insert them into
+     * the upper bits of v0. */
+
+.Lpack_small:
+    ld4     {v0.16b, v1.16b, v2.16b, v3.16b}, [in], #64
+    add     v0.16b, v0.16b, v31.16b
+    add     v1.16b, v1.16b, v31.16b
+    add     v2.16b, v2.16b, v31.16b
+    add     v3.16b, v3.16b, v31.16b
+    sli     v0.16b, v1.16b, #2
+    sli     v0.16b, v2.16b, #4
+    sli     v0.16b, v3.16b, #6
+    str     q0, [out], #16
+
+    subs    count, count, #1
+    b.ne    .Lpack_small
+
+    .unreq  out
+    .unreq  in
+    .unreq  count
+
+    ret     lr
+
+__asm_unpack_small:
+
+    /* Alias registers for a specific purpose (and readability) */
+
+    out     .req x0     // Store pointer to the integer coefficients
+    in      .req x1     // Store pointer to the input bytes
+    count   .req w2     // Store the number of remaining vectors
+
+    /* Initialize constant values */
+
+    movi    v31.16b, #1
+    movi    v30.16b, #3
+    lsr     count, count, #4
+
+    /* Every 2 bits of the input bytes are extracted and decreased by 1, which
+     * maps the invalid value 3 to 2 as in the reference implementation */
+
+.Lunpack_small:
+    ldr     q4, [in], #16
+    and     v0.16b, v4.16b, v30.16b
+    ushr    v1.16b, v4.16b, #2
+    and     v1.16b, v1.16b, v30.16b
+    ushr    v2.16b, v4.16b, #4
+    and     v2.16b, v2.16b, v30.16b
+    ushr    v3.16b, v4.16b, #6
+    sub     v0.16b, v0.16b, v31.16b
+    sub     v1.16b, v1.16b, v31.16b
+    sub     v2.16b, v2.16b, v31.16b
+    sub     v3.16b, v3.16b, v31.16b
+    st4     {v0.16b, v1.16b, v2.16b, v3.16b}, [out], #64
+
+    subs    count, count, #1
+    b.ne    .Lunpack_small
+
+    .unreq  out
+    .unreq  in
+    .unreq  count
+
+    ret     lr
+
+__asm_pack_top:
+
+    /* Alias registers for a specific purpose (and readability) */
+
+    out     .req x0     // Store pointer to the output bytes
+    in      .req x1     // Store pointer to the integer coefficients
+    count   .req w2     // Store the number of remaining vectors
+
+    lsr     count, count, #4
+
+    /* The integer coefficients are in { 0, ..., 15 }, so the odd ones are
+     * inserted into the upper nibbles of the even ones */
+
+.Lpack_top:
+    ld2     {v0.16b, v1.16b}, [in], #32
+    sli     v0.16b, v1.16b, #4
+    str     q0, [out], #16
+
+    subs    count, count, #1
+    b.ne    .Lpack_top
+
+    .unreq  out
+    .unreq  in
+    .unreq  count
+
+    ret     lr
+
+__asm_unpack_top:
+
+    /* Alias registers for a specific purpose (and readability) */
+
+    out     .req x0     // Store pointer to the integer coefficients
+    in      .req x1     // Store pointer to the input bytes
+    count   .req w2     // Store the number of remaining vectors
+
+    /* Initialize constant values */
+
+    movi    v31.16b, #15
+    lsr     count, count, #4
+
+.Lunpack_top:
+    ldr     q2, [in], #16
+    and     v0.16b, v2.16b, v31.16b
+    ushr    v1.16b, v2.16b, #4
+    st2     {v0.16b, v1.16b}, [out], #32
+
+    subs    count, count, #1
+    b.ne    .Lunpack_top
+
+    .unreq  out
+    .unreq  in
+    .unreq  count
+
+    ret     lr
+
+__asm_pack_inputs:
+
+    /* Alias registers for a specific purpose (and readability) */
+
+    out     .req x0     // Store pointer to the output bytes
+    in      .req x1     // Store pointer to the bits
+    count   .req w2     // Store the number of remaining vectors
+    shifts  .req x3     // Store the shifts { 0, 1, ..., 7 }
+
+    /* Initialize constant values, every bit i of an output byte is shifted
+     * left by i */
+
+    mov     shifts, #0x0100
+    movk    shifts, #0x0302, lsl #16
+    movk    shifts, #0x0504, lsl #32
+    movk    shifts, #0x0706, lsl #48
+    dup     v31.2d, shifts
+    lsr     count, count, #3
+
+    /* The shifted bits of 8 output bytes are summed using 3 levels of pairwise
+     * additions, the last one leaves the 8 output bytes in the lower half */
+
+.Lpack_inputs:
+    ld1     {v0.16b, v1.16b, v2.16b, v3.16b}, [in], #64
+    ushl    v0.16b, v0.16b, v31.16b
+    ushl    v1.16b, v1.16b, v31.16b
+    ushl    v2.16b, v2.16b, v31.16b
+    ushl    v3.16b, v3.16b, v31.16b
+    addp    v4.16b, v0.16b, v1.16b
+    addp    v5.16b, v2.16b, v3.16b
+    addp    v6.16b, v4.16b, v5.16b
+    addp    v7.16b, v6.16b, v6.16b
+    str     d7, [out], #8
+
+    subs    count, count, #1
+    b.ne    .Lpack_inputs
+
+    .unreq  out
+    .unreq  in
+    .unreq  count
+    .unreq  shifts
+
+    ret     lr
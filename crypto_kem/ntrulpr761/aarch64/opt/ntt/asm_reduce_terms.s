@@ -0,0 +1,436 @@
+/* Switch to the text segment - this contains the program code */
+
+.text
+
+/* Provide function declarations */
+
+.global __asm_reduce_terms_761
+.global __asm_reduce_terms_low_761
+.global __asm_reduce_terms3_761
+.global __asm_reduce_terms_rounded_761
+.type __asm_reduce_terms_761, %function
+.type __asm_reduce_terms_low_761, %function
+.type __asm_reduce_terms3_761, %function
+.type __asm_reduce_terms_rounded_761, %function
+
+/* Provide macro definitions */
+
+/* Gather 4 integer coefficients c[i], ..., c[i + 3] of the product directly
+ * from the GP0xGP1 matrix, undoing Good's permutation on the fly. Coefficient
+ * c[i] is stored in row i % 3 at column i % 512, i.e. the 4 columns starting
+ * at off hold the coefficients of all three rows. Row r supplies the lanes l
+ * for which (i + l - r) % 3 == 0, which are selected using the masks Q_0 = {
+ * 0, 3 }, Q_1 = { 2 } and Q_2 = { 1 } stored in v20, v21 and v22. */
+
+.macro gather out, off, s
+    ldr     q6, [start, #(\off)]
+    ldr     q7, [start, #(\off) + 2048]
+    ldr     q23, [start, #(\off) + 4096]
+    .if ((\s) % 3) == 0
+    and     \out\().16b, v6.16b, v20.16b
+    bit     \out\().16b, v7.16b, v22.16b
+    bit     \out\().16b, v23.16b, v21.16b
+    .endif
+    .if ((\s) % 3) == 1
+    and     \out\().16b, v6.16b, v21.16b
+    bit     \out\().16b, v7.16b, v20.16b
+    bit     \out\().16b, v23.16b, v22.16b
+    .endif
+    .if ((\s) % 3) == 2
+    and     \out\().16b, v6.16b, v22.16b
+    bit     \out\().16b, v7.16b, v21.16b
+    bit     \out\().16b, v23.16b, v20.16b
+    .endif
+.endm
+
+/* Gather the 8 integer coefficients c[i], ..., c[i + 7] into { v0, v1 } and
+ * d[i + 4], ..., d[i + 11] into { v3, v31 }, where d[k] = c[k + 760]. The
+ * vector d[i], ..., d[i + 3] is carried over from the previous block in v30,
+ * such that { v2, v3 } = d[i + 1], ..., d[i + 8] follows using ext. */
+
+.macro load_terms i
+    gather  v0, 4*((\i)%512), (\i)
+    gather  v1, 4*(((\i)+4)%512), (\i)+4
+    gather  v3, 4*(((\i)+764)%512), (\i)+764
+    gather  v31, 4*(((\i)+768)%512), (\i)+768
+
+    ext     v2.16b, v30.16b, v3.16b, #4
+    add     v0.4s, v0.4s, v30.4s
+    add     v1.4s, v1.4s, v3.4s
+    ext     v3.16b, v3.16b, v31.16b, #4
+    mov     v30.16b, v31.16b
+.endm
+
+/* Fold x^761 = x + 1 into the lower terms, reduce the result mod M and mod q
+ * and narrow the coefficients to 16 bits. Every reduction is computed using
+ * unsigned minimums and multiplications, i.e. without branches or division:
+ *
+ * 1) s = c[i] + c[i + 760] + c[i + 761], where 0 <= s < 3M
+ * 2) x = (s + (M-1)/2) mod M, such that r = x - (M-1)/2 is centered mod M
+ * 3) y = r + 2295 + 761q, where 0 <= y < 2^23
+ * 4) out = y - floor(y / q) · q - 2295, where floor(y / q) = (y · m) >> 44
+ *
+ * The steps 1 and 2 are shared with reduce_terms3 and given by fold_terms. */
+
+.macro fold_terms lo, hi
+    add     \lo\().4s, \lo\().4s, v2.4s
+    add     \hi\().4s, \hi\().4s, v3.4s
+
+    add     \lo\().4s, \lo\().4s, v24.4s
+    add     \hi\().4s, \hi\().4s, v24.4s
+    sub     v16.4s, \lo\().4s, v25.4s
+    sub     v17.4s, \hi\().4s, v25.4s
+    umin    \lo\().4s, \lo\().4s, v16.4s
+    umin    \hi\().4s, \hi\().4s, v17.4s
+    sub     v18.4s, \lo\().4s, v26.4s
+    sub     v19.4s, \hi\().4s, v26.4s
+    umin    \lo\().4s, \lo\().4s, v18.4s
+    umin    \hi\().4s, \hi\().4s, v19.4s
+.endm
+
+.macro reduce_terms lo, hi
+    fold_terms \lo, \hi
+
+    add     \lo\().4s, \lo\().4s, v27.4s
+    add     \hi\().4s, \hi\().4s, v27.4s
+    umull   v16.2d, \lo\().2s, v29.2s[0]
+    umull2  v17.2d, \lo\().4s, v29.4s[0]
+    umull   v18.2d, \hi\().2s, v29.2s[0]
+    umull2  v19.2d, \hi\().4s, v29.4s[0]
+    uzp2    v16.4s, v16.4s, v17.4s
+    uzp2    v18.4s, v18.4s, v19.4s
+    ushr    v16.4s, v16.4s, #12
+    ushr    v18.4s, v18.4s, #12
+    mls     \lo\().4s, v16.4s, v29.4s[1]
+    mls     \hi\().4s, v18.4s, v29.4s[1]
+    sub     \lo\().4s, \lo\().4s, v28.4s
+    sub     \hi\().4s, \hi\().4s, v28.4s
+
+    xtn     \lo\().4h, \lo\().4s
+    xtn2    \lo\().8h, \hi\().4s
+.endm
+
+/* Fold x^761 = x + 1 into the lower terms of a product of two small
+ * polynomials, and reduce the result mod M and mod 3 instead of mod q. The
+ * integer coefficients of such a product are at most 761 in absolute value, so
+ * r = s is exact and small:
+ *
+ * 3) y = r + 1 + 3 · 2^12, where 0 <= y < 2^15
+ * 4) out = y - floor(y / 3) · 3 - 1, where floor(y / 3) = (y · 21846) >> 16
+ *
+ * The result is narrowed to 8 bits, i.e. lo holds 8 coefficients in its lower
+ * 64 bits. */
+
+.macro reduce_terms3 lo, hi
+    fold_terms \lo, \hi
+
+    sub     \lo\().4s, \lo\().4s, v27.4s
+    sub     \hi\().4s, \hi\().4s, v27.4s
+    mul     v16.4s, \lo\().4s, v29.4s[0]
+    mul     v18.4s, \hi\().4s, v29.4s[0]
+    ushr    v16.4s, v16.4s, #16
+    ushr    v18.4s, v18.4s, #16
+    mls     \lo\().4s, v16.4s, v29.4s[1]
+    mls     \hi\().4s, v18.4s, v29.4s[1]
+    sub     \lo\().4s, \lo\().4s, v28.4s
+    sub     \hi\().4s, \hi\().4s, v28.4s
+
+    xtn     \lo\().4h, \lo\().4s
+    xtn2    \lo\().8h, \hi\().4s
+    xtn     \lo\().8b, \lo\().8h
+.endm
+
+/* Round the 8 integer coefficients of lo to the nearest multiple of 3 and
+ * merge them into the first level of Encode() for the radix m = (q + 2) / 3.
+ * Since reduce_terms subtracts -1 instead of (q-1)/2 (v28), lo holds r + q12 +
+ * 1 in 1, ..., q rather than the centered coefficient r, such that
+ *
+ * 1) R = (r + q12 + 1) / 3 = (lo · 10923) >> 15 is the Rounded integer of
+ *    Round(r) = 3R - q12, computed by sqdmulh with v4 = 10923
+ * 2) out = R[2i] + R[2i + 1] · m for the 4 pairs, with v5 = m
+ *
+ * The lowest byte of every merged integer is written to S and the remaining
+ * out >> 8 to R2, the same as __asm_encode_merge() with k = 1. */
+
+.macro round_merge lo
+    sqdmulh \lo\().8h, \lo\().8h, v4.8h
+    uzp1    v16.8h, \lo\().8h, \lo\().8h
+    uzp2    v17.8h, \lo\().8h, \lo\().8h
+    uxtl    v16.4s, v16.4h
+    umlal   v16.4s, v17.4h, v5.4h
+
+    xtn     v17.4h, v16.4s
+    xtn     v17.8b, v17.8h
+    shrn    v16.4h, v16.4s, #8
+    st1     {v17.s}[0], [S], #4
+    st1     {v16.d}[0], [R2], #8
+.endm
+
+/* Initialize the constants (M-1)/2, 2M and M of fold_terms in v24, v25 and
+ * v26, the lane masks of gather in v20, v21 and v22, and the carried vector
+ * d[0], ..., d[3] in v30. */
+
+.macro init_terms
+    mov     value, #0x4900          // 3492096 (= (M-1)/2)
+    movk    value, #0x35, lsl #16
+    dup     v24.4s, value
+
+    mov     value, #0x2402          // 13968386 (= 2M)
+    movk    value, #0xd5, lsl #16
+    dup     v25.4s, value
+
+    mov     value, #0x9201          // 6984193 (= M)
+    movk    value, #0x6a, lsl #16
+    dup     v26.4s, value
+
+    /* Initialize the lane masks Q_0 = { 0, 3 }, Q_1 = { 2 } and Q_2 = { 1 } */
+
+    mov     mask, #0xffffffff
+    movi    v21.2d, #0
+    mov     v20.d[0], mask
+    mov     v21.d[1], mask
+    mov     mask, #0xffffffff00000000
+    movi    v22.2d, #0
+    mov     v20.d[1], mask
+    mov     v22.d[0], mask
+
+    /* The first coefficient only receives c[0] + c[761], since x^761 = x + 1
+     * is folded into x^1 and x^0 but there is no x^760 term to fold into x^0.
+     * We therefore clear the first lane of d[0], ..., d[3] before the first
+     * block. */
+
+    gather  v30, 4 * 248, 760
+    mov     v30.4s[0], wzr
+.endm
+
+__asm_reduce_terms_761:
+
+    /* Due to our choice of registers we do not need (to store) callee-saved
+     * registers. Neither do we use the procedure link register, as we do not
+     * branch to any functions from within this subroutine. The function
+     * prologue is therefore empty. */
+
+    /* Alias registers for a specific purpose (and readability) */
+
+    out     .req x0     // Store pointer to the first resulting coefficient
+    start   .req x1     // Store pointer to the first row of the matrix
+    value   .req w4     // Store the constant value that is being initialized
+    mask    .req x5     // Store the 64 bit halves of the lane masks
+
+    /* Initialize constant values */
+
+    init_terms
+
+    mov     value, #3950            // 2295 + 761q - (M-1)/2
+    dup     v27.4s, value
+
+    mov     value, #2295            // (q-1)/2
+    dup     v28.4s, value
+
+    mov     value, #0xee7e          // 3831885438 (= m = ceil(2^44 / q))
+    movk    value, #0xe465, lsl #16
+    mov     v29.4s[0], value
+
+    mov     value, #4591            // q
+    mov     v29.4s[1], value
+
+    /* We need to repeat this sequence 95 times. We can take 8 values in one go
+     * and 760 / 8 = 95. The offsets of the gathered columns wrap around mod 512
+     * and are therefore computed at assembly time. */
+
+    .set    index, 0
+    .rept 95
+
+    load_terms index
+    reduce_terms v0, v1
+    st1     {v0.8h}, [out], #16
+
+    .set    index, index + 8
+    .endr
+
+    /* The last coefficient c[760] = c[760] + c[1520] + c[1521] is computed on
+     * its own, since the output only has room for 761 coefficients. */
+
+    load_terms index
+    reduce_terms v0, v1
+    st1     {v0.h}[0], [out]
+
+    .unreq  out
+    .unreq  start
+    .unreq  value
+    .unreq  mask
+
+    ret     lr
+
+__asm_reduce_terms_low_761:
+
+    /* Due to our choice of registers we do not need (to store) callee-saved
+     * registers. Neither do we use the procedure link register, as we do not
+     * branch to any functions from within this subroutine. The function
+     * prologue is therefore empty. */
+
+    /* Alias registers for a specific purpose (and readability) */
+
+    out     .req x0     // Store pointer to the first resulting coefficient
+    start   .req x1     // Store pointer to the first row of the matrix
+    value   .req w4     // Store the constant value that is being initialized
+    mask    .req x5     // Store the 64 bit halves of the lane masks
+
+    /* Initialize constant values */
+
+    init_terms
+
+    mov     value, #3950            // 2295 + 761q - (M-1)/2
+    dup     v27.4s, value
+
+    mov     value, #2295            // (q-1)/2
+    dup     v28.4s, value
+
+    mov     value, #0xee7e          // 3831885438 (= m = ceil(2^44 / q))
+    movk    value, #0xe465, lsl #16
+    mov     v29.4s[0], value
+
+    mov     value, #4591            // q
+    mov     v29.4s[1], value
+
+    /* The first 32 of the 95 blocks of __asm_reduce_terms_761(), i.e. the
+     * I = 256 coefficients that NTRU LPRime actually uses. Every block only
+     * depends on the carried vector of its predecessor, so the remaining
+     * blocks are simply left out. */
+
+    .set    index, 0
+    .rept 32
+
+    load_terms index
+    reduce_terms v0, v1
+    st1     {v0.8h}, [out], #16
+
+    .set    index, index + 8
+    .endr
+
+    .unreq  out
+    .unreq  start
+    .unreq  value
+    .unreq  mask
+
+    ret     lr
+
+__asm_reduce_terms3_761:
+
+    /* Due to our choice of registers we do not need (to store) callee-saved
+     * registers. Neither do we use the procedure link register, as we do not
+     * branch to any functions from within this subroutine. The function
+     * prologue is therefore empty. */
+
+    /* Alias registers for a specific purpose (and readability) */
+
+    out     .req x0     // Store pointer to the first resulting coefficient
+    start   .req x1     // Store pointer to the first row of the matrix
+    value   .req w4     // Store the constant value that is being initialized
+    mask    .req x5     // Store the 64 bit halves of the lane masks
+
+    /* Initialize constant values */
+
+    init_terms
+
+    mov     value, #0x18ff          // 3479807 (= (M-1)/2 - 1 - 3 · 2^12)
+    movk    value, #0x35, lsl #16
+    dup     v27.4s, value
+
+    movi    v28.4s, #1
+
+    mov     value, #21846           // ceil(2^16 / 3)
+    mov     v29.4s[0], value
+
+    mov     value, #3
+    mov     v29.4s[1], value
+
+    /* The same 95 blocks of 8 coefficients as in __asm_reduce_terms_761(),
+     * each of which is stored as 8 bytes */
+
+    .set    index, 0
+    .rept 95
+
+    load_terms index
+    reduce_terms3 v0, v1
+    st1     {v0.8b}, [out], #8
+
+    .set    index, index + 8
+    .endr
+
+    load_terms index
+    reduce_terms3 v0, v1
+    st1     {v0.b}[0], [out]
+
+    .unreq  out
+    .unreq  start
+    .unreq  value
+    .unreq  mask
+
+    ret     lr
+
+__asm_reduce_terms_rounded_761:
+
+    /* Due to our choice of registers we do not need (to store) callee-saved
+     * registers. Neither do we use the procedure link register, as we do not
+     * branch to any functions from within this subroutine. The function
+     * prologue is therefore empty. */
+
+    /* Alias registers for a specific purpose (and readability) */
+
+    S       .req x0     // Store pointer to the next output byte
+    R2      .req x1     // Store pointer to the next merged integer
+    start   .req x2     // Store pointer to the first row of the matrix
+    value   .req w4     // Store the constant value that is being initialized
+    mask    .req x5     // Store the 64 bit halves of the lane masks
+
+    /* Initialize constant values */
+
+    init_terms
+
+    mov     value, #3950            // 2295 + 761q - (M-1)/2
+    dup     v27.4s, value
+
+    movi    v28.16b, #0xff          // -1
+
+    mov     value, #0xee7e          // 3831885438 (= m = ceil(2^44 / q))
+    movk    value, #0xe465, lsl #16
+    mov     v29.4s[0], value
+
+    mov     value, #4591            // q
+    mov     v29.4s[1], value
+
+    mov     value, #10923           // ceil(2^15 / 3)
+    dup     v4.8h, value
+
+    mov     value, #1531            // (q + 2) / 3
+    dup     v5.8h, value
+
+    /* The same 95 blocks of 8 coefficients as in __asm_reduce_terms_761(),
+     * each of which yields 4 output bytes and 4 merged integers */
+
+    .set    index, 0
+    .rept 95
+
+    load_terms index
+    reduce_terms v0, v1
+    round_merge v0
+
+    .set    index, index + 8
+    .endr
+
+    /* Since 761 is odd, the last Rounded integer R[760] is not merged but
+     * carried over to R2[380] */
+
+    load_terms index
+    reduce_terms v0, v1
+    sqdmulh v0.8h, v0.8h, v4.8h
+    st1     {v0.h}[0], [R2]
+
+    .unreq  S
+    .unreq  R2
+    .unreq  start
+    .unreq  value
+    .unreq  mask
+
+    ret     lr
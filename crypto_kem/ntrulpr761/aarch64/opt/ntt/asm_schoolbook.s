@@ -0,0 +1,177 @@
+/* Switch to the text segment - this contains the program code */
+
+.text
+
+/* Provide function declarations */
+
+.global __asm_schoolbook48
+.type __asm_schoolbook48, %function
+
+/* Provide macro definitions */
+
+/* Multiply-accumulate 4 products into accumulator idx of the window v16, ...,
+ * v23, i.e. acc += src · a[lane] for the lower (smlal) or upper (smlal2) half of
+ * src. The accumulator is selected at assembly time. */
+
+.macro acc_mac idx, op, src, half, a, lane
+    .if (\idx) == 0
+    \op     v16.4s, \src\().\half, \a\().8h[\lane]
+    .endif
+    .if (\idx) == 1
+    \op     v17.4s, \src\().\half, \a\().8h[\lane]
+    .endif
+    .if (\idx) == 2
+    \op     v18.4s, \src\().\half, \a\().8h[\lane]
+    .endif
+    .if (\idx) == 3
+    \op     v19.4s, \src\().\half, \a\().8h[\lane]
+    .endif
+    .if (\idx) == 4
+    \op     v20.4s, \src\().\half, \a\().8h[\lane]
+    .endif
+    .if (\idx) == 5
+    \op     v21.4s, \src\().\half, \a\().8h[\lane]
+    .endif
+    .if (\idx) == 6
+    \op     v22.4s, \src\().\half, \a\().8h[\lane]
+    .endif
+    .if (\idx) == 7
+    \op     v23.4s, \src\().\half, \a\().8h[\lane]
+    .endif
+.endm
+
+/* Accumulate a[i] · b into the outputs i, ..., i + 15 of the window. The
+ * coefficients of b shifted up by r = i % 4 lanes are stored in { s0, s1, s2 },
+ * such that the products are aligned with the accumulators i - r, ..., i - r +
+ * 19. The last 4 accumulators are only needed when r != 0. */
+
+.macro mac_coeff i, a, lane, s0, s1, s2
+    acc_mac ((\i) / 4) + 0, smlal, \s0, 4h, \a, \lane
+    acc_mac ((\i) / 4) + 1, smlal2, \s0, 8h, \a, \lane
+    acc_mac ((\i) / 4) + 2, smlal, \s1, 4h, \a, \lane
+    acc_mac ((\i) / 4) + 3, smlal2, \s1, 8h, \a, \lane
+    .if ((\i) % 4) != 0
+    acc_mac ((\i) / 4) + 4, smlal, \s2, 4h, \a, \lane
+    .endif
+.endm
+
+/* Compute the 16x16 schoolbook product of a = { v0, v1 } and b = { v2, v3 } and
+ * accumulate it into the window v16, ..., v23. The shifted copies of b are
+ * computed using ext with the zero vector v4. */
+
+.macro mac_block
+    ext     v5.16b, v4.16b, v2.16b, #14
+    ext     v6.16b, v2.16b, v3.16b, #14
+    ext     v7.16b, v3.16b, v4.16b, #14
+    ext     v24.16b, v4.16b, v2.16b, #12
+    ext     v25.16b, v2.16b, v3.16b, #12
+    ext     v26.16b, v3.16b, v4.16b, #12
+    ext     v27.16b, v4.16b, v2.16b, #10
+    ext     v28.16b, v2.16b, v3.16b, #10
+    ext     v29.16b, v3.16b, v4.16b, #10
+
+    mac_coeff 0, v0, 0, v2, v3, v4
+    mac_coeff 1, v0, 1, v5, v6, v7
+    mac_coeff 2, v0, 2, v24, v25, v26
+    mac_coeff 3, v0, 3, v27, v28, v29
+    mac_coeff 4, v0, 4, v2, v3, v4
+    mac_coeff 5, v0, 5, v5, v6, v7
+    mac_coeff 6, v0, 6, v24, v25, v26
+    mac_coeff 7, v0, 7, v27, v28, v29
+    mac_coeff 8, v1, 0, v2, v3, v4
+    mac_coeff 9, v1, 1, v5, v6, v7
+    mac_coeff 10, v1, 2, v24, v25, v26
+    mac_coeff 11, v1, 3, v27, v28, v29
+    mac_coeff 12, v1, 4, v2, v3, v4
+    mac_coeff 13, v1, 5, v5, v6, v7
+    mac_coeff 14, v1, 6, v24, v25, v26
+    mac_coeff 15, v1, 7, v27, v28, v29
+.endm
+
+/* Load the blocks a[16I], ..., a[16I + 15] and b[16J], ..., b[16J + 15] and
+ * accumulate their product into the window */
+
+.macro block I, J
+    ldr     q0, [in_a, #32 * (\I)]
+    ldr     q1, [in_a, #32 * (\I) + 16]
+    ldr     q2, [in_b, #32 * (\J)]
+    ldr     q3, [in_b, #32 * (\J) + 16]
+
+    mac_block
+.endm
+
+/* Store the lower half of the window, i.e. 16 final outputs, and slide the
+ * window up by 16 outputs */
+
+.macro slide_window
+    st1     {v16.4s, v17.4s, v18.4s, v19.4s}, [out], #64
+
+    mov     v16.16b, v20.16b
+    mov     v17.16b, v21.16b
+    mov     v18.16b, v22.16b
+    mov     v19.16b, v23.16b
+    movi    v20.2d, #0
+    movi    v21.2d, #0
+    movi    v22.2d, #0
+    movi    v23.2d, #0
+.endm
+
+__asm_schoolbook48:
+
+    /* Due to our choice of registers we do not need (to store) callee-saved
+     * registers. Neither do we use the procedure link register, as we do not
+     * branch to any functions from within this subroutine. The function
+     * prologue is therefore empty. */
+
+    /* Alias registers for a specific purpose (and readability) */
+
+    out     .req x0     // Store pointer to the first resulting coefficient
+    in_a    .req x1     // Store pointer to the first coefficient of a
+    in_b    .req x2     // Store pointer to the first coefficient of b
+
+    movi    v4.2d, #0
+    movi    v16.2d, #0
+    movi    v17.2d, #0
+    movi    v18.2d, #0
+    movi    v19.2d, #0
+    movi    v20.2d, #0
+    movi    v21.2d, #0
+    movi    v22.2d, #0
+    movi    v23.2d, #0
+
+    /* The 48x48 product is split into 3x3 products of 16x16 coefficients. The
+     * products of the blocks (I, J) with I + J = s only affect the outputs 16s,
+     * ..., 16s + 30, so they are accumulated into a window of 32 outputs held in
+     * v16, ..., v23. After each diagonal s the lower 16 outputs are final. The
+     * integer coefficients of a and b are bounded by 2^14 and 2^6 respectively,
+     * so the sums of at most 48 products fit in 32 bits. */
+
+    block   0, 0
+    slide_window
+
+    block   0, 1
+    block   1, 0
+    slide_window
+
+    block   0, 2
+    block   1, 1
+    block   2, 0
+    slide_window
+
+    block   1, 2
+    block   2, 1
+    slide_window
+
+    block   2, 2
+    slide_window
+
+    /* The last output 95 is always zero, but storing the full window keeps the
+     * result aligned to whole vectors */
+
+    st1     {v16.4s, v17.4s, v18.4s, v19.4s}, [out]
+
+    .unreq  out
+    .unreq  in_a
+    .unreq  in_b
+
+    ret     lr
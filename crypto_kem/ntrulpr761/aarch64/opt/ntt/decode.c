@@ -0,0 +1,213 @@
+#include "decode.h"
+
+/**
+ * This source can be used to decode the Rq and Rounded polynomials, i.e. it
+ * replaces Decode() of the reference implementation for the case where all p
+ * integers share the same radix m. The recursion of Decode() is split into two
+ * passes: the first one walks down the levels and computes the radices and the
+ * offset of the input bytes of every level, which only depend on p and m. The
+ * second one walks back up and splits the merged integers of every level. Both
+ * passes are unrolled, such that all radices and their reciprocals are known at
+ * compile time. The divisions of the pairs with equal radices are vectorized in
+ * asm_decode.s, the few others use the scalar decode_divmod().
+ */
+
+/**
+ * @brief Compute the quotient and remainder of x and a constant modulus m.
+ *
+ * @details The same constant time steps as uint32_divmod_uint14(), where the
+ * reciprocal v = 2^31 / m is folded into a constant once the function has been
+ * inlined for a constant m.
+ *
+ * @param[out] q The quotient x / m
+ * @param[in] x The dividend
+ * @param[in] m The modulus, 0 < m < 16384
+ * @return The remainder x mod m
+ */
+static inline __attribute__((always_inline)) uint32_t decode_divmod(uint32_t *q, uint32_t x, uint32_t m)
+{
+    uint32_t v = 0x80000000 / m;
+    uint32_t qpart, mask;
+
+    qpart = (uint32_t)(((uint64_t)x * v) >> 31);
+    x -= qpart * m;
+    *q = qpart;
+
+    qpart = (uint32_t)(((uint64_t)x * v) >> 31);
+    x -= qpart * m;
+    *q += qpart;
+
+    x -= m;
+    *q += 1;
+    mask = -(x >> 31);
+    x += mask & m;
+    *q += mask;
+
+    return x;
+}
+
+/**
+ * @brief Return the radix of a merged integer and its number of bytes.
+ *
+ * @param[in] m The product of the radices of a pair
+ * @param[out] k The number of bytes of the pair, 0, 1 or 2
+ * @return The radix of the merged integer, less than 16384
+ */
+static inline uint32_t decode_radix(uint32_t m, uint32_t *k)
+{
+    *k = 0;
+
+    while (m >= 16384)
+    {
+        m = (m + 255) >> 8;
+        *k += 1;
+    }
+
+    return m;
+}
+
+/**
+ * @brief Return the next k bytes of the input as an integer.
+ */
+static inline uint32_t decode_bytes(const unsigned char *in, uint32_t k)
+{
+    return k == 0 ? 0 : k == 1 ? in[0] : in[0] + ((uint32_t)in[1] << 8);
+}
+
+/**
+ * @brief Decode p integers in 0, ..., m - 1 for a constant radix m.
+ *
+ * @details Level j has len[j] integers, all but the last one of radix m[j], the
+ * last one of radix mlast[j]. Its pairs with the radices (m[j], m[j]) take k[j]
+ * bytes each, followed by klast[j] bytes for the pair (m[j], mlast[j]) if
+ * len[j] is even. The bytes of level j start at offset[j].
+ *
+ * The levels below bottom are not split, i.e. for bottom = 1 out receives the
+ * len[1] merged integers of the first level, whose input bytes are the first
+ * ones of in.
+ *
+ * @param[out] out The p integers, or the integers of level bottom
+ * @param[in] in The encoded bytes
+ * @param[in] radix The radix of all integers, less than 16384
+ * @param[in] bottom The last level to split, 0 or 1
+ */
+static inline __attribute__((always_inline)) void decode_const(uint16_t *out, const unsigned char *in, uint32_t radix, int bottom)
+{
+    uint16_t buffer[2][ENCODE_HALF] __attribute__((aligned(16)));
+    size_t len[ENCODE_LEVELS + 1], offset[ENCODE_LEVELS + 1];
+    uint32_t m[ENCODE_LEVELS + 1], mlast[ENCODE_LEVELS + 1];
+    uint32_t k[ENCODE_LEVELS], klast[ENCODE_LEVELS];
+    uint16_t *R, *R2;
+    uint32_t r, q, top;
+    size_t pairs, vectors, idx;
+
+    len[0] = NTRU_P;
+    offset[0] = 0;
+    m[0] = mlast[0] = radix;
+
+    /* Walk down the levels to compute the radices and offsets */
+
+#pragma GCC unroll 16
+    for (int level = 0; level < ENCODE_LEVELS; level++)
+    {
+        pairs = len[level] / 2;
+
+        m[level + 1] = decode_radix(m[level] * m[level], &k[level]);
+        mlast[level + 1] = decode_radix(m[level] * mlast[level], &klast[level]);
+
+        if (len[level] % 2 == 1)
+        {
+            mlast[level + 1] = mlast[level];
+            klast[level] = 0;
+        }
+
+        offset[level + 1] = offset[level] + k[level] * (pairs - (len[level] % 2 == 0)) + klast[level];
+        len[level + 1] = (len[level] + 1) / 2;
+    }
+
+    /* The last integer takes the remaining bytes */
+
+    R2 = buffer[ENCODE_LEVELS % 2];
+    top = mlast[ENCODE_LEVELS];
+    r = top == 1 ? 0 : top <= 256 ? in[offset[ENCODE_LEVELS]] : decode_bytes(in + offset[ENCODE_LEVELS], 2);
+    R2[0] = (uint16_t)decode_divmod(&q, r, top);
+
+    /* Walk back up the levels to split the merged integers */
+
+#pragma GCC unroll 16
+    for (int level = ENCODE_LEVELS - 1; level >= bottom; level--)
+    {
+        const unsigned char *S = in + offset[level];
+
+        R = level == bottom ? out : buffer[level % 2];
+        pairs = len[level] / 2;
+        vectors = (pairs - (len[level] % 2 == 0)) & ~(size_t)7;
+
+        if (vectors > 0)
+        {
+            __asm_decode_split(R, R2, S, (int32_t)vectors, (int32_t)m[level], (int32_t)(0x80000000 / m[level]), (int32_t)k[level]);
+            S += k[level] * vectors;
+        }
+
+        for (idx = vectors; idx < pairs; idx++)
+        {
+            uint32_t kidx = k[level], m1 = m[level];
+
+            if (idx == pairs - 1 && len[level] % 2 == 0)
+            {
+                kidx = klast[level];
+                m1 = mlast[level];
+            }
+
+            r = decode_bytes(S, kidx) + ((uint32_t)R2[idx] << (8 * kidx));
+            S += kidx;
+
+            R[2 * idx] = (uint16_t)decode_divmod(&q, r, m[level]);
+            R[2 * idx + 1] = (uint16_t)decode_divmod(&q, q, m1); /* only needed for invalid inputs */
+        }
+
+        if (len[level] % 2 == 1)
+        {
+            R[len[level] - 1] = R2[pairs];
+        }
+
+        R2 = R;
+    }
+}
+
+/**
+ * @brief Decode an Rq polynomial, i.e. p integers in 0, ..., q - 1.
+ *
+ * @param[out] R The p integers
+ * @param[in] in The encoded polynomial
+ */
+void decode761_rq(uint16_t *R, const unsigned char *in)
+{
+    decode_const(R, in, NTRU_Q, 0);
+}
+
+/**
+ * @brief Decode a Rounded polynomial, i.e. p integers in 0, ..., (q - 1) / 3.
+ *
+ * @param[out] R The p integers
+ * @param[in] in The encoded polynomial
+ */
+void decode761_rounded(uint16_t *R, const unsigned char *in)
+{
+    decode_const(R, in, (NTRU_Q + 2) / 3, 0);
+}
+
+/**
+ * @brief Decode the merged integers of the first level of a Rounded polynomial.
+ *
+ * @details This function is equal to decode761_rounded(), except that the last
+ * split is left to the caller, see __asm_goods_rounded_l1(). Its p / 2 pairs
+ * take the first bytes of the encoded polynomial.
+ *
+ * @param[out] R2 The ENCODE_HALF merged integers
+ * @param[in] in The encoded polynomial
+ */
+void decode761_rounded_l1(uint16_t *R2, const unsigned char *in)
+{
+    decode_const(R2, in, (NTRU_Q + 2) / 3, 1);
+}
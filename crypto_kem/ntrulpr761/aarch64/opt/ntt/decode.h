@@ -0,0 +1,46 @@
+#ifndef DECODE_H
+#define DECODE_H
+
+/**
+ * This header accompanies decode.c and asm_decode.s. It is used to contain the
+ * decoders of the Rq and Rounded polynomials and the wrapper for their
+ * vectorized divisions. As you can see it has been defined as a Once-Only
+ * Header to avoid the compiler from processing the contents twice.
+ */
+
+/* Include system header files */
+
+#include <stddef.h>
+#include <stdint.h>
+
+/* Include user header files */
+
+#include "ntt_params.h"
+
+/**
+ * @brief Split n merged integers into pairs with the same radices.
+ *
+ * @details This function can be used to compute the pairwise divisions of a
+ * single level of Decode(), as long as all n pairs have the radices (m, m).
+ * Every merged integer is completed to r = bottom + R2[i] · 2^8k, where bottom
+ * consists of the next k bytes of S, and split into R[2i] = r mod m and R[2i +
+ * 1] = (r / m) mod m. The divisions use the same constant time algorithm as
+ * uint32_divmod_uint14(), where v = 2^31 / m is precomputed by the caller.
+ *
+ * @param[out] R The 2n integers in 0, ..., m - 1
+ * @param[in] R2 The n merged integers
+ * @param[in] S The n · k input bytes
+ * @param[in] n The number of pairs, a multiple of 8
+ * @param[in] m The radix of all integers
+ * @param[in] v The reciprocal 2^31 / m, rounded down
+ * @param[in] k The number of input bytes per pair, 0, 1 or 2
+ */
+extern void __asm_decode_split(uint16_t *R, const uint16_t *R2, const unsigned char *S, int32_t n, int32_t m, int32_t v, int32_t k);
+
+/* Provide function declarations */
+
+void decode761_rq(uint16_t *R, const unsigned char *in);
+void decode761_rounded(uint16_t *R, const unsigned char *in);
+void decode761_rounded_l1(uint16_t *R2, const unsigned char *in);
+
+#endif
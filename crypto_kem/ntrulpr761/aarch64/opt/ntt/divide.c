@@ -0,0 +1,114 @@
+#include "divide.h"
+
+/**
+ * This source can be used to divide whole arrays of integers by a constant
+ * modulus, as an alternative to calling uint32_divmod_uint14() or
+ * int32_mod_uint14() per integer. The reciprocal of the modulus is precomputed
+ * in a uint14_divisor_t, the bulk of the integers is processed in
+ * asm_divide.s and the remaining n mod 8 integers by uint14_divmod().
+ */
+
+/**
+ * @brief Divide x by m in constant time using the precomputed reciprocal.
+ *
+ * @param[out] q The quotient x / m
+ * @param[in] x The dividend
+ * @param[in] d The divisor
+ * @return The remainder x mod m
+ */
+static inline uint32_t uint14_divmod(uint32_t *q, uint32_t x, const uint14_divisor_t *d)
+{
+    uint32_t qpart, mask;
+
+    qpart = (uint32_t)(((uint64_t)x * d->v) >> 31);
+    x -= qpart * d->m;
+    *q = qpart;
+
+    qpart = (uint32_t)(((uint64_t)x * d->v) >> 31);
+    x -= qpart * d->m;
+    *q += qpart;
+
+    x -= d->m;
+    *q += 1;
+    mask = -(x >> 31);
+    x += mask & d->m;
+    *q += mask;
+
+    return x;
+}
+
+/**
+ * @brief Divide n integers by a constant modulus.
+ *
+ * @param[out] quot The n quotients x / m
+ * @param[out] r The n remainders x mod m
+ * @param[in] x The n dividends
+ * @param[in] n The number of integers
+ * @param[in] d The divisor
+ */
+void uint14_divmod_batch(uint32_t *quot, uint16_t *r, const uint32_t *x, size_t n, const uint14_divisor_t *d)
+{
+    size_t vectors = n & ~(size_t)7;
+
+    if (vectors > 0)
+    {
+        __asm_divmod_batch(quot, r, x, (int32_t)vectors, (int32_t)d->m, (int32_t)d->v);
+    }
+
+    for (size_t idx = vectors; idx < n; idx++)
+    {
+        r[idx] = (uint16_t)uint14_divmod(&quot[idx], x[idx], d);
+    }
+}
+
+/**
+ * @brief Reduce n integers mod a constant modulus.
+ *
+ * @param[out] r The n remainders x mod m
+ * @param[in] x The n dividends
+ * @param[in] n The number of integers
+ * @param[in] d The divisor
+ */
+void uint14_mod_batch(uint16_t *r, const uint32_t *x, size_t n, const uint14_divisor_t *d)
+{
+    size_t vectors = n & ~(size_t)7;
+    uint32_t q;
+
+    if (vectors > 0)
+    {
+        __asm_divmod_batch(NULL, r, x, (int32_t)vectors, (int32_t)d->m, (int32_t)d->v);
+    }
+
+    for (size_t idx = vectors; idx < n; idx++)
+    {
+        r[idx] = (uint16_t)uint14_divmod(&q, x[idx], d);
+    }
+}
+
+/**
+ * @brief Freeze n integers mod a constant modulus.
+ *
+ * @details The result matches int32_mod_uint14(x + (m - 1) / 2, m) - (m - 1) / 2
+ * of the reference implementation, i.e. Fq_freeze() for m = q and F3_freeze()
+ * for m = 3. The array r may be the same as x.
+ *
+ * @param[out] r The n centered representatives in -(m - 1)/2, ..., (m - 1)/2
+ * @param[in] x The n integers
+ * @param[in] n The number of integers
+ * @param[in] d The divisor
+ */
+void uint14_freeze_batch(int16_t *r, const int16_t *x, size_t n, const uint14_divisor_t *d)
+{
+    size_t vectors = n & ~(size_t)7;
+    uint32_t q;
+
+    if (vectors > 0)
+    {
+        __asm_freeze_batch(r, x, (int32_t)vectors, (int32_t)d->m, (int32_t)d->v, (int32_t)d->offset);
+    }
+
+    for (size_t idx = vectors; idx < n; idx++)
+    {
+        r[idx] = (int16_t)(uint14_divmod(&q, (uint32_t)(x[idx] + (int32_t)d->offset), d) - (d->m - 1) / 2);
+    }
+}
@@ -0,0 +1,72 @@
+#ifndef DIVIDE_H
+#define DIVIDE_H
+
+/**
+ * This header accompanies divide.c and asm_divide.s. It is used to contain the
+ * batch versions of uint32_divmod_uint14() and int32_mod_uint14(), which divide
+ * whole arrays by a constant modulus. As you can see it has been defined as a
+ * Once-Only Header to avoid the compiler from processing the contents twice.
+ */
+
+/* Include system header files */
+
+#include <stddef.h>
+#include <stdint.h>
+
+/**
+ * @brief Define a modulus together with its precomputed reciprocal.
+ *
+ * uint32_divmod_uint14() computes v = 2^31 / m with a division instruction on
+ * every call. A uint14_divisor_t holds m and v instead, such that a divisor of
+ * a constant modulus is initialized at compile time using UINT14_DIVISOR(m).
+ * The freeze offset is the smallest integer congruent to (m - 1) / 2 mod m that
+ * is at least 2^15, which makes all int16_t inputs nonnegative.
+ */
+
+typedef struct
+{
+    uint32_t m;      /* The modulus, 0 < m < 16384 */
+    uint32_t v;      /* The reciprocal 2^31 / m, rounded down */
+    uint32_t offset; /* The freeze offset, congruent to (m - 1) / 2 mod m */
+} uint14_divisor_t;
+
+#define UINT14_DIVISOR(m) { (m), 0x80000000U / (m), ((m) - 1) / 2 + (m) * ((32768 + (m) - 1) / (m)) }
+
+/**
+ * @brief Divide x by m for n integers.
+ *
+ * @details The same constant time steps as uint32_divmod_uint14(), on 4 integers
+ * per vector. The quotients are only stored if quot is not NULL.
+ *
+ * @param[out] quot The n quotients x / m, or NULL
+ * @param[out] r The n remainders x mod m, or NULL
+ * @param[in] x The n dividends
+ * @param[in] n The number of integers, a multiple of 8
+ * @param[in] m The modulus
+ * @param[in] v The reciprocal 2^31 / m, rounded down
+ */
+extern void __asm_divmod_batch(uint32_t *quot, uint16_t *r, const uint32_t *x, int32_t n, int32_t m, int32_t v);
+
+/**
+ * @brief Freeze n integers into -(m - 1)/2, ..., (m - 1)/2.
+ *
+ * @details The integers are shifted by the freeze offset, reduced mod m and
+ * shifted back by (m - 1) / 2, on 8 integers per iteration. The array r may be
+ * the same as x.
+ *
+ * @param[out] r The n centered representatives of x mod m
+ * @param[in] x The n integers
+ * @param[in] n The number of integers, a multiple of 8
+ * @param[in] m The modulus
+ * @param[in] v The reciprocal 2^31 / m, rounded down
+ * @param[in] offset The freeze offset
+ */
+extern void __asm_freeze_batch(int16_t *r, const int16_t *x, int32_t n, int32_t m, int32_t v, int32_t offset);
+
+/* Provide function declarations */
+
+void uint14_divmod_batch(uint32_t *quot, uint16_t *r, const uint32_t *x, size_t n, const uint14_divisor_t *d);
+void uint14_mod_batch(uint16_t *r, const uint32_t *x, size_t n, const uint14_divisor_t *d);
+void uint14_freeze_batch(int16_t *r, const int16_t *x, size_t n, const uint14_divisor_t *d);
+
+#endif
@@ -0,0 +1,175 @@
+#include "encode.h"
+
+/**
+ * This source can be used to encode the Rq and Rounded polynomials, i.e. it
+ * replaces Encode() of the reference implementation for the case where all p
+ * integers share the same radix m. Then every level of Encode() consists of
+ * pairs with the radices (m, m), apart from the last integer, which is either
+ * carried over or merged with a different radix. The radices of each level
+ * follow from p and m, which are constants, such that the fully unrolled levels
+ * do not depend on the inputs. The merges of the pairs with equal radices are
+ * vectorized in asm_encode.s, no recursion and no variable length arrays are
+ * used.
+ */
+
+/**
+ * @brief Write the lowest bytes of a merged integer until its radix is small.
+ *
+ * @details The same loop as in Encode(), it only depends on the public radix.
+ *
+ * @param[in, out] out The pointer to the next output byte
+ * @param[in] r The merged integer
+ * @param[in, out] m The radix of the merged integer
+ * @param[in] bound The radix below which no more bytes are written
+ * @return The remaining integer
+ */
+static inline uint32_t encode_bytes(unsigned char **out, uint32_t r, uint32_t *m, uint32_t bound)
+{
+    while (*m >= bound)
+    {
+        *(*out)++ = (unsigned char)r;
+        r >>= 8;
+        *m = (*m + 255) >> 8;
+    }
+
+    return r;
+}
+
+/**
+ * @brief Return the radix of a merged integer after its bytes are written.
+ *
+ * @param[in] m The radix of the merged integer
+ * @return The radix, less than 16384
+ */
+static inline uint32_t encode_radix(uint32_t m)
+{
+    while (m >= 16384)
+    {
+        m = (m + 255) >> 8;
+    }
+
+    return m;
+}
+
+/**
+ * @brief Encode p integers in 0, ..., m - 1 for a constant radix m.
+ *
+ * @details Each level merges the integers of R into those of R2 and swaps the
+ * two buffers. All but the last integer of a level have the radix m, the last
+ * one has the radix mlast. Since the function is inlined for a constant m and
+ * the loop is unrolled, the radices and the number of output bytes of every
+ * level are computed at compile time.
+ *
+ * For bottom = 1 the first level has already been merged by the caller, i.e.
+ * in holds its (p + 1) / 2 merged integers and their bytes have been written to
+ * the start of out. Since p is odd, the last integer of the first level is
+ * carried over and keeps the radix m.
+ *
+ * @param[out] out The encoded bytes
+ * @param[in] in The p integers, or the integers of level bottom
+ * @param[in] radix The radix of all integers, less than 16384
+ * @param[in] bottom The first level to merge, 0 or 1
+ */
+static inline __attribute__((always_inline)) void encode_const(unsigned char *out, const uint16_t *in, uint32_t radix, int bottom)
+{
+    uint16_t buffer[2][ENCODE_HALF] __attribute__((aligned(16)));
+    const uint16_t *R = in;
+    uint16_t *R2 = buffer[0];
+    uint32_t m = radix, mlast = radix, k, mk, r;
+    size_t len = NTRU_P, pairs, vectors, idx;
+
+    if (bottom == 1)
+    {
+        mk = m * m;
+        k = (mk >= 16384) + (((mk + 255) >> 8) >= 16384);
+        out += k * (len / 2);
+
+        m = encode_radix(mk);
+        len = (len + 1) / 2;
+    }
+
+#pragma GCC unroll 16
+    for (int level = bottom; level < ENCODE_LEVELS; level++)
+    {
+        pairs = len / 2;
+
+        /* The number of bytes per pair with the radices (m, m) */
+
+        mk = m * m;
+        k = (mk >= 16384) + (((mk + 255) >> 8) >= 16384);
+
+        /* With an even length the last pair has the radices (m, mlast) */
+
+        vectors = (pairs - (len % 2 == 0)) & ~(size_t)7;
+
+        if (vectors > 0)
+        {
+            __asm_encode_merge(out, R2, R, (int32_t)vectors, (int32_t)m, (int32_t)k);
+            out += k * vectors;
+        }
+
+        for (idx = vectors; idx < pairs; idx++)
+        {
+            r = R[2 * idx] + R[2 * idx + 1] * m;
+            mk = m * (idx == pairs - 1 && len % 2 == 0 ? mlast : m);
+            R2[idx] = (uint16_t)encode_bytes(&out, r, &mk, 16384);
+        }
+
+        if (len % 2 == 0)
+        {
+            mlast = mk;
+        }
+        else
+        {
+            R2[pairs] = R[len - 1];
+        }
+
+        m = encode_radix(m * m);
+
+        len = (len + 1) / 2;
+        R = R2;
+        R2 = buffer[(level + 1) % 2];
+    }
+
+    /* The last integer is written until its radix is 1 */
+
+    encode_bytes(&out, R[0], &mlast, 2);
+}
+
+/**
+ * @brief Encode an Rq polynomial, i.e. p integers in 0, ..., q - 1.
+ *
+ * @param[out] out The encoded polynomial
+ * @param[in] R The p integers
+ */
+void encode761_rq(unsigned char *out, const uint16_t *R)
+{
+    encode_const(out, R, NTRU_Q, 0);
+}
+
+/**
+ * @brief Encode a Rounded polynomial, i.e. p integers in 0, ..., (q - 1) / 3.
+ *
+ * @param[out] out The encoded polynomial
+ * @param[in] R The p integers
+ */
+void encode761_rounded(unsigned char *out, const uint16_t *R)
+{
+    encode_const(out, R, (NTRU_Q + 2) / 3, 0);
+}
+
+/**
+ * @brief Encode the merged integers of the first level of a Rounded polynomial.
+ *
+ * @details This function is equal to encode761_rounded(), except that the first
+ * level has already been merged by the caller, see
+ * __asm_reduce_terms_rounded_761(). Its p / 2 pairs take the first bytes of the
+ * encoded polynomial.
+ *
+ * @param[in, out] out The encoded polynomial, whose first p / 2 bytes are given
+ * @param[in] R2 The ENCODE_HALF merged integers
+ */
+void encode761_rounded_l1(unsigned char *out, const uint16_t *R2)
+{
+    encode_const(out, R2, (NTRU_Q + 2) / 3, 1);
+}
@@ -0,0 +1,43 @@
+#ifndef ENCODE_H
+#define ENCODE_H
+
+/**
+ * This header accompanies encode.c and asm_encode.s. It is used to contain the
+ * encoders of the Rq and Rounded polynomials and the wrapper for their
+ * vectorized merges. As you can see it has been defined as a Once-Only Header to
+ * avoid the compiler from processing the contents twice.
+ */
+
+/* Include system header files */
+
+#include <stddef.h>
+#include <stdint.h>
+
+/* Include user header files */
+
+#include "ntt_params.h"
+
+/**
+ * @brief Merge n pairs of integers with the same radices.
+ *
+ * @details This function can be used to compute the pairwise merges of a single
+ * level of Encode(), as long as all n pairs have the radices (m, m). Every pair
+ * is merged into r = R[2i] + R[2i + 1] · m, of which the lowest k bytes are
+ * written to out and the remaining r >> 8k to R2[i].
+ *
+ * @param[out] out The n · k output bytes
+ * @param[out] R2 The n merged integers
+ * @param[in] R The 2n integers in 0, ..., m - 1
+ * @param[in] n The number of pairs, a multiple of 8
+ * @param[in] m The radix of all integers
+ * @param[in] k The number of output bytes per pair, 0, 1 or 2
+ */
+extern void __asm_encode_merge(unsigned char *out, uint16_t *R2, const uint16_t *R, int32_t n, int32_t m, int32_t k);
+
+/* Provide function declarations */
+
+void encode761_rq(unsigned char *out, const uint16_t *R);
+void encode761_rounded(unsigned char *out, const uint16_t *R);
+void encode761_rounded_l1(unsigned char *out, const uint16_t *R2);
+
+#endif
@@ -57,3 +57,207 @@ void goods_inverse(int32_t *coefficients, int32_t forward[GP0][GP1])
         coefficients[idx] = forward[ntt][coef];
     }
 }
+
+/**
+ * @brief Perform the forward Good's permutation of a polynomial.
+ *
+ * @details These functions are the generic equivalents of
+ * __asm_goods_forward16() and __asm_goods_forward8(), which are specific to p =
+ * 761. The zero padding to size GPR is performed implicitly and the integer
+ * coefficients are sign extended to 32 bits.
+ *
+ * @param[out] forward Deconstructed smaller NTT friendly GP0xGP1 matrix.
+ * @param[in] coefficients The NTRU_P integer coefficients of the polynomial.
+ */
+void goods_forward16(int32_t forward[GP0][GP1], const int16_t *coefficients)
+{
+    unsigned int idx = 0;
+
+    for (; idx < NTRU_P; idx++)
+    {
+        forward[idx % GP0][idx % GP1] = coefficients[idx];
+    }
+
+    for (; idx < GPR; idx++)
+    {
+        forward[idx % GP0][idx % GP1] = 0;
+    }
+}
+
+void goods_forward8(int32_t forward[GP0][GP1], const int8_t *coefficients)
+{
+    unsigned int idx = 0;
+
+    for (; idx < NTRU_P; idx++)
+    {
+        forward[idx % GP0][idx % GP1] = coefficients[idx];
+    }
+
+    for (; idx < GPR; idx++)
+    {
+        forward[idx % GP0][idx % GP1] = 0;
+    }
+}
+
+/**
+ * @brief Perform the forward Good's permutation and the first forward NTT layer
+ * of a polynomial.
+ *
+ * @details These functions are the generic equivalents of
+ * __asm_goods_forward16_l1() and __asm_goods_forward8_l1(). The first layer
+ * computes (a, b) = (a + b, a - b) on the integer coefficients c and c + 256 of
+ * every row, whose indices in the size-GPR array are idx and idx + GPR / 2. As
+ * idx + GPR / 2 >= p, b is part of the zero padding if c < 256 and a is part of
+ * the zero padding otherwise. The layer therefore reduces to copying the
+ * integer coefficient idx, with a negative sign for b.
+ *
+ * @param[out] forward Deconstructed GP0xGP1 matrix after the first NTT layer.
+ * @param[in] coefficients The NTRU_P integer coefficients of the polynomial.
+ */
+void goods_forward16_l1(int32_t forward[GP0][GP1], const int16_t *coefficients)
+{
+    unsigned int idx = 0, ntt = 0, coef = 0;
+
+    for (; idx < NTRU_P; idx++)
+    {
+        ntt = idx % GP0;
+        coef = idx % (GP1 / 2);
+
+        forward[ntt][coef] = coefficients[idx];
+        forward[ntt][coef + GP1 / 2] = idx % GP1 < GP1 / 2 ? coefficients[idx] : -coefficients[idx];
+    }
+
+    for (; idx < GPR / 2; idx++)
+    {
+        ntt = idx % GP0;
+        coef = idx % (GP1 / 2);
+
+        forward[ntt][coef] = 0;
+        forward[ntt][coef + GP1 / 2] = 0;
+    }
+}
+
+void goods_forward8_l1(int32_t forward[GP0][GP1], const int8_t *coefficients)
+{
+    unsigned int idx = 0, ntt = 0, coef = 0;
+
+    for (; idx < NTRU_P; idx++)
+    {
+        ntt = idx % GP0;
+        coef = idx % (GP1 / 2);
+
+        forward[ntt][coef] = coefficients[idx];
+        forward[ntt][coef + GP1 / 2] = idx % GP1 < GP1 / 2 ? coefficients[idx] : -coefficients[idx];
+    }
+
+    for (; idx < GPR / 2; idx++)
+    {
+        ntt = idx % GP0;
+        coef = idx % (GP1 / 2);
+
+        forward[ntt][coef] = 0;
+        forward[ntt][coef + GP1 / 2] = 0;
+    }
+}
+
+/**
+ * @brief Weigh an integer coefficient mod NTT_Q in { - (M-1)/2, ..., (M-1)/2 }.
+ *
+ * @param[in] x The integer coefficient in { 0, ..., NTT_Q - 1 }
+ * @return The centered integer coefficient, i.e. the exact integer value
+ */
+static inline int32_t goods_center(int32_t x)
+{
+    return x - (NTT_Q & (((NTT_Q - 1) / 2 - x) >> 31));
+}
+
+/**
+ * @brief Undo Good's permutation and reduce the first n integer coefficients of
+ * the product mod (x^p - x - 1) and mod q.
+ *
+ * @details This function is the generic equivalent of __asm_reduce_terms_761()
+ * for n = p and of __asm_reduce_terms_low_761() for n = I.
+ * Every integer coefficient c[i] of the product is first weighed mod NTT_Q,
+ * which recovers its exact value. The terms x^p, ..., x^(2p-2) are then folded
+ * into the lower terms using x^p = x + 1, i.e. s = c[i] + c[i + p - 1] + c[i +
+ * p], and s is reduced mod NTRU_Q using a Barrett reduction with 2^44 / NTRU_Q
+ * rounded up. This is exact for s in { - 2^23, ..., 2^23 }. All steps are
+ * computed without branches on the integer coefficients.
+ *
+ * @param[out] fg The resulting n integer coefficients
+ * @param[in] forward The GP0xGP1 matrix with integer coefficients in { 0, ...,
+ * NTT_Q - 1 }
+ * @param[in] n The number of integer coefficients, at most NTRU_P
+ */
+void goods_reduce_terms_low(int16_t *fg, int32_t forward[GP0][GP1], unsigned int n)
+{
+    const uint64_t m = ((1ULL << 44) + NTRU_Q - 1) / NTRU_Q;
+
+    for (unsigned int idx = 0; idx < n; idx++)
+    {
+        unsigned int lo = idx + NTRU_P - 1, hi = idx + NTRU_P;
+        int32_t s = goods_center(forward[idx % GP0][idx % GP1]);
+
+        /* For i = 0 the index i + p - 1 refers to the lower term c[p - 1],
+         * which must not be folded */
+        if (idx > 0)
+        {
+            s += goods_center(forward[lo % GP0][lo % GP1]);
+        }
+
+        s += goods_center(forward[hi % GP0][hi % GP1]);
+
+        uint32_t y = (uint32_t)(s + (NTRU_Q - 1) / 2 + NTRU_Q * (1 << 11));
+        uint32_t t = (uint32_t)(((uint64_t)y * m) >> 44);
+
+        fg[idx] = (int16_t)((int32_t)(y - t * NTRU_Q) - (NTRU_Q - 1) / 2);
+    }
+}
+
+/**
+ * @brief Undo Good's permutation and reduce the product mod (x^p - x - 1) and
+ * mod q.
+ *
+ * @param[out] fg The resulting NTRU_P integer coefficients
+ * @param[in] forward The GP0xGP1 matrix with integer coefficients in { 0, ...,
+ * NTT_Q - 1 }
+ */
+void goods_reduce_terms(int16_t *fg, int32_t forward[GP0][GP1])
+{
+    goods_reduce_terms_low(fg, forward, NTRU_P);
+}
+
+/**
+ * @brief Undo Good's permutation and reduce the product of two small
+ * polynomials mod (x^p - x - 1) and mod 3.
+ *
+ * @details This function is the generic equivalent of __asm_reduce_terms3_761()
+ * and computes the same folded sums s as goods_reduce_terms(). The integer
+ * coefficients of a product of two small polynomials are at most p in absolute
+ * value, so y = s + 1 + 3 · 2^12 is in { 0, ..., 2^15 - 1 } and is reduced mod 3
+ * using a Barrett reduction with 2^16 / 3 rounded up.
+ *
+ * @param[out] fg The resulting NTRU_P integer coefficients in { -1, 0, 1 }
+ * @param[in] forward The GP0xGP1 matrix with integer coefficients in { 0, ...,
+ * NTT_Q - 1 }
+ */
+void goods_reduce_terms3(int8_t *fg, int32_t forward[GP0][GP1])
+{
+    for (unsigned int idx = 0; idx < NTRU_P; idx++)
+    {
+        unsigned int lo = idx + NTRU_P - 1, hi = idx + NTRU_P;
+        int32_t s = goods_center(forward[idx % GP0][idx % GP1]);
+
+        if (idx > 0)
+        {
+            s += goods_center(forward[lo % GP0][lo % GP1]);
+        }
+
+        s += goods_center(forward[hi % GP0][hi % GP1]);
+
+        uint32_t y = (uint32_t)(s + 1 + 3 * (1 << 12));
+        uint32_t t = (y * 21846) >> 16;
+
+        fg[idx] = (int8_t)((int32_t)(y - t * 3) - 1);
+    }
+}
@@ -21,4 +21,14 @@ void goods_forward(int32_t forward[GP0][GP1], int32_t *coefficients);
 
 void goods_inverse(int32_t *coefficients, int32_t forward[GP0][GP1]);
 
+void goods_forward16(int32_t forward[GP0][GP1], const int16_t *coefficients);
+void goods_forward8(int32_t forward[GP0][GP1], const int8_t *coefficients);
+
+void goods_forward16_l1(int32_t forward[GP0][GP1], const int16_t *coefficients);
+void goods_forward8_l1(int32_t forward[GP0][GP1], const int8_t *coefficients);
+
+void goods_reduce_terms(int16_t *fg, int32_t forward[GP0][GP1]);
+void goods_reduce_terms_low(int16_t *fg, int32_t forward[GP0][GP1], unsigned int n);
+void goods_reduce_terms3(int8_t *fg, int32_t forward[GP0][GP1]);
+
 #endif
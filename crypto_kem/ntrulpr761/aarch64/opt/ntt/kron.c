@@ -0,0 +1,335 @@
+#include "kron.h"
+
+/* The Kronecker substitution is specific to p = 761, see ntt_params.h */
+
+#if NTRU_P == 761
+
+/**
+ * This source can be used to perform polynomial multiplication using Kronecker
+ * substitution, as an alternative to the NTT based multiplication in mult.c. We
+ * are computing:
+ *
+ * poly_one * poly_two % (x^761 - x - 1) % 4591
+ *
+ * Both polynomials are evaluated at 2^KRON_B, the resulting big integers are
+ * multiplied and the integer coefficients of the product are read back as
+ * signed digits. No tables are needed, the only primitive is the 64x64 -> 128
+ * bit multiplication, which compiles to mul and umulh. All loops only depend on
+ * the sizes, i.e. the multiplication runs in constant time.
+ */
+
+#define KRON_PRODUCT (2 * KRON_LIMBS)
+
+/**
+ * @brief Reduce an integer coefficient mod NTRU_Q in constant time.
+ *
+ * @details The same exact Barrett reduction as used in toom.c, which is correct
+ * for integer coefficients in { -2^29, ..., 2^29 }.
+ *
+ * @param[in] x The integer coefficient
+ * @return The integer coefficient x mod NTRU_Q in { -q/2, ..., q/2 }
+ */
+static inline int16_t kron_freeze(int32_t x)
+{
+    uint32_t y = (uint32_t)x + (NTRU_Q - 1) / 2 + NTRU_Q * (1U << 17);
+    uint32_t t = (uint32_t)(((uint64_t)y * 3831885438U) >> 44);
+
+    return (int16_t)((int32_t)(y - t * NTRU_Q) - (NTRU_Q - 1) / 2);
+}
+
+/**
+ * @brief Add two big integers of n limbs and return the carry.
+ */
+static uint64_t kron_add(uint64_t *r, const uint64_t *a, const uint64_t *b, size_t n)
+{
+    unsigned __int128 t = 0;
+
+    for (size_t i = 0; i < n; i++)
+    {
+        t = (unsigned __int128)a[i] + b[i] + (uint64_t)(t >> 64);
+        r[i] = (uint64_t)t;
+    }
+
+    return (uint64_t)(t >> 64);
+}
+
+/**
+ * @brief Subtract two big integers of n limbs and return the borrow.
+ */
+static uint64_t kron_sub(uint64_t *r, const uint64_t *a, const uint64_t *b, size_t n)
+{
+    uint64_t borrow = 0;
+
+    for (size_t i = 0; i < n; i++)
+    {
+        unsigned __int128 t = (unsigned __int128)a[i] - b[i] - borrow;
+        r[i] = (uint64_t)t;
+        borrow = (uint64_t)(t >> 64) & 1;
+    }
+
+    return borrow;
+}
+
+/**
+ * @brief Negate a big integer of n limbs if the mask is set.
+ *
+ * @param[in, out] a The big integer in two's complement
+ * @param[in] mask The mask, either 0 or all ones
+ * @param[in] n The number of limbs
+ */
+static void kron_negate(uint64_t *a, uint64_t mask, size_t n)
+{
+    unsigned __int128 t = mask & 1;
+
+    for (size_t i = 0; i < n; i++)
+    {
+        t += a[i] ^ mask;
+        a[i] = (uint64_t)t;
+        t >>= 64;
+    }
+}
+
+/**
+ * @brief Compute the schoolbook product of two big integers of n limbs.
+ *
+ * @param[out] r The resulting 2n limbs
+ * @param[in] a The n limbs of a
+ * @param[in] b The n limbs of b
+ * @param[in] n The number of limbs
+ */
+static void kron_schoolbook(uint64_t *r, const uint64_t *a, const uint64_t *b, size_t n)
+{
+    for (size_t i = 0; i < 2 * n; i++)
+    {
+        r[i] = 0;
+    }
+
+    for (size_t i = 0; i < n; i++)
+    {
+        uint64_t carry = 0;
+
+        for (size_t j = 0; j < n; j++)
+        {
+            unsigned __int128 t = (unsigned __int128)a[i] * b[j] + r[i + j] + carry;
+            r[i + j] = (uint64_t)t;
+            carry = (uint64_t)(t >> 64);
+        }
+
+        r[i + n] = carry;
+    }
+}
+
+/**
+ * @brief Compute the Karatsuba product of two big integers of n limbs.
+ *
+ * @details The halves of n/2 limbs are split as a = a0 + a1 · B and b = b0 +
+ * b1 · B with B = 2^(64 · n/2), such that a · b = z0 + (z1 - z0 - z2) · B +
+ * z2 · B^2 with z0 = a0 · b0, z2 = a1 · b1 and z1 = (a0 + a1) · (b0 + b1). The
+ * carries ca and cb of the sums are applied using masks, i.e. z1 = s · t + B ·
+ * (ca · t + cb · s) + B^2 · ca · cb, where s and t are the sums without their
+ * carries.
+ *
+ * @param[out] r The resulting 2n limbs
+ * @param[in] a The n limbs of a
+ * @param[in] b The n limbs of b
+ * @param[in] n The number of limbs, divisible by 2^level
+ * @param[in] level The number of remaining levels of Karatsuba
+ */
+static void kron_karatsuba(uint64_t *r, const uint64_t *a, const uint64_t *b, size_t n, int level)
+{
+    size_t h = n / 2;
+
+    if (level == 0)
+    {
+        kron_schoolbook(r, a, b, n);
+        return;
+    }
+
+    uint64_t s[h], t[h], z1[n + 1];
+
+    kron_karatsuba(r, a, b, h, level - 1);
+    kron_karatsuba(r + n, a + h, b + h, h, level - 1);
+
+    uint64_t ca = kron_add(s, a, a + h, h);
+    uint64_t cb = kron_add(t, b, b + h, h);
+
+    kron_karatsuba(z1, s, t, h, level - 1);
+    z1[n] = ca & cb;
+
+    /* Add the masked sums ca · t and cb · s at B */
+
+    uint64_t mask_a = -ca, mask_b = -cb;
+    unsigned __int128 acc = 0;
+
+    for (size_t i = 0; i < h; i++)
+    {
+        acc += (unsigned __int128)z1[h + i] + (t[i] & mask_a) + (s[i] & mask_b);
+        z1[h + i] = (uint64_t)acc;
+        acc >>= 64;
+    }
+
+    z1[n] += (uint64_t)acc;
+
+    /* Subtract z0 and z2, the difference is non-negative and fits in n + 1
+     * limbs, and add it to r at B */
+
+    uint64_t borrow = kron_sub(z1, z1, r, n);
+    z1[n] -= borrow;
+    borrow = kron_sub(z1, z1, r + n, n);
+    z1[n] -= borrow;
+
+    uint64_t carry = kron_add(r + h, r + h, z1, n + 1);
+
+    for (size_t i = h + n + 1; i < 2 * n; i++)
+    {
+        unsigned __int128 u = (unsigned __int128)r[i] + carry;
+        r[i] = (uint64_t)u;
+        carry = (uint64_t)(u >> 64);
+    }
+}
+
+/**
+ * @brief Evaluate a polynomial at 2^KRON_B.
+ *
+ * @details The integer coefficients are accumulated as a two's complement big
+ * integer, of which the absolute value and the sign mask are stored.
+ *
+ * @param[out] out The transformed polynomial of KRON_WORDS words
+ * @param[in] coefficients The 761 integer coefficients
+ * @param[in] size The size of an integer coefficient in bytes, 1 or 2
+ */
+static void kron761_pack(uint64_t out[KRON_WORDS], const void *coefficients, size_t size)
+{
+    __int128 acc = 0;
+    size_t bits = 0, limb = 0;
+
+    for (size_t i = 0; i < NTRU_P; i++)
+    {
+        int32_t c = size == 1 ? ((const int8_t *)coefficients)[i] : ((const int16_t *)coefficients)[i];
+
+        acc += (__int128)c * ((__int128)1 << bits);
+        bits += KRON_B;
+
+        if (bits >= 64)
+        {
+            out[limb++] = (uint64_t)acc;
+            acc >>= 64;
+            bits -= 64;
+        }
+    }
+
+    while (limb < KRON_LIMBS)
+    {
+        out[limb++] = (uint64_t)acc;
+        acc >>= 64;
+    }
+
+    out[KRON_LIMBS] = (uint64_t)((int64_t)out[KRON_LIMBS - 1] >> 63);
+    kron_negate(out, out[KRON_LIMBS], KRON_LIMBS);
+}
+
+/**
+ * @brief Transform a small polynomial for the Kronecker substitution.
+ *
+ * @param[out] g_kron The small polynomial g evaluated at 2^KRON_B
+ * @param[in] g The 761 integer coefficients of the small polynomial g
+ */
+void kron761_forward_small(uint64_t g_kron[KRON_WORDS], const int8_t *g)
+{
+    kron761_pack(g_kron, g, 1);
+}
+
+/**
+ * @brief Transform a polynomial for the Kronecker substitution.
+ *
+ * @param[out] f_kron The polynomial f evaluated at 2^KRON_B
+ * @param[in] f The 761 integer coefficients of the polynomial f
+ */
+void kron761_forward(uint64_t f_kron[KRON_WORDS], const int16_t *f)
+{
+    kron761_pack(f_kron, f, 2);
+}
+
+/**
+ * @brief Multiply two polynomials transformed for the Kronecker substitution.
+ *
+ * @details The absolute values are multiplied and the product is negated if
+ * the signs differ. The 1521 integer coefficients are then read as signed
+ * KRON_B bit digits, i.e. a digit d >= 2^(KRON_B - 1) stands for d - 2^KRON_B
+ * and borrows from the next digit. Finally the product is reduced mod (x^761 -
+ * x - 1) and mod NTRU_Q.
+ *
+ * @param[out] fg The resulting 761 integer coefficients
+ * @param[in] f_kron The polynomial f evaluated at 2^KRON_B
+ * @param[in] g_kron The small polynomial g evaluated at 2^KRON_B
+ */
+void kron761_product(int16_t *fg, const uint64_t f_kron[KRON_WORDS], const uint64_t g_kron[KRON_WORDS])
+{
+    uint64_t prod[KRON_PRODUCT];
+    int32_t C_mat[2 * NTRU_P] = {0};
+    __int128 acc = 0;
+    size_t bits = 0, limb = 0;
+
+    kron_karatsuba(prod, f_kron, g_kron, KRON_LIMBS, KRON_LEVELS);
+    kron_negate(prod, f_kron[KRON_LIMBS] ^ g_kron[KRON_LIMBS], KRON_PRODUCT);
+
+    for (size_t i = 0; i < 2 * NTRU_P - 1; i++)
+    {
+        if (bits < KRON_B)
+        {
+            acc += (__int128)((unsigned __int128)prod[limb++] << bits);
+            bits += 64;
+        }
+
+        /* Sign extend the lowest KRON_B bits */
+        int32_t c = (int32_t)((uint32_t)acc << (32 - KRON_B)) >> (32 - KRON_B);
+
+        C_mat[i] = c;
+        acc = (acc - c) >> KRON_B;
+        bits -= KRON_B;
+    }
+
+    /**
+     * @brief Reduce the product mod (x^761 - x - 1).
+     *
+     * The product has degree at most 1520, such that x^(761 + i) = x^(i + 1) +
+     * x^i has to be applied only once. The last entry of C_mat stays zero.
+     */
+
+    fg[0] = kron_freeze(C_mat[0] + C_mat[NTRU_P]);
+
+    for (size_t i = 1; i < NTRU_P; i++)
+    {
+        fg[i] = kron_freeze(C_mat[i] + C_mat[i + NTRU_P - 1] + C_mat[i + NTRU_P]);
+    }
+}
+
+/**
+ * @brief Multiply a polynomial with a transformed small polynomial.
+ *
+ * @details This function is the Kronecker substitution equivalent of
+ * ntt761_shared().
+ *
+ * @param[out] fg The resulting 761 integer coefficients
+ * @param[in] f The 761 integer coefficients of the polynomial f
+ * @param[in] g_kron The small polynomial g evaluated at 2^KRON_B
+ */
+void kron761_shared(int16_t *fg, const int16_t *f, const uint64_t g_kron[KRON_WORDS])
+{
+    uint64_t A_mat[KRON_WORDS];
+
+    kron761_forward(A_mat, f);
+    kron761_product(fg, A_mat, g_kron);
+}
+
+/* Function for computing poly_one * poly_two % (x^761 - x - 1) % 4591 using
+ * Kronecker substitution */
+void kron761(int16_t *fg, const int16_t *f, const int8_t *g)
+{
+    uint64_t B_mat[KRON_WORDS];
+
+    kron761_forward_small(B_mat, g);
+    kron761_shared(fg, f, B_mat);
+}
+
+#endif
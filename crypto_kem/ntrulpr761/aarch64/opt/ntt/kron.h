@@ -0,0 +1,28 @@
+#ifndef KRON_H
+#define KRON_H
+
+/**
+ * This header accompanies kron.c. It can be used to contain function
+ * declarations and macro definitions. As you can see it has been defined as a
+ * Once-Only Header to avoid the compiler from processing the contents twice.
+ */
+
+/* Include system header files */
+
+#include <stddef.h>
+#include <stdint.h>
+
+/* Include user header files */
+
+#include "ntt_params.h"
+
+/* Provide function declarations */
+
+void kron761(int16_t *fg, const int16_t *f, const int8_t *g);
+
+void kron761_forward(uint64_t f_kron[KRON_WORDS], const int16_t *f);
+void kron761_forward_small(uint64_t g_kron[KRON_WORDS], const int8_t *g);
+void kron761_product(int16_t *fg, const uint64_t f_kron[KRON_WORDS], const uint64_t g_kron[KRON_WORDS]);
+void kron761_shared(int16_t *fg, const int16_t *f, const uint64_t g_kron[KRON_WORDS]);
+
+#endif
@@ -16,12 +16,45 @@
 /* Include user header files */
 
 #include "ntt.h"
+#include "ntt16.h"
+#include "toom.h"
+#include "kron.h"
 #include "goods.h"
+#include "recip.h"
+#include "encode.h"
+#include "decode.h"
+#include "divide.h"
+#include "pack.h"
 #include "ntt_params.h"
 #include "util.h"
 
 /* Provide function declarations */
 
-void ntt761(int16_t *fg, int16_t *f, int8_t *g);
+void ntt761(int16_t *fg, const int16_t *f, const int8_t *g);
+void ntt761_ws(int16_t *fg, const int16_t *f, const int8_t *g, void *ws);
+void ntt761_rounded(unsigned char *s, const int16_t *f, const int8_t *g);
+
+void ntt761_forward(int32_t f_ntt[GP0][GP1], const int16_t *f);
+void ntt761_forward_rounded(int32_t f_ntt[GP0][GP1], const unsigned char *s);
+void ntt761_forward_small(int32_t g_ntt[GP0][GP1], const int8_t *g);
+void ntt761_product(int16_t *fg, const int32_t f_ntt[GP0][GP1], const int32_t g_ntt[GP0][GP1]);
+void ntt761_product_rounded(unsigned char *s, const int32_t f_ntt[GP0][GP1], const int32_t g_ntt[GP0][GP1]);
+void ntt761_product_low(int16_t *fg, const int32_t f_ntt[GP0][GP1], const int32_t g_ntt[GP0][GP1]);
+void ntt761_shared(int16_t *fg, const int16_t *f, const int32_t g_ntt[GP0][GP1]);
+void ntt761_full(int16_t *fg, const int16_t *f, const int8_t *g);
+void ntt761_r3(int8_t *fg, const int8_t *f, const int8_t *g);
+
+void ntt761_x4(int16_t *const fg[NTT_X4], const int16_t *const f[NTT_X4], const int8_t *const g[NTT_X4]);
+
+void ntt761_x4_forward(int32_t f_ntt[NTT_X4][GP0][GP1], const int16_t *const f[NTT_X4]);
+void ntt761_x4_forward_small(int32_t g_ntt[NTT_X4][GP0][GP1], const int8_t *const g[NTT_X4]);
+void ntt761_x4_product(int16_t *const fg[NTT_X4], const int32_t f_ntt[NTT_X4][GP0][GP1], const int32_t g_ntt[NTT_X4][GP0][GP1]);
+
+void ntt761_16(int16_t *fg, const int16_t *f, const int8_t *g);
+
+void ntt761_16_forward(int16_t f_ntt[NTT16_ROWS][GP1], const int16_t *f);
+void ntt761_16_forward_small(int16_t g_ntt[NTT16_ROWS][GP1], const int8_t *g);
+void ntt761_16_product(int16_t *fg, const int16_t f_ntt[NTT16_ROWS][GP1], const int16_t g_ntt[NTT16_ROWS][GP1]);
+void ntt761_16_shared(int16_t *fg, const int16_t *f, const int16_t g_ntt[NTT16_ROWS][GP1]);
 
 #endif // MAIN761_H
@@ -0,0 +1,104 @@
+#ifndef NTT16_H
+#define NTT16_H
+
+/**
+ * This header accompanies asm_ntt16_forward.s, asm_ntt16_inverse.s,
+ * asm_ntt16_base_multiply.s and asm_ntt16_crt.s. It is used to contain the
+ * wrappers for the 16 bit NTT transformations mod NTT16_Q0 and NTT16_Q1. As you
+ * can see it has been defined as a Once-Only Header to avoid the compiler from
+ * processing the contents twice.
+ */
+
+/* Include system header files */
+
+#include <stdint.h>
+
+/* Include user header files */
+
+#include "ntt_params.h"
+
+/**
+ * Define the precomputed (inverse) roots used in the 16 bit NTT transformations.
+ * Each table starts with the constant values { p, round(2^26 / p), p^-1 mod
+ * 2^16 } followed by the root pairs (w, round(w · 2^15 / p)) in the order in
+ * which they are loaded by the assembly routines.
+ */
+
+static const int16_t BR_7681[NTT16_ROOTS] = {7681, 8737, -7679, 0, 0, 0, 0, 0, 1, 4, 1, 4, -3383, -14432, 0, 0, 1, 4, 1, 4, -3383, -14432, 0, 0, -3383, -14432, 1213, 5175, -1925, -8212, 0, 0, 1213, 5175, -527, -2248, 849, 3622, 0, 0, -1925, -8212, -1728, -7372, 583, 2487, 0, 0, 1, 4, 1, 4, -3383, -14432, 0, 0, -3383, -14432, 1213, 5175, -1925, -8212, 0, 0, 1213, 5175, -527, -2248, 849, 3622, 0, 0, -1925, -8212, -1728, -7372, 583, 2487, 0, 0, -527, -2248, -1366, -5828, -2784, -11877, 0, 0, 849, 3622, 2138, 9121, 2648, 11297, 0, 0, -1728, -7372, -2132, -9095, 97, 414, 0, 0, 583, 2487, 2381, 10158, 2446, 10435, 0, 0, -1366, -5828, 2645, 11284, 330, 1408, 0, 0, -2784, -11877, -2273, -9697, 878, 3746, 0, 0, 2138, 9121, -3654, -15588, 2753, 11745, 0, 0, 2648, 11297, -365, -1557, -1846, -7875, 0, 0, -2132, -9095, -3000, -12798, 2399, 10234, 0, 0, 97, 414, 1794, 7653, -1112, -4744, 0, 0, 2381, 10158, -1286, -5486, 3092, 13191, 0, 0, 2446, 10435, -675, -2880, 2268, 9676, 0, 0, 1, -3383, 1213, -1925, -527, 849, -1728, 583, 4, -14432, 5175, -8212, -2248, 3622, -7372, 2487, 1, 1213, -527, -1728, -1366, 2138, -2132, 2381, 4, 5175, -2248, -7372, -5828, 9121, -9095, 10158, -3383, -1925, 849, 583, -2784, 2648, 97, 2446, -14432, -8212, 3622, 2487, -11877, 11297, 414, 10435, 1, -527, -1366, -2132, 2645, -3654, -3000, -1286, 4, -2248, -5828, -9095, 11284, -15588, -12798, -5486, -3383, 849, -2784, 97, 330, 2753, 2399, 3092, -14432, 3622, -11877, 414, 1408, 11745, 10234, 13191, 1213, -1728, 2138, 2381, -2273, -365, 1794, -675, 5175, -7372, 9121, 10158, -9697, -1557, 7653, -2880, -1925, 583, 2648, 2446, 878, -1846, -1112, 2268, -8212, 2487, 11297, 10435, 3746, -7875, -4744, 9676, -1366, -2784, 2138, 2648, -2132, 97, 2381, 2446, -5828, -11877, 9121, 11297, -9095, 414, 10158, 10435, 2645, -2273, -3654, -365, -3000, 1794, -1286, -675, 11284, -9697, -15588, -1557, -12798, 7653, -5486, -2880, 330, 878, 2753, -1846, 2399, -1112, 3092, 2268, 1408, 3746, 11745, -7875, 10234, -4744, 13191, 9676, -2423, 1875, -693, -3477, -2881, -2551, 2774, -2508, -10337, 7999, -2956, -14833, -12291, -10883, 11834, -10699, 1382, 1381, 1714, 3080, -766, -3411, 1740, -2941, 5896, 5891, 7312, 13140, -3268, -14552, 7423, -12547, 2724, 799, -3380, -732, 202, 1080, 584, -528, 11621, 3409, -14419, -3123, 862, 4607, 2491, -2253, 1908, 695, -2469, 3074, 243, 2516, -1655, -3449, 8140, 2965, -10533, 13114, 1037, 10734, -7060, -14714, 2645, 330, -2273, 878, -3654, 2753, -365, -1846, 11284, 1408, -9697, 3746, -15588, 11745, -1557, -7875, -2423, 2724, 1875, 799, -693, -3380, -3477, -732, -10337, 11621, 7999, 3409, -2956, -14419, -14833, -3123, 1382, 1908, 1381, 695, 1714, -2469, 3080, 3074, 5896, 8140, 5891, 2965, 7312, -10533, 13140, 13114, -1996, -405, -219, 198, -2573, -3566, -3180, 1402, -8515, -1728, -934, 845, -10977, -15213, -13566, 5981, 869, 2897, 3501, -1587, 1886, -3073, -3141, -3789, 3707, 12359, 14936, -6770, 8046, -13110, -13400, -16164, -1633, 319, 3188, 2063, -2563, -1155, -1478, 3125, -6967, 1361, 13600, 8801, -10934, -4927, -6305, 13332, 1800, -3837, -880, 2900, -1220, -2264, -257, -2819, 7679, -16369, -3754, 12372, -5205, -9658, -1096, -12026, -3000, 2399, 1794, -1112, -1286, 3092, -675, 2268, -12798, 10234, 7653, -4744, -5486, 13191, -2880, 9676, -2881, 202, -2551, 1080, 2774, 584, -2508, -528, -12291, 862, -10883, 4607, 11834, 2491, -10699, -2253, -766, 243, -3411, 2516, 1740, -1655, -2941, -3449, -3268, 1037, -14552, 10734, 7423, -7060, -12547, -14714, -2722, -1853, 648, -3532, -2593, -707, 1097, -2044, -11612, -7905, 2764, -15068, -11062, -3016, 4680, -8720, -993, 1003, -3099, -2880, 417, 2990, -1228, 1952, -4236, 4279, -13221, -12286, 1779, 12756, -5239, 8327, 1044, 2844, 2562, 1682, -3780, 2681, 1848, 1591, 4454, 12133, 10930, 7176, -16126, 11437, 7884, 6787, 1408, 3041, -3078, 1415, -1125, 1438, 550, 2028, 6007, 12973, -13131, 6037, -4799, 6135, 2346, 8652, -2423, 1382, 2724, 1908, 1875, 1381, 799, 695, -10337, 5896, 11621, 8140, 7999, 5891, 3409, 2965, -1996, -1633, -405, 319, -219, 3188, 198, 2063, -8515, -6967, -1728, 1361, -934, 13600, 845, 8801, 869, 1800, 2897, -3837, 3501, -880, -1587, 2900, 3707, 7679, 12359, -16369, 14936, -3754, -6770, 12372, -3626, -1667, -1129, 3546, 2799, -321, 1704, 669, -15469, -7112, -4816, 15128, 11941, -1369, 7269, 2854, 201, 1607, 1950, 1604, 1656, 2922, 3799, 2668, 857, 6856, 8319, 6843, 7065, 12466, 16207, 11382, 2875, -1968, -2259, -62, 185, 2358, 763, -2689, 12265, -8396, -9637, -264, 789, 10059, 3255, -11472, -1979, -1683, -398, 2359, -3694, 3445, -413, 2583, -8443, -7180, -1698, 10064, -15759, 14697, -1762, 11019, -693, 1714, -3380, -2469, -3477, 3080, -732, 3074, -2956, 7312, -14419, -10533, -14833, 13140, -3123, 13114, -2573, -2563, -3566, -1155, -3180, -1478, 1402, 3125, -10977, -10934, -15213, -4927, -13566, -6305, 5981, 13332, 1886, -1220, -3073, -2264, -3141, -257, -3789, -2819, 8046, -5205, -13110, -9658, -13400, -1096, -16164, -12026, -1266, -1065, 1131, 3081, 346, 2002, 3586, -296, -5401, -4543, 4825, 13144, 1476, 8541, 15298, -1263, -3120, 506, -1035, 94, -3006, 1876, -3139, 2838, -13310, 2159, -4415, 401, -12824, 8003, -13391, 12107, 542, -1437, -2996, -3394, -2757, 1230, 2372, 1959, 2312, -6130, -12781, -14479, -11762, 5247, 10119, 8357, 2173, -702, -3452, -1193, 2197, 2012, 2169, 1406, 9270, -2995, -14727, -5089, 9373, 8583, 9253, 5998, -2881, -766, 202, 243, -2551, -3411, 1080, 2516, -12291, -3268, 862, 1037, -10883, -14552, 4607, 10734, -2722, 1044, -1853, 2844, 648, 2562, -3532, 1682, -11612, 4454, -7905, 12133, 2764, 10930, -15068, 7176, -993, 1408, 1003, 3041, -3099, -3078, -2880, 1415, -4236, 6007, 4279, 12973, -13221, -13131, -12286, 6037, 1994, 1459, 2951, -3615, -2717, 3193, 1499, 1170, 8507, 6224, 12589, -15422, -11591, 13622, 6395, 4991, -1784, 3086, 2067, 1393, -2546, -2433, -1657, -2395, -7611, 13165, 8818, 5943, -10862, -10379, -7069, -10217, -793, 3137, 217, 856, -572, 1885, -2110, -1775, -3383, 13383, 926, 3652, -2440, 8042, -9001, -7572, 2050, 2671, 3265, -111, -536, -1725, 2481, -1717, 8746, 11395, 13929, -474, -2287, -7359, 10584, -7325, 2774, 1740, 584, -1655, -2508, -2941, -528, -3449, 11834, 7423, 2491, -7060, -10699, -12547, -2253, -14714, -2593, -3780, -707, 2681, 1097, 1848, -2044, 1591, -11062, -16126, -3016, 11437, 4680, 7884, -8720, 6787, 417, -1125, 2990, 1438, -1228, 550, 1952, 2028, 1779, -4799, 12756, 6135, -5239, 2346, 8327, 8652, -113, -1897, 738, 2805, 674, -1872, 1036, -621, -482, -8093, 3148, 11966, 2875, -7986, 4420, -2649, -1771, -3765, -329, -3280, 1115, 3832, -2252, -3751, -7555, -16062, -1404, -13993, 4757, 16348, -9607, -16002, 1189, 3239, -3483, -218, 3376, 2840, -3016, -535, 5072, 13818, -14859, -930, 14402, 12116, -12867, -2282, 2457, 3250, 335, 118, 639, 1211, 2760, -2811, 10482, 13865, 1429, 503, 2726, 5166, 11774, -11992};
+static const int16_t BR_inv_7681[NTT16_ROOTS] = {7681, 8737, -7679, 0, 0, 0, 0, 0, 1, -583, -2446, -2648, -2268, 1112, 1846, -878, 4, -2487, -10435, -11297, -9676, 4744, 7875, -3746, 3383, 1728, -2381, -2138, 675, -1794, 365, 2273, 14432, 7372, -10158, -9121, 2880, -7653, 1557, 9697, 1925, -849, -97, 2784, -3092, -2399, -2753, -330, 8212, -3622, -414, 11877, -13191, -10234, -11745, -1408, -1213, 527, 2132, 1366, 1286, 3000, 3654, -2645, -5175, 2248, 9095, 5828, 5486, 12798, 15588, -11284, 1, 1925, -583, -849, -2446, -97, -2648, 2784, 4, 8212, -2487, -3622, -10435, -414, -11297, 11877, 3383, -1213, 1728, 527, -2381, 2132, -2138, 1366, 14432, -5175, 7372, 2248, -10158, 9095, -9121, 5828, 1, 3383, 1925, -1213, -583, 1728, -849, 527, 4, 14432, 8212, -5175, -2487, 7372, -3622, 2248, 3449, 1655, -2516, -243, -3074, 2469, -695, -1908, 14714, 7060, -10734, -1037, -13114, 10533, -2965, -8140, 528, -584, -1080, -202, 732, 3380, -799, -2724, 2253, -2491, -4607, -862, 3123, 14419, -3409, -11621, 2941, -1740, 3411, 766, -3080, -1714, -1381, -1382, 12547, -7423, 14552, 3268, -13140, -7312, -5891, -5896, 2508, -2774, 2551, 2881, 3477, 693, -1875, 2423, 10699, -11834, 10883, 12291, 14833, 2956, -7999, 10337, -2268, -3092, 1112, -2399, 1846, -2753, -878, -330, -9676, -13191, 4744, -10234, 7875, -11745, -3746, -1408, 675, 1286, -1794, 3000, 365, 3654, 2273, -2645, 2880, 5486, -7653, 12798, 1557, 15588, 9697, -11284, -2446, -2381, -97, 2132, -2648, -2138, 2784, 1366, -10435, -10158, -414, 9095, -11297, -9121, 11877, 5828, -2028, -550, -1438, 1125, -1415, 3078, -3041, -1408, -8652, -2346, -6135, 4799, -6037, 13131, -12973, -6007, -1591, -1848, -2681, 3780, -1682, -2562, -2844, -1044, -6787, -7884, -11437, 16126, -7176, -10930, -12133, -4454, -1952, 1228, -2990, -417, 2880, 3099, -1003, 993, -8327, 5239, -12756, -1779, 12286, 13221, -4279, 4236, 2044, -1097, 707, 2593, 3532, -648, 1853, 2722, 8720, -4680, 3016, 11062, 15068, -2764, 7905, 11612, 3449, 2941, 1655, -1740, -2516, 3411, -243, 766, 14714, 12547, 7060, -7423, -10734, 14552, -1037, 3268, 528, 2508, -584, -2774, -1080, 2551, -202, 2881, 2253, 10699, -2491, -11834, -4607, 10883, -862, 12291, -2268, 675, -3092, 1286, 1112, -1794, -2399, 3000, -9676, 2880, -13191, 5486, 4744, -7653, -10234, 12798, 2819, 257, 2264, 1220, -2900, 880, 3837, -1800, 12026, 1096, 9658, 5205, -12372, 3754, 16369, -7679, -3125, 1478, 1155, 2563, -2063, -3188, -319, 1633, -13332, 6305, 4927, 10934, -8801, -13600, -1361, 6967, 3789, 3141, 3073, -1886, 1587, -3501, -2897, -869, 16164, 13400, 13110, -8046, 6770, -14936, -12359, -3707, -1402, 3180, 3566, 2573, -198, 219, 405, 1996, -5981, 13566, 15213, 10977, -845, 934, 1728, 8515, -3074, -3080, 2469, -1714, -695, -1381, -1908, -1382, -13114, -13140, 10533, -7312, -2965, -5891, -8140, -5896, 732, 3477, 3380, 693, -799, -1875, -2724, 2423, 3123, 14833, 14419, 2956, -3409, -7999, -11621, 10337, 1846, 365, -2753, 3654, -878, 2273, -330, -2645, 7875, 1557, -11745, 15588, -3746, 9697, -1408, -11284, 2811, -2760, -1211, -639, -118, -335, -3250, -2457, 11992, -11774, -5166, -2726, -503, -1429, -13865, -10482, 535, 3016, -2840, -3376, 218, 3483, -3239, -1189, 2282, 12867, -12116, -14402, 930, 14859, -13818, -5072, 3751, 2252, -3832, -1115, 3280, 329, 3765, 1771, 16002, 9607, -16348, -4757, 13993, 1404, 16062, 7555, 621, -1036, 1872, -674, -2805, -738, 1897, 113, 2649, -4420, 7986, -2875, -11966, -3148, 8093, 482, -2028, -1952, -550, 1228, -1438, -2990, 1125, -417, -8652, -8327, -2346, 5239, -6135, -12756, 4799, -1779, -1591, 2044, -1848, -1097, -2681, 707, 3780, 2593, -6787, 8720, -7884, -4680, -11437, 3016, 16126, 11062, 3449, 528, 2941, 2508, 1655, -584, -1740, -2774, 14714, 2253, 12547, 10699, 7060, -2491, -7423, -11834, 1717, -2481, 1725, 536, 111, -3265, -2671, -2050, 7325, -10584, 7359, 2287, 474, -13929, -11395, -8746, 1775, 2110, -1885, 572, -856, -217, -3137, 793, 7572, 9001, -8042, 2440, -3652, -926, -13383, 3383, 2395, 1657, 2433, 2546, -1393, -2067, -3086, 1784, 10217, 7069, 10379, 10862, -5943, -8818, -13165, 7611, -1170, -1499, -3193, 2717, 3615, -2951, -1459, -1994, -4991, -6395, -13622, 11591, 15422, -12589, -6224, -8507, -1415, 2880, 3078, 3099, -3041, -1003, -1408, 993, -6037, 12286, 13131, 13221, -12973, -4279, -6007, 4236, -1682, 3532, -2562, -648, -2844, 1853, -1044, 2722, -7176, 15068, -10930, -2764, -12133, 7905, -4454, 11612, -2516, -1080, 3411, 2551, -243, -202, 766, 2881, -10734, -4607, 14552, 10883, -1037, -862, 3268, 12291, -1406, -2169, -2012, -2197, 1193, 3452, 702, -2173, -5998, -9253, -8583, -9373, 5089, 14727, 2995, -9270, -1959, -2372, -1230, 2757, 3394, 2996, 1437, -542, -8357, -10119, -5247, 11762, 14479, 12781, 6130, -2312, -2838, 3139, -1876, 3006, -94, 1035, -506, 3120, -12107, 13391, -8003, 12824, -401, 4415, -2159, 13310, 296, -3586, -2002, -346, -3081, -1131, 1065, 1266, 1263, -15298, -8541, -1476, -13144, -4825, 4543, 5401, 2819, 3789, 257, 3141, 2264, 3073, 1220, -1886, 12026, 16164, 1096, 13400, 9658, 13110, 5205, -8046, -3125, -1402, 1478, 3180, 1155, 3566, 2563, 2573, -13332, -5981, 6305, 13566, 4927, 15213, 10934, 10977, -3074, 732, -3080, 3477, 2469, 3380, -1714, 693, -13114, 3123, -13140, 14833, 10533, 14419, -7312, 2956, -2583, 413, -3445, 3694, -2359, 398, 1683, 1979, -11019, 1762, -14697, 15759, -10064, 1698, 7180, 8443, 2689, -763, -2358, -185, 62, 2259, 1968, -2875, 11472, -3255, -10059, -789, 264, 9637, 8396, -12265, -2668, -3799, -2922, -1656, -1604, -1950, -1607, -201, -11382, -16207, -12466, -7065, -6843, -8319, -6856, -857, -669, -1704, 321, -2799, -3546, 1129, 1667, 3626, -2854, -7269, 1369, -11941, -15128, 4816, 7112, 15469, -2900, 1587, 880, -3501, 3837, -2897, -1800, -869, -12372, 6770, 3754, -14936, 16369, -12359, -7679, -3707, -2063, -198, -3188, 219, -319, 405, 1633, 1996, -8801, -845, -13600, 934, -1361, 1728, 6967, 8515, -695, -799, -1381, -1875, -1908, -2724, -1382, 2423, -2965, -3409, -5891, -7999, -8140, -11621, -5896, 10337, 1, 4, 3383, 14432, 1, 4, 0, 0, 1925, 8212, -1213, -5175, 3383, 14432, 0, 0, -583, -2487, 1728, 7372, 1925, 8212, 0, 0, -849, -3622, 527, 2248, -1213, -5175, 0, 0, -2446, -10435, -2381, -10158, -583, -2487, 0, 0, -97, -414, 2132, 9095, 1728, 7372, 0, 0, -2648, -11297, -2138, -9121, -849, -3622, 0, 0, 2784, 11877, 1366, 5828, 527, 2248, 0, 0, -2268, -9676, 675, 2880, -2446, -10435, 0, 0, -3092, -13191, 1286, 5486, -2381, -10158, 0, 0, 1112, 4744, -1794, -7653, -97, -414, 0, 0, -2399, -10234, 3000, 12798, 2132, 9095, 0, 0, 1846, 7875, 365, 1557, -2648, -11297, 0, 0, -2753, -11745, 3654, 15588, -2138, -9121, 0, 0, -878, -3746, 2273, 9697, 2784, 11877, 0, 0, -330, -1408, -2645, -11284, 1366, 5828, 0, 0, 1, 4, 3383, 14432, 1, 4, 0, 0, 1925, 8212, -1213, -5175, 3383, 14432, 0, 0, -583, -2487, 1728, 7372, 1925, 8212, 0, 0, -849, -3622, 527, 2248, -1213, -5175, 0, 0, 1, 4, 3383, 14432, 1, 4, 0, 0};
+
+static const int16_t BR_12289[NTT16_ROOTS] = {12289, 5461, -12287, 0, 0, 0, 0, 0, 1, 3, 1, 3, 1479, 3944, 0, 0, 1, 3, 1, 3, 1479, 3944, 0, 0, 1479, 3944, -4043, -10780, 5146, 13722, 0, 0, -4043, -10780, 4134, 11023, -5736, -15295, 0, 0, 5146, 13722, -722, -1925, 1305, 3480, 0, 0, 1, 3, 1, 3, 1479, 3944, 0, 0, 1479, 3944, -4043, -10780, 5146, 13722, 0, 0, -4043, -10780, 4134, 11023, -5736, -15295, 0, 0, 5146, 13722, -722, -1925, 1305, 3480, 0, 0, 4134, 11023, 5860, 15625, 3195, 8519, 0, 0, -5736, -15295, 1212, 3232, -1646, -4389, 0, 0, -722, -1925, 3621, 9655, -2545, -6786, 0, 0, 1305, 3480, -3504, -9343, 3542, 9445, 0, 0, 5860, 15625, -4978, -13274, -1351, -3602, 0, 0, 3195, 8519, -3328, -8874, 5777, 15404, 0, 0, 1212, 3232, 5023, 13394, -5828, -15540, 0, 0, -1646, -4389, 5728, 15273, 4591, 12242, 0, 0, 3621, 9655, 3006, 8015, -2744, -7317, 0, 0, -2545, -6786, 563, 1501, -2975, -7933, 0, 0, -3504, -9343, 2625, 6999, -949, -2530, 0, 0, 3542, 9445, 4821, 12855, 2639, 7037, 0, 0, 1, 1479, -4043, 5146, 4134, -5736, -722, 1305, 3, 3944, -10780, 13722, 11023, -15295, -1925, 3480, 1, -4043, 4134, -722, 5860, 1212, 3621, -3504, 3, -10780, 11023, -1925, 15625, 3232, 9655, -9343, 1479, 5146, -5736, 1305, 3195, -1646, -2545, 3542, 3944, 13722, -15295, 3480, 8519, -4389, -6786, 9445, 1, 4134, 5860, 3621, -4978, 5023, 3006, 2625, 3, 11023, 15625, 9655, -13274, 13394, 8015, 6999, 1479, -5736, 3195, -2545, -1351, -5828, -2744, -949, 3944, -15295, 8519, -6786, -3602, -15540, -7317, -2530, -4043, -722, 1212, -3504, -3328, 5728, 563, 4821, -10780, -1925, 3232, -9343, -8874, 15273, 1501, 12855, 5146, 1305, -1646, 3542, 5777, 4591, -2975, 2639, 13722, 3480, -4389, 9445, 15404, 12242, -7933, 7037, 5860, 3195, 1212, -1646, 3621, -2545, -3504, 3542, 15625, 8519, 3232, -4389, 9655, -6786, -9343, 9445, -4978, -3328, 5023, 5728, 3006, 563, 2625, 4821, -13274, -8874, 13394, 15273, 8015, 1501, 6999, 12855, -1351, 5777, -5828, 4591, -2744, -2975, -949, 2639, -3602, 15404, -15540, 12242, -7317, -7933, -2530, 7037, -140, -1177, 2963, -3091, -3553, -2747, -3014, 1170, -373, -3138, 7901, -8242, -9474, -7325, -8037, 3120, 1853, 4255, -4896, -81, 4805, 4846, 3201, -2319, 4941, 11346, -13055, -216, 12812, 12922, 8535, -6183, 726, 2768, 2366, -1000, -1062, -3135, -5086, 955, 1936, 7381, 6309, -2666, -2832, -8359, -13562, 2546, 4611, 1635, -3051, -4320, 2294, -3712, -1326, -790, 12295, 4360, -8135, -11519, 6117, -9898, -3536, -2106, -4978, -1351, -3328, 5777, 5023, -5828, 5728, 4591, -13274, -3602, -8874, 15404, 13394, -15540, 15273, 12242, -140, 726, -1177, 2768, 2963, 2366, -3091, -1000, -373, 1936, -3138, 7381, 7901, 6309, -8242, -2666, 1853, 4611, 4255, 1635, -4896, -3051, -81, -4320, 4941, 12295, 11346, 4360, -13055, -8135, -216, -11519, -3949, -5374, -953, 5067, -4278, -1381, 480, 5791, -10530, -14330, -2541, 13511, -11407, -3682, 1280, 15441, -3296, 2837, 3748, -2197, 1673, -2525, -2842, -544, -8789, 7565, 9994, -5858, 4461, -6733, -7578, -1451, 2396, 130, -5767, -118, 5331, 4177, 1022, -2468, 6389, 347, -15377, -315, 14215, 11138, 2725, -6581, 4452, -4354, -827, -2476, -4989, -3584, -9, -339, 11871, -11610, -2205, -6602, -13303, -9557, -24, -904, 3006, -2744, 563, -2975, 2625, -949, 4821, 2639, 8015, -7317, 1501, -7933, 6999, -2530, 12855, 7037, -3553, -1062, -2747, -3135, -3014, -5086, 1170, 955, -9474, -2832, -7325, -8359, -8037, -13562, 3120, 2546, 4805, 2294, 4846, -3712, 3201, -1326, -2319, -790, 12812, 6117, 12922, -9898, 8535, -3536, -6183, -2106, -145, 2731, -1759, 3382, -3241, -3284, -5755, 334, -387, 7282, -4690, 9018, -8642, -8757, -15345, 891, -5542, -3932, 3707, 355, -729, -2881, 4632, 2426, -14777, -10484, 9885, 947, -1944, -7682, 12351, 6469, -3637, -5911, -3694, 4231, 3289, 5092, 4388, 1428, -9698, -15761, -9850, 11282, 8770, 13578, 11700, 3808, 3459, -4890, 5179, 2548, -2013, -2089, 1260, -1696, 9223, -13039, 13810, 6794, -5368, -5570, 3360, -4522, -140, 1853, 726, 4611, -1177, 4255, 2768, 1635, -373, 4941, 1936, 12295, -3138, 11346, 7381, 4360, -3949, 2396, -5374, 130, -953, -5767, 5067, -118, -10530, 6389, -14330, 347, -2541, -15377, 13511, -315, -3296, 4452, 2837, -4354, 3748, -827, -2197, -2476, -8789, 11871, 7565, -11610, 9994, -2205, -5858, -6602, 3400, -3016, 3531, -2178, -3247, -3510, -4048, 3186, 9066, -8042, 9415, -5808, -8658, -9359, -10794, 8495, 2399, 243, -476, -1544, 2686, -5332, -2249, 5407, 6397, 648, -1269, -4117, 7162, -14218, -5997, 14417, 5191, 3000, 3985, -5559, 2969, -2865, -2884, -2126, 13842, 7999, 10626, -14823, 7917, -7639, -7690, -5669, -3136, 671, -4905, -420, 3978, 2370, -1153, 1630, -8362, 1789, -13079, -1120, 10607, 6319, -3074, 4346, 2963, -4896, 2366, -3051, -3091, -81, -1000, -4320, 7901, -13055, 6309, -8135, -8242, -216, -2666, -11519, -4278, 5331, -1381, 4177, 480, 1022, 5791, -2468, -11407, 14215, -3682, 11138, 1280, 2725, 15441, -6581, 1673, -4989, -2525, -3584, -2842, -9, -544, -339, 4461, -13303, -6733, -9557, -7578, -24, -1451, -904, 3271, 4414, -2780, -2305, -113, -160, 1426, -3636, 8722, 11770, -7413, -6146, -301, -427, 3802, -9695, -4057, 2847, 5195, -5042, 4919, -3149, -4654, 4938, -10818, 7591, 13852, -13444, 13116, -8397, -12410, 13167, -1689, -2174, -4895, 4053, 2166, -4437, -1777, 2704, -4504, -5797, -13052, 10807, 5776, -11831, -4738, 7210, -3364, 4372, -1484, -2645, -3915, 3, 1663, 5291, -8970, 11658, -3957, -7053, -10439, 8, 4434, 14108, -3553, 4805, -1062, 2294, -2747, 4846, -3135, -3712, -9474, 12812, -2832, 6117, -7325, 12922, -8359, -9898, -145, -3637, 2731, -5911, -1759, -3694, 3382, 4231, -387, -9698, 7282, -15761, -4690, -9850, 9018, 11282, -5542, 3459, -3932, -4890, 3707, 5179, 355, 2548, -14777, 9223, -10484, -13039, 9885, 13810, 947, 6794, 5277, 2143, 4096, -1378, 4976, -1002, -2437, 2422, 14071, 5714, 10922, -3674, 13268, -2672, -6498, 6458, 1168, -1065, -493, 1912, -1607, 5011, -3646, 6039, 3114, -2840, -1315, 5098, -4285, 13362, -9722, 16103, -1207, -404, 5444, 4337, -875, -4284, -2987, 2187, -3218, -1077, 14516, 11564, -2333, -11423, -7965, 5832, -3248, 4645, 2381, -435, -3780, 5088, -6022, 2566, -8661, 12386, 6349, -1160, -10079, 13567, -16057, 6842, -3014, 3201, -5086, -1326, 1170, -2319, 955, -790, -8037, 8535, -13562, -3536, 3120, -6183, 2546, -2106, -3241, 3289, -3284, 5092, -5755, 4388, 334, 1428, -8642, 8770, -8757, 13578, -15345, 11700, 891, 3808, -729, -2013, -2881, -2089, 4632, 1260, 2426, -1696, -1944, -5368, -7682, -5570, 12351, 3360, 6469, -4522, -1440, -5084, 4143, -3704, 3833, 5101, -2912, 5012, -3840, -13556, 11047, -9877, 10221, 13602, -7765, 13364, -3763, 1632, -4714, 2678, 3778, -1067, -5698, 2481, -10034, 4352, -12570, 7141, 10074, -2845, -15193, 6615, -3066, -4885, -242, -5019, -390, -2401, 354, 1045, -8175, -13026, -645, -13383, -1040, -6402, 944, 2786, 27, 1017, -1537, -545, 773, 442, -4861, -2859, 72, 2712, -4098, -1453, 2061, 1179, -12962, -7623};
+static const int16_t BR_inv_12289[NTT16_ROOTS] = {12289, 5461, -12287, 0, 0, 0, 0, 0, 1, -1305, -3542, 1646, -2639, 2975, -4591, -5777, 3, -3480, -9445, 4389, -7037, 7933, -12242, -15404, -1479, 722, 3504, -1212, -4821, -563, -5728, 3328, -3944, 1925, 9343, -3232, -12855, -1501, -15273, 8874, -5146, 5736, 2545, -3195, 949, 2744, 5828, 1351, -13722, 15295, 6786, -8519, 2530, 7317, 15540, 3602, 4043, -4134, -3621, -5860, -2625, -3006, -5023, 4978, 10780, -11023, -9655, -15625, -6999, -8015, -13394, 13274, 1, -5146, -1305, 5736, -3542, 2545, 1646, -3195, 3, -13722, -3480, 15295, -9445, 6786, 4389, -8519, -1479, 4043, 722, -4134, 3504, -3621, -1212, -5860, -3944, 10780, 1925, -11023, 9343, -9655, -3232, -15625, 1, -1479, -5146, 4043, -1305, 722, 5736, -4134, 3, -3944, -13722, 10780, -3480, 1925, 15295, -11023, 790, 1326, 3712, -2294, 4320, 3051, -1635, -4611, 2106, 3536, 9898, -6117, 11519, 8135, -4360, -12295, -955, 5086, 3135, 1062, 1000, -2366, -2768, -726, -2546, 13562, 8359, 2832, 2666, -6309, -7381, -1936, 2319, -3201, -4846, -4805, 81, 4896, -4255, -1853, 6183, -8535, -12922, -12812, 216, 13055, -11346, -4941, -1170, 3014, 2747, 3553, 3091, -2963, 1177, 140, -3120, 8037, 7325, 9474, 8242, -7901, 3138, 373, -2639, 949, 2975, 2744, -4591, 5828, -5777, 1351, -7037, 2530, 7933, 7317, -12242, 15540, -15404, 3602, -4821, -2625, -563, -3006, -5728, -5023, 3328, 4978, -12855, -6999, -1501, -8015, -15273, -13394, 8874, 13274, -3542, 3504, 2545, -3621, 1646, -1212, -3195, -5860, -9445, 9343, 6786, -9655, 4389, -3232, -8519, -15625, 1696, -1260, 2089, 2013, -2548, -5179, 4890, -3459, 4522, -3360, 5570, 5368, -6794, -13810, 13039, -9223, -1428, -4388, -5092, -3289, -4231, 3694, 5911, 3637, -3808, -11700, -13578, -8770, -11282, 9850, 15761, 9698, -2426, -4632, 2881, 729, -355, -3707, 3932, 5542, -6469, -12351, 7682, 1944, -947, -9885, 10484, 14777, -334, 5755, 3284, 3241, -3382, 1759, -2731, 145, -891, 15345, 8757, 8642, -9018, 4690, -7282, 387, 790, 2319, 1326, -3201, 3712, -4846, -2294, -4805, 2106, 6183, 3536, -8535, 9898, -12922, -6117, -12812, -955, -1170, 5086, 3014, 3135, 2747, 1062, 3553, -2546, -3120, 13562, 8037, 8359, 7325, 2832, 9474, -2639, -4821, 949, -2625, 2975, -563, 2744, -3006, -7037, -12855, 2530, -6999, 7933, -1501, 7317, -8015, 339, 9, 3584, 4989, 2476, 827, 4354, -4452, 904, 24, 9557, 13303, 6602, 2205, 11610, -11871, 2468, -1022, -4177, -5331, 118, 5767, -130, -2396, 6581, -2725, -11138, -14215, 315, 15377, -347, -6389, 544, 2842, 2525, -1673, 2197, -3748, -2837, 3296, 1451, 7578, 6733, -4461, 5858, -9994, -7565, 8789, -5791, -480, 1381, 4278, -5067, 953, 5374, 3949, -15441, -1280, 3682, 11407, -13511, 2541, 14330, 10530, 4320, 81, 3051, 4896, -1635, -4255, -4611, -1853, 11519, 216, 8135, 13055, -4360, -11346, -12295, -4941, 1000, 3091, -2366, -2963, -2768, 1177, -726, 140, 2666, 8242, -6309, -7901, -7381, 3138, -1936, 373, -4591, -5728, 5828, -5023, -5777, 3328, 1351, 4978, -12242, -15273, 15540, -13394, -15404, 8874, 3602, 13274, 2859, 4861, -442, -773, 545, 1537, -1017, -27, 7623, 12962, -1179, -2061, 1453, 4098, -2712, -72, -1045, -354, 2401, 390, 5019, 242, 4885, 3066, -2786, -944, 6402, 1040, 13383, 645, 13026, 8175, -2481, 5698, 1067, -3778, -2678, 4714, -1632, 3763, -6615, 15193, 2845, -10074, -7141, 12570, -4352, 10034, -5012, 2912, -5101, -3833, 3704, -4143, 5084, 1440, -13364, 7765, -13602, -10221, 9877, -11047, 13556, 3840, 1696, -2426, -1260, -4632, 2089, 2881, 2013, 729, 4522, -6469, -3360, -12351, 5570, 7682, 5368, 1944, -1428, -334, -4388, 5755, -5092, 3284, -3289, 3241, -3808, -891, -11700, 15345, -13578, 8757, -8770, 8642, 790, -955, 2319, -1170, 1326, 5086, -3201, 3014, 2106, -2546, 6183, -3120, 3536, 13562, -8535, 8037, -2566, 6022, -5088, 3780, 435, -2381, -4645, 3248, -6842, 16057, -13567, 10079, 1160, -6349, -12386, 8661, -2187, 2987, 4284, 875, -4337, -5444, 404, 1207, -5832, 7965, 11423, 2333, -11564, -14516, 1077, 3218, -6039, 3646, -5011, 1607, -1912, 493, 1065, -1168, -16103, 9722, -13362, 4285, -5098, 1315, 2840, -3114, -2422, 2437, 1002, -4976, 1378, -4096, -2143, -5277, -6458, 6498, 2672, -13268, 3674, -10922, -5714, -14071, -2548, -355, -5179, -3707, 4890, 3932, -3459, 5542, -6794, -947, -13810, -9885, 13039, 10484, -9223, 14777, -4231, -3382, 3694, 1759, 5911, -2731, 3637, 145, -11282, -9018, 9850, 4690, 15761, -7282, 9698, 387, 3712, 3135, -4846, 2747, -2294, 1062, -4805, 3553, 9898, 8359, -12922, 7325, -6117, 2832, -12812, 9474, -5291, -1663, -3, 3915, 2645, 1484, -4372, 3364, -14108, -4434, -8, 10439, 7053, 3957, -11658, 8970, -2704, 1777, 4437, -2166, -4053, 4895, 2174, 1689, -7210, 4738, 11831, -5776, -10807, 13052, 5797, 4504, -4938, 4654, 3149, -4919, 5042, -5195, -2847, 4057, -13167, 12410, 8397, -13116, 13444, -13852, -7591, 10818, 3636, -1426, 160, 113, 2305, 2780, -4414, -3271, 9695, -3802, 427, 301, 6146, 7413, -11770, -8722, 339, 544, 9, 2842, 3584, 2525, 4989, -1673, 904, 1451, 24, 7578, 9557, 6733, 13303, -4461, 2468, -5791, -1022, -480, -4177, 1381, -5331, 4278, 6581, -15441, -2725, -1280, -11138, 3682, -14215, 11407, 4320, 1000, 81, 3091, 3051, -2366, 4896, -2963, 11519, 2666, 216, 8242, 8135, -6309, 13055, -7901, -1630, 1153, -2370, -3978, 420, 4905, -671, 3136, -4346, 3074, -6319, -10607, 1120, 13079, -1789, 8362, 2126, 2884, 2865, -2969, 5559, -3985, -3000, -5191, 5669, 7690, 7639, -7917, 14823, -10626, -7999, -13842, -5407, 2249, 5332, -2686, 1544, 476, -243, -2399, -14417, 5997, 14218, -7162, 4117, 1269, -648, -6397, -3186, 4048, 3510, 3247, 2178, -3531, 3016, -3400, -8495, 10794, 9359, 8658, 5808, -9415, 8042, -9066, 2476, 2197, 827, -3748, 4354, -2837, -4452, 3296, 6602, 5858, 2205, -9994, 11610, -7565, -11871, 8789, 118, -5067, 5767, 953, -130, 5374, -2396, 3949, 315, -13511, 15377, 2541, -347, 14330, -6389, 10530, -1635, -2768, -4255, 1177, -4611, -726, -1853, 140, -4360, -7381, -11346, 3138, -12295, -1936, -4941, 373, 1, 3, -1479, -3944, 1, 3, 0, 0, -5146, -13722, 4043, 10780, -1479, -3944, 0, 0, -1305, -3480, 722, 1925, -5146, -13722, 0, 0, 5736, 15295, -4134, -11023, 4043, 10780, 0, 0, -3542, -9445, 3504, 9343, -1305, -3480, 0, 0, 2545, 6786, -3621, -9655, 722, 1925, 0, 0, 1646, 4389, -1212, -3232, 5736, 15295, 0, 0, -3195, -8519, -5860, -15625, -4134, -11023, 0, 0, -2639, -7037, -4821, -12855, -3542, -9445, 0, 0, 949, 2530, -2625, -6999, 3504, 9343, 0, 0, 2975, 7933, -563, -1501, 2545, 6786, 0, 0, 2744, 7317, -3006, -8015, -3621, -9655, 0, 0, -4591, -12242, -5728, -15273, 1646, 4389, 0, 0, 5828, 15540, -5023, -13394, -1212, -3232, 0, 0, -5777, -15404, 3328, 8874, -3195, -8519, 0, 0, 1351, 3602, 4978, 13274, -5860, -15625, 0, 0, 1, 3, -1479, -3944, 1, 3, 0, 0, -5146, -13722, 4043, 10780, -1479, -3944, 0, 0, -1305, -3480, 722, 1925, -5146, -13722, 0, 0, 5736, 15295, -4134, -11023, 4043, 10780, 0, 0, 1, 3, -1479, -3944, 1, 3, 0, 0};
+/**
+ * @brief Compute the forward NTT of a polynomial mod a 16 bit prime.
+ *
+ * @details This function can be used to compute the forward NTT of a size-512
+ * polynomial mod the prime of the given table of roots. The first two layers
+ * read the input directly, such that the same input row can be transformed mod
+ * both primes without copying it. The result is Barrett reduced into { -p/2,
+ * ..., p/2 } and is stored in the permuted order expected by
+ * __asm_ntt16_inverse().
+ *
+ * @param[out] coefficients The resulting integer coefficients (may equal in)
+ * @param[in] in The 512 integer coefficients of the polynomial
+ * @param[in] roots The precomputed roots, i.e. BR_7681 or BR_12289
+ */
+extern void __asm_ntt16_forward(int16_t *coefficients, const int16_t *in, const int16_t *roots);
+
+/**
+ * @brief Compute the inplace inverse NTT of a polynomial mod a 16 bit prime.
+ *
+ * @details This function can be used to compute the inverse NTT of a size-512
+ * polynomial mod the prime of the given table of inverse roots. The result
+ * carries an additional factor 512.
+ *
+ * @param[in, out] coefficients An array of integer coefficients (i.e. a polynomial)
+ * @param[in] roots The precomputed inverse roots, i.e. BR_inv_7681 or BR_inv_12289
+ */
+extern void __asm_ntt16_inverse(int16_t *coefficients, const int16_t *roots);
+
+/**
+ * @brief Compute the base multiplication of the transformed polynomials mod a
+ * 16 bit prime.
+ *
+ * @details This function can be used to multiply the GP0 transformed size-512
+ * polynomials column by column, just like __asm_base_multiply(). The products
+ * are reduced using Montgomery reduction, i.e. every coefficient of the result
+ * carries an additional factor 2^-16 mod p.
+ *
+ * @param[out] C_mat The resulting GP0xGP1 matrix of integer coefficients
+ * @param[in] A_mat The first transformed GP0xGP1 matrix of integer coefficients
+ * @param[in] B_mat The second transformed GP0xGP1 matrix of integer coefficients
+ * @param[in] roots The precomputed roots of the prime p
+ */
+extern void __asm_ntt16_base_multiply(int16_t *C_mat, const int16_t *A_mat, const int16_t *B_mat, const int16_t *roots);
+
+/**
+ * @brief Recombine the products mod NTT16_Q0 and NTT16_Q1 using CRT.
+ *
+ * @details This function can be used to compute the integer coefficients of a
+ * product from its residues, i.e. the NTT16_ROWSxGP1 matrix of inverse NTTs of
+ * which the first GP0 rows are mod NTT16_Q0 and the last GP0 rows are mod
+ * NTT16_Q1. The factors 512 and 2^-16 left by the inverse NTTs and the base
+ * multiplication are removed. The result is weighed in { 0, ..., NTT_Q - 1 },
+ * as expected by __asm_reduce_terms_761().
+ *
+ * @param[out] forward The first row of the resulting GP0xGP1 matrix
+ * @param[in] coefficients The first row of the NTT16_ROWSxGP1 matrix of residues
+ */
+extern void __asm_ntt16_crt(int32_t *forward, const int16_t *coefficients);
+
+/**
+ * @brief Compute the forward Good's permutation of a polynomial into 16 bits.
+ *
+ * @details These functions are equal to __asm_goods_forward16() and
+ * __asm_goods_forward8(), except that the integer coefficients are stored as
+ * 16 bit integers.
+ *
+ * @param[out] forward The first row of the resulting GP0xGP1 matrix
+ * @param[in] coefficients The 761 integer coefficients of the polynomial
+ */
+extern void __asm_goods_narrow16(int16_t *forward, const int16_t *coefficients);
+extern void __asm_goods_narrow8(int16_t *forward, const int8_t *coefficients);
+
+#endif
@@ -4,33 +4,110 @@
 /**
  * This header is used to contain the various parameters (constants) that are in
  * use. It explains what they are, what they are used for and how to calculate
- * them. These values are specific to the kem/ntrulpr761 parameter set and need
- * to be updated if another parameter set is used.
+ * them. The parameters follow the parameter set that is selected in
+ * paramsmenu.h.
  */
 
+/* Include user header files */
+
+#include "paramsmenu.h"
+
 /**
- * @brief Define the original parameters for the kem/ntrulpr761 parameter set
+ * @brief Define the original parameters for the selected parameter set
+ *
+ * Note that params.h defines these as p, q and w, which would clash with the
+ * identifiers used throughout the NTT sources.
  */
 
+#if defined(SIZE653)
+#define NTRU_P 653
+#define NTRU_Q 4621
+#elif defined(SIZE761)
 #define NTRU_P 761
 #define NTRU_Q 4591
+#elif defined(SIZE857)
+#define NTRU_P 857
+#define NTRU_Q 5167
+#elif defined(SIZE953)
+#define NTRU_P 953
+#define NTRU_Q 6343
+#elif defined(SIZE1013)
+#define NTRU_P 1013
+#define NTRU_Q 7177
+#elif defined(SIZE1277)
+#define NTRU_P 1277
+#define NTRU_Q 7879
+#else
+#error "no parameter set defined"
+#endif
+
+#ifdef LPR
+#if NTRU_P == 653
+#define NTRU_W 252
+#elif NTRU_P == 761
 #define NTRU_W 250
+#elif NTRU_P == 857
+#define NTRU_W 281
+#elif NTRU_P == 953
+#define NTRU_W 345
+#elif NTRU_P == 1013
+#define NTRU_W 392
+#else
+#define NTRU_W 429
+#endif
+#else
+#if NTRU_P == 653
+#define NTRU_W 288
+#elif NTRU_P == 761
+#define NTRU_W 286
+#elif NTRU_P == 857
+#define NTRU_W 322
+#elif NTRU_P == 953
+#define NTRU_W 396
+#elif NTRU_P == 1013
+#define NTRU_W 448
+#else
+#define NTRU_W 492
+#endif
+#endif
 
 /**
  * @brief Define the parameters for the Good's permutation
  *
- * We can use Good's trick to deconstruct our 'clunky' NTT into 3 size-512 NTTs
- * after zero-padding our integer arrays (polynomials) to size 1536.
+ * We can use Good's trick to deconstruct our 'clunky' NTT into GP0 size-512
+ * NTTs after zero-padding our integer arrays (polynomials) to size GPR. The
+ * product of two polynomials has 2p - 1 integer coefficients, so GPR = 1536
+ * suffices for p = 653 and p = 761. The larger parameter sets use GP0 = 5, as
+ * 4 is not coprime to 512, i.e. GPR = 2560.
+ *
+ * All parameter sets share the size-512 NTTs and their prime below, as the
+ * integer coefficients of a product with a small polynomial of weight w are
+ * bounded by w · (q-1)/2 <= 492 · 3939 < NTT_Q / 2.
  */
 
+#if NTRU_P <= 768
 #define GP0 3
+#else
+#define GP0 5
+#endif
 #define GP1 512
-#define GPR 1536
+#define GPR (GP0 * GP1)
+
+/*
+ * The first forward NTT layer pairs index i of the size-GPR array with index i +
+ * GPR / 2, which end up in the same row. Since p <= GPR / 2 one of the two is
+ * always part of the zero padding, such that the first layer only copies the
+ * integer coefficients and is merged into the Good's permutation.
+ */
+
+#if NTRU_P > GPR / 2
+#error "The Good's permutation requires p <= GPR / 2"
+#endif
 
 /**
  * @brief Define the parameters for the NTT transformation
  *
- * These 3 smaller size-512 cyclic NTTs are used to multiply polynomials in
+ * These GP0 smaller size-512 cyclic NTTs are used to multiply polynomials in
  * Z_6984193 [x] / (x^512 - 1).
  */
 
@@ -46,6 +123,116 @@
 
 #define NTT_QINV 1926852097
 
+/*
+ * The final reduction recovers the integer coefficients of a product from their
+ * residues mod NTT_Q, i.e. they have to be bounded by NTT_Q / 2. The assembly
+ * reduction for p = 761 folds x^p = x + 1 before centering, i.e. it bounds sums
+ * of up to 2p - 1 products, while goods_reduce_terms() centers every integer
+ * coefficient before folding, i.e. it bounds sums of up to p products. For a
+ * small polynomial of up to full weight this fails for p = 1013 and p = 1277
+ * only, where ntt761_full() splits the small polynomial. For p = 761 the bound
+ * is 1521 · 2295 = 3490695 < NTT_Q / 2.
+ */
+
+#if NTRU_P == 761
+#define NTT_FULL_BOUND ((2 * NTRU_P - 1) * ((NTRU_Q - 1) / 2))
+#else
+#define NTT_FULL_BOUND (NTRU_P * ((NTRU_Q - 1) / 2))
+#endif
+#define NTT_FULL_SPLIT (NTT_FULL_BOUND >= NTT_Q / 2)
+
+/*
+ * The batch NTT transformations interleave the integer coefficients of several
+ * independent polynomials, one per 32 bit lane of a NEON vector.
+ */
+
+#define NTT_X4 4 /* Define the number of polynomials per batch */
+
+/*
+ * The workspace of ntt761_ws() holds both transformed operands, i.e. 2 GP0xGP1
+ * matrices of 32 bit integer coefficients. The product is computed inplace, so
+ * no third matrix is needed: 12 KB for p <= 768 and 20 KB otherwise.
+ */
+
+#define NTT761_WORKSPACE_BYTES (2 * GPR * 4)
+
+/**
+ * @brief Define the parameters for the 16 bit NTT transformation
+ *
+ * The alternative multiplication backend (-D NTT16) computes the same 3
+ * size-512 cyclic NTTs mod two 16 bit primes, which allows NEON to process 8
+ * instead of 4 integer coefficients per instruction. Both primes are 1 mod 512
+ * and their product 94391809 exceeds twice the largest integer coefficient 250
+ * · 2295 of a product with a small polynomial, such that the integer product is
+ * recovered using CRT. The roots are stored as pairs (w, round(w · 2^15 / p))
+ * for Barrett multiplication.
+ */
+
+#define NTT16_Q0 7681   /* Define the first NTT friendly 16 bit prime */
+#define NTT16_Q1 12289  /* Define the second NTT friendly 16 bit prime */
+#define NTT16_ROWS 6    /* Define the number of size-512 NTTs, 3 per prime */
+#define NTT16_ROOTS 1072 /* Define the size of the tables of (inverse) roots */
+
+/**
+ * @brief Define the parameters for the Toom-Cook multiplication
+ *
+ * The alternative multiplication backend (-D TOOM) zero-pads our polynomials to
+ * size 768 and splits them into 4 parts of size 192, which are evaluated at the
+ * 7 points { 0, 1, -1, 2, -2, 1/2, oo } (Toom-4). The 7 products are computed
+ * using 2 levels of Karatsuba, i.e. as 9 schoolbook products of size 48 each.
+ */
+
+#define TOOM_K 192       /* Define the size of the Toom-4 parts */
+#define TOOM_N 48        /* Define the size of the schoolbook multiplications */
+#define TOOM_PRODUCTS 63 /* Define the number of schoolbook multiplications */
+
+/**
+ * @brief Define the parameters for the Kronecker substitution
+ *
+ * The alternative multiplication backend (-D KRONECKER) evaluates both
+ * polynomials at 2^22, i.e. packs their integer coefficients into big integers
+ * of 264 limbs of 64 bits. The integer coefficients of the product are bounded
+ * by 761 · 2295 < 2^21 in absolute value for small polynomials of any weight,
+ * such that they are recovered as signed 22 bit digits of the integer product.
+ * The big integers are multiplied using 3 levels of Karatsuba on top of size-33
+ * schoolbook multiplications. A transformed polynomial holds the absolute value
+ * of its big integer, followed by a word holding its sign mask.
+ */
+
+#define KRON_B 22        /* Define the number of bits per integer coefficient */
+#define KRON_LIMBS 264   /* Define the number of limbs of a packed polynomial */
+#define KRON_WORDS 265   /* Define the size of a transformed polynomial */
+#define KRON_LEVELS 3    /* Define the number of levels of Karatsuba */
+
+/**
+ * @brief Define the parameters for the encoders and decoders
+ *
+ * Encode() merges pairs of integers until a single integer remains, i.e. it
+ * takes ceil(log2(p)) levels for p integers, which Decode() splits again. Since
+ * all integers of an Rq or a Rounded polynomial share the same radix, the
+ * radices of every level follow from p and the radix alone, such that both are
+ * unrolled per level.
+ */
+
+#define ENCODE_LEVELS (NTRU_P <= 1024 ? 10 : 11) /* Define the number of levels */
+#define ENCODE_HALF ((NTRU_P + 1) / 2)           /* Define the size of level 1 */
+
+/*
+ * The small polynomials are packed into 4 integer coefficients per byte, which
+ * relies on p mod 4 = 1 for all parameter sets. The NTRU LPRime inputs consist
+ * of I = 256 bits, which are packed into 8 bits per byte, and the top
+ * polynomials of I integer coefficients into 2 per byte.
+ */
+
+#define NTRU_I 256                     /* Define the number of bits of an input */
+#define SMALL_BYTES ((NTRU_P + 3) / 4) /* Define the size of a small polynomial */
+
+/* The alternative backends are specific to the kem/ntrulpr761 parameter set */
+
+#if (defined(NTT16) || defined(TOOM) || defined(KRONECKER)) && NTRU_P != 761
+#error "the NTT16, TOOM and KRONECKER multiplication backends require SIZE761"
+#endif
+
 /**
  * @brief Define benchmarking related parameters
  */
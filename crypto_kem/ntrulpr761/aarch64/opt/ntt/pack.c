@@ -0,0 +1,89 @@
+#include "pack.h"
+
+/**
+ * This source can be used to pack the fixed size formats of the KEM, i.e. the
+ * small polynomials of Small_encode() and Small_decode(), the top polynomials
+ * of Top_encode() and Top_decode() and the inputs of Inputs_encode(). The
+ * whole vectors are processed in asm_pack.s, the remaining bytes as in the
+ * reference implementation.
+ */
+
+/* Define the number of bytes processed by the vectorized loops */
+
+#define PACK_SMALL_VECTORS (16 * ((SMALL_BYTES - 1) / 16))
+#define PACK_TOP_BYTES (NTRU_I / 2)
+#define PACK_INPUTS_BYTES (NTRU_I / 8)
+
+/**
+ * @brief Pack a small polynomial into SMALL_BYTES bytes.
+ *
+ * @param[out] s The packed small polynomial
+ * @param[in] f The p integer coefficients in { -1, 0, 1 }
+ */
+void pack761_small(unsigned char *s, const int8_t *f)
+{
+    __asm_pack_small(s, f, PACK_SMALL_VECTORS);
+
+    for (size_t idx = PACK_SMALL_VECTORS; idx < SMALL_BYTES - 1; idx++)
+    {
+        s[idx] = (unsigned char)((f[4 * idx] + 1) + ((f[4 * idx + 1] + 1) << 2) + ((f[4 * idx + 2] + 1) << 4) + ((f[4 * idx + 3] + 1) << 6));
+    }
+
+    /* The last byte holds a single integer coefficient, as p mod 4 = 1 */
+
+    s[SMALL_BYTES - 1] = (unsigned char)(f[NTRU_P - 1] + 1);
+}
+
+/**
+ * @brief Unpack a small polynomial from SMALL_BYTES bytes.
+ *
+ * @param[out] f The p integer coefficients
+ * @param[in] s The packed small polynomial
+ */
+void unpack761_small(int8_t *f, const unsigned char *s)
+{
+    __asm_unpack_small(f, s, PACK_SMALL_VECTORS);
+
+    for (size_t idx = PACK_SMALL_VECTORS; idx < SMALL_BYTES - 1; idx++)
+    {
+        f[4 * idx] = (int8_t)((s[idx] & 3) - 1);
+        f[4 * idx + 1] = (int8_t)(((s[idx] >> 2) & 3) - 1);
+        f[4 * idx + 2] = (int8_t)(((s[idx] >> 4) & 3) - 1);
+        f[4 * idx + 3] = (int8_t)((s[idx] >> 6) - 1);
+    }
+
+    f[NTRU_P - 1] = (int8_t)((s[SMALL_BYTES - 1] & 3) - 1);
+}
+
+/**
+ * @brief Pack a top polynomial into I / 2 bytes.
+ *
+ * @param[out] s The packed top polynomial
+ * @param[in] T The I integer coefficients in { 0, ..., 15 }
+ */
+void pack761_top(unsigned char *s, const int8_t *T)
+{
+    __asm_pack_top(s, T, PACK_TOP_BYTES);
+}
+
+/**
+ * @brief Unpack a top polynomial from I / 2 bytes.
+ *
+ * @param[out] T The I integer coefficients
+ * @param[in] s The packed top polynomial
+ */
+void unpack761_top(int8_t *T, const unsigned char *s)
+{
+    __asm_unpack_top(T, s, PACK_TOP_BYTES);
+}
+
+/**
+ * @brief Pack an input of I bits into I / 8 bytes.
+ *
+ * @param[out] s The packed input
+ * @param[in] r The I bits in { 0, 1 }
+ */
+void pack761_inputs(unsigned char *s, const int8_t *r)
+{
+    __asm_pack_inputs(s, r, PACK_INPUTS_BYTES);
+}
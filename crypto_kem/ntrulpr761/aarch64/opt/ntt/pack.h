@@ -0,0 +1,75 @@
+#ifndef PACK_H
+#define PACK_H
+
+/**
+ * This header accompanies pack.c and asm_pack.s. It is used to contain the
+ * packers of the small polynomials, the top polynomials and the inputs, and the
+ * wrappers for their vectorized loops. As you can see it has been defined as a
+ * Once-Only Header to avoid the compiler from processing the contents twice.
+ */
+
+/* Include system header files */
+
+#include <stddef.h>
+#include <stdint.h>
+
+/* Include user header files */
+
+#include "ntt_params.h"
+
+/**
+ * @brief Pack 4n integer coefficients in { -1, 0, 1 } into n bytes.
+ *
+ * @param[out] s The n output bytes
+ * @param[in] f The 4n integer coefficients
+ * @param[in] n The number of bytes, a multiple of 16
+ */
+extern void __asm_pack_small(unsigned char *s, const int8_t *f, int32_t n);
+
+/**
+ * @brief Unpack n bytes into 4n integer coefficients, the inverse of
+ * __asm_pack_small().
+ *
+ * @param[out] f The 4n integer coefficients
+ * @param[in] s The n input bytes
+ * @param[in] n The number of bytes, a multiple of 16
+ */
+extern void __asm_unpack_small(int8_t *f, const unsigned char *s, int32_t n);
+
+/**
+ * @brief Pack 2n integer coefficients in { 0, ..., 15 } into n bytes.
+ *
+ * @param[out] s The n output bytes
+ * @param[in] T The 2n integer coefficients
+ * @param[in] n The number of bytes, a multiple of 16
+ */
+extern void __asm_pack_top(unsigned char *s, const int8_t *T, int32_t n);
+
+/**
+ * @brief Unpack n bytes into 2n integer coefficients, the inverse of
+ * __asm_pack_top().
+ *
+ * @param[out] T The 2n integer coefficients
+ * @param[in] s The n input bytes
+ * @param[in] n The number of bytes, a multiple of 16
+ */
+extern void __asm_unpack_top(int8_t *T, const unsigned char *s, int32_t n);
+
+/**
+ * @brief Pack 8n bits in { 0, 1 } into n bytes, least significant bit first.
+ *
+ * @param[out] s The n output bytes
+ * @param[in] r The 8n bits
+ * @param[in] n The number of bytes, a multiple of 8
+ */
+extern void __asm_pack_inputs(unsigned char *s, const int8_t *r, int32_t n);
+
+/* Provide function declarations */
+
+void pack761_small(unsigned char *s, const int8_t *f);
+void unpack761_small(int8_t *f, const unsigned char *s);
+void pack761_top(unsigned char *s, const int8_t *T);
+void unpack761_top(int8_t *T, const unsigned char *s);
+void pack761_inputs(unsigned char *s, const int8_t *r);
+
+#endif
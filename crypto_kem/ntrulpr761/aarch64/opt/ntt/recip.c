@@ -0,0 +1,217 @@
+#include "recip.h"
+
+#include <string.h>
+
+/**
+ * This source can be used to compute the constant time inversions of the
+ * Streamlined NTRU Prime KeyGen, i.e. R3_recip() and Rq_recip3() of the
+ * reference implementation. Both compute the same 2p - 1 division steps as the
+ * reference, but all polynomial arithmetic of a division step is vectorized in
+ * asm_divstep.s. Only delta, the swap mask and the first integer coefficients
+ * of f and g are computed here, without branches on secret data.
+ */
+
+/* round(2^40 / q), used for the Barrett reduction of integers below 2^26 */
+
+#define RECIP_BARRETT ((((int64_t)1 << 40) + NTRU_Q / 2) / NTRU_Q)
+
+/**
+ * @brief Return -1 if x != 0, else 0.
+ */
+static inline int32_t recip_nonzero_mask(int16_t x)
+{
+    uint32_t u = (uint16_t)x;
+
+    return -(int32_t)((-u) >> 31);
+}
+
+/**
+ * @brief Return -1 if x < 0, else 0.
+ */
+static inline int32_t recip_negative_mask(int16_t x)
+{
+    return -(int32_t)((uint16_t)x >> 15);
+}
+
+/**
+ * @brief Reduce an integer mod q to -(q-1)/2, ..., (q-1)/2.
+ *
+ * @param[in] x The integer, bounded by 2^26 in absolute value
+ * @return The centered representative of x mod q
+ */
+static inline int16_t recip_freeze(int32_t x)
+{
+    int32_t t = (int32_t)(((int64_t)x * RECIP_BARRETT + ((int64_t)1 << 39)) >> 40);
+
+    return (int16_t)(x - t * NTRU_Q);
+}
+
+/**
+ * @brief Compute the Barrett constant round(c · 2^15 / q) of a multiplicand.
+ *
+ * @param[in] c The multiplicand in -(q-1)/2, ..., (q-1)/2
+ * @return The constant c' used by sqrdmulh in __asm_divstepq()
+ */
+static inline int16_t recip_barrett(int16_t c)
+{
+    return (int16_t)(((int64_t)c * RECIP_BARRETT + ((int64_t)1 << 24)) >> 25);
+}
+
+/**
+ * @brief Compute the inverse of an integer mod q.
+ *
+ * @details The inverse is computed as a^(q-2) using left-to-right square and
+ * multiply, i.e. an addition chain of about 2 log2(q) multiplications instead
+ * of the q - 3 multiplications of the reference implementation. The exponent is
+ * public, so the branches on its bits do not depend on secret data.
+ *
+ * @param[in] a The integer in -(q-1)/2, ..., (q-1)/2
+ * @return The centered representative of 1 / a mod q, or 0 if a = 0
+ */
+static int16_t recip_fq(int16_t a)
+{
+    int16_t ai = a;
+    int bit = 0;
+
+    while ((NTRU_Q - 2) >> (bit + 1))
+    {
+        bit++;
+    }
+
+    while (bit-- > 0)
+    {
+        ai = recip_freeze((int32_t)ai * ai);
+
+        if (((NTRU_Q - 2) >> bit) & 1)
+        {
+            ai = recip_freeze((int32_t)ai * a);
+        }
+    }
+
+    return ai;
+}
+
+/**
+ * @brief Return the number of integer coefficients of v and r to process.
+ *
+ * @details Before division step i the polynomials v and r have degree at most
+ * i, as v is multiplied by x once per step. The division step therefore only
+ * needs to process the NEON vectors holding the coefficients 0, ..., i + 1,
+ * which saves a quarter of the work on v and r. This only depends on the public
+ * loop counter.
+ *
+ * @param[in] i The index of the division step
+ * @return The number of processed coefficients, a multiple of 16
+ */
+static inline int32_t recip_active(int32_t i)
+{
+    int32_t m = 16 * ((i + 17) / 16);
+
+    return m < RECIP_N ? m : RECIP_N;
+}
+
+/**
+ * @brief Compute the inverse of a small polynomial in R3.
+ *
+ * @param[out] out The resulting p integer coefficients in { -1, 0, 1 }
+ * @param[in] in The p integer coefficients of the small polynomial
+ * @return 0 if the inverse exists, else -1
+ */
+int recip761_r3(int8_t *out, const int8_t *in)
+{
+    int8_t fgvr[RECIP_ROWS][RECIP_N] __attribute__((aligned(16)));
+    int8_t *f = fgvr[0], *g = fgvr[1], *v = fgvr[2], *r = fgvr[3];
+    int32_t delta = 1, swap, sign;
+
+    memset(fgvr, 0, sizeof(fgvr));
+
+    r[0] = 1;
+    f[0] = 1;
+    f[NTRU_P - 1] = f[NTRU_P] = -1;
+
+    for (size_t idx = 0; idx < NTRU_P; idx++)
+    {
+        g[NTRU_P - 1 - idx] = in[idx];
+    }
+
+    for (int32_t loop = 0; loop < 2 * NTRU_P - 1; loop++)
+    {
+        sign = -g[0] * f[0];
+        swap = recip_negative_mask(-delta) & recip_nonzero_mask(g[0]);
+        delta ^= swap & (delta ^ -delta);
+        delta += 1;
+
+        __asm_divstep3(fgvr[0], RECIP_N, recip_active(loop), swap, sign);
+    }
+
+    sign = f[0];
+
+    for (size_t idx = 0; idx < NTRU_P; idx++)
+    {
+        out[idx] = sign * v[NTRU_P - 1 - idx];
+    }
+
+    return recip_nonzero_mask(delta);
+}
+
+/**
+ * @brief Compute the inverse of 3 times a small polynomial in Rq.
+ *
+ * @param[out] out The resulting p integer coefficients in -(q-1)/2, ..., (q-1)/2
+ * @param[in] in The p integer coefficients of the small polynomial
+ * @return 0 if the inverse exists, else -1
+ */
+int recip761_rq3(int16_t *out, const int8_t *in)
+{
+    int16_t fgvr[RECIP_ROWS][RECIP_N] __attribute__((aligned(16)));
+    int16_t *f = fgvr[0], *g = fgvr[1], *v = fgvr[2], *r = fgvr[3];
+    int16_t c[8] __attribute__((aligned(16))) = {0};
+    int16_t f0, g0, t, scale;
+    int32_t delta = 1, swap;
+
+    memset(fgvr, 0, sizeof(fgvr));
+
+    r[0] = recip_fq(3);
+    f[0] = 1;
+    f[NTRU_P - 1] = f[NTRU_P] = -1;
+
+    for (size_t idx = 0; idx < NTRU_P; idx++)
+    {
+        g[NTRU_P - 1 - idx] = in[idx];
+    }
+
+    c[4] = NTRU_Q;
+
+    for (int32_t loop = 0; loop < 2 * NTRU_P - 1; loop++)
+    {
+        /* The rows are not frozen by __asm_divstepq(), their first integer
+         * coefficients are frozen here instead */
+        f0 = recip_freeze(f[0]);
+        g0 = recip_freeze(g[0]);
+
+        swap = recip_negative_mask(-delta) & recip_nonzero_mask(g0);
+        delta ^= swap & (delta ^ -delta);
+        delta += 1;
+
+        t = swap & (f0 ^ g0);
+        f0 ^= t;
+        g0 ^= t;
+
+        c[0] = f0;
+        c[1] = recip_barrett(f0);
+        c[2] = g0;
+        c[3] = recip_barrett(g0);
+        c[5] = swap;
+
+        __asm_divstepq(fgvr[0], RECIP_N, recip_active(loop), c);
+    }
+
+    scale = recip_fq(recip_freeze(f[0]));
+
+    for (size_t idx = 0; idx < NTRU_P; idx++)
+    {
+        out[idx] = recip_freeze(scale * (int32_t)v[NTRU_P - 1 - idx]);
+    }
+
+    return recip_nonzero_mask(delta);
+}
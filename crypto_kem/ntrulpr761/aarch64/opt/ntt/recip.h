@@ -0,0 +1,77 @@
+#ifndef RECIP_H
+#define RECIP_H
+
+/**
+ * This header accompanies recip.c and asm_divstep.s. It is used to contain the
+ * constant time inversions of the Streamlined NTRU Prime KeyGen and the
+ * wrappers for their vectorized division steps. As you can see it has been
+ * defined as a Once-Only Header to avoid the compiler from processing the
+ * contents twice.
+ */
+
+/* Include system header files */
+
+#include <stdint.h>
+
+/* Include user header files */
+
+#include "ntt_params.h"
+
+/**
+ * @brief Define the parameters for the division steps
+ *
+ * The polynomials f, g, v and r of the division steps are stored as the rows of
+ * a 4xRECIP_N matrix. Every row holds the p + 1 integer coefficients of its
+ * polynomial, zero padded to a multiple of 16 such that the rows consist of
+ * whole NEON vectors of 8 or 16 bit integer coefficients.
+ */
+
+#define RECIP_N (16 * ((NTRU_P + 16) / 16))
+#define RECIP_ROWS 4
+
+/**
+ * @brief Compute one division step mod 3.
+ *
+ * @details This function can be used to compute a single constant time division
+ * step of R3_recip(), apart from the scalar update of delta. The rows f and g
+ * are swapped if swap = -1, after which g = (g + sign · f) / x. The rows v and r
+ * are updated accordingly, i.e. v = x · v followed by the same swap and r = r +
+ * sign · v. Only the first m integer coefficients of v and r are processed, as
+ * the others are still zero. All integer coefficients are kept in { -1, 0, 1 }.
+ *
+ * @param[in, out] fgvr The 4xn matrix holding the rows f, g, v and r
+ * @param[in] n The row length, a multiple of 16
+ * @param[in] m The number of processed coefficients of v and r, a multiple of 16
+ * @param[in] swap The swap mask, either 0 or -1
+ * @param[in] sign The factor -f[0] · g[0] in { -1, 0, 1 }
+ */
+extern void __asm_divstep3(int8_t *fgvr, int32_t n, int32_t m, int32_t swap, int32_t sign);
+
+/**
+ * @brief Compute one division step mod q.
+ *
+ * @details This function can be used to compute a single constant time division
+ * step of Rq_recip3(), apart from the scalar update of delta. The rows f and g
+ * are swapped if swap = -1, after which g = (f0 · g - g0 · f) / x, where f0 and
+ * g0 are the first integer coefficients of the swapped rows. The rows v and r
+ * are updated accordingly, i.e. v = x · v followed by the same swap and r = f0
+ * · r - g0 · v. Only the first m integer coefficients of v and r are processed.
+ *
+ * The products are computed using Barrett multiplication, which is why c holds
+ * { f0, f0', g0, g0', q, swap }, where c' = round(c · 2^15 / q). The integer
+ * coefficients are not frozen, but bounded by q / (1 - q / 2^15) in absolute
+ * value, which is less than 2^14 for all parameter sets.
+ *
+ * @param[in, out] fgvr The 4xn matrix holding the rows f, g, v and r
+ * @param[in] n The row length, a multiple of 16
+ * @param[in] m The number of processed coefficients of v and r, a multiple of 16
+ * @param[in] c The constants of this division step
+ */
+extern void __asm_divstepq(int16_t *fgvr, int32_t n, int32_t m, const int16_t *c);
+
+/* Provide function declarations */
+
+int recip761_r3(int8_t *out, const int8_t *in);
+int recip761_rq3(int16_t *out, const int8_t *in);
+
+#endif
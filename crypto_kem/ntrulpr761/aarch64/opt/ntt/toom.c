@@ -0,0 +1,309 @@
+#include "toom.h"
+
+/* The Toom-Cook multiplication is specific to p = 761, see ntt_params.h */
+
+#if NTRU_P == 761
+
+/**
+ * This source can be used to perform Toom-Cook based polynomial multiplication,
+ * as an alternative to the NTT based multiplication in mult.c. We are
+ * computing:
+ *
+ * poly_one * poly_two % (x^761 - x - 1) % 4591
+ *
+ * Since 4591 is prime, the evaluations of poly_one and the Toom-4 interpolation
+ * are computed mod 4591, while the evaluations of the small poly_two and the
+ * Karatsuba products are exact.
+ */
+
+/* Define the inverses of 2, 3, 4 and 5 mod NTRU_Q in { -q/2, ..., q/2 } */
+
+#define TOOM_INV2 -2295
+#define TOOM_INV3 -1530
+#define TOOM_INV4 1148
+#define TOOM_INV5 -918
+
+/**
+ * @brief Reduce an integer coefficient mod NTRU_Q in constant time.
+ *
+ * @details The offset makes the value non-negative, such that the quotient can
+ * be computed using an exact Barrett reduction with 2^44 / NTRU_Q rounded up.
+ * This is correct for integer coefficients in { -2^29, ..., 2^29 }.
+ *
+ * @param[in] x The integer coefficient
+ * @return The integer coefficient x mod NTRU_Q in { -q/2, ..., q/2 }
+ */
+static inline int16_t toom_freeze(int32_t x)
+{
+    uint32_t y = (uint32_t)x + (NTRU_Q - 1) / 2 + NTRU_Q * (1U << 17);
+    uint32_t t = (uint32_t)(((uint64_t)y * 3831885438U) >> 44);
+
+    return (int16_t)((int32_t)(y - t * NTRU_Q) - (NTRU_Q - 1) / 2);
+}
+
+/**
+ * @brief Evaluate a zero-padded polynomial for all schoolbook products.
+ *
+ * @details This function computes the Toom-4 evaluations of the 4 parts of the
+ * polynomial, followed by the 2 levels of Karatsuba evaluations of each part.
+ * The evaluation at 1/2 is scaled by 8 to keep it integral. Row 9t + k of the
+ * result holds the operand of the k-th Karatsuba product of the t-th point.
+ *
+ * @param[out] eval The TOOM_PRODUCTS operands of TOOM_N integer coefficients
+ * @param[in] a The 4 · TOOM_K integer coefficients of the padded polynomial
+ * @param[in] reduce Whether to reduce the Toom-4 evaluations mod NTRU_Q
+ */
+static void toom761_evaluate(int16_t eval[TOOM_PRODUCTS][TOOM_N], const int32_t *a, int reduce)
+{
+    int32_t points[7][TOOM_K];
+
+    for (size_t i = 0; i < TOOM_K; i++)
+    {
+        int32_t r0 = a[i];
+        int32_t r1 = a[i + TOOM_K];
+        int32_t r2 = a[i + 2 * TOOM_K];
+        int32_t r3 = a[i + 3 * TOOM_K];
+
+        points[0][i] = r0;
+        points[1][i] = r0 + r1 + r2 + r3;
+        points[2][i] = r0 - r1 + r2 - r3;
+        points[3][i] = r0 + 2 * r1 + 4 * r2 + 8 * r3;
+        points[4][i] = r0 - 2 * r1 + 4 * r2 - 8 * r3;
+        points[5][i] = 8 * r0 + 4 * r1 + 2 * r2 + r3;
+        points[6][i] = r3;
+
+        if (reduce)
+        {
+            for (size_t t = 0; t < 7; t++)
+            {
+                points[t][i] = toom_freeze(points[t][i]);
+            }
+        }
+    }
+
+    /**
+     * @brief Compute the Karatsuba evaluations.
+     *
+     * The parts are split into x0 + x1 · y + (x2 + x3 · y) · y^2 for y = x^48,
+     * for which we need the 9 products of x0, x1, x0 + x1, x2, x3, x2 + x3, x0 +
+     * x2, x1 + x3 and x0 + x1 + x2 + x3.
+     */
+
+    for (size_t t = 0; t < 7; t++)
+    {
+        int16_t (*row)[TOOM_N] = &eval[9 * t];
+
+        for (size_t i = 0; i < TOOM_N; i++)
+        {
+            int32_t x0 = points[t][i];
+            int32_t x1 = points[t][i + TOOM_N];
+            int32_t x2 = points[t][i + 2 * TOOM_N];
+            int32_t x3 = points[t][i + 3 * TOOM_N];
+
+            row[0][i] = x0;
+            row[1][i] = x1;
+            row[2][i] = x0 + x1;
+            row[3][i] = x2;
+            row[4][i] = x3;
+            row[5][i] = x2 + x3;
+            row[6][i] = x0 + x2;
+            row[7][i] = x1 + x3;
+            row[8][i] = x0 + x1 + x2 + x3;
+        }
+    }
+}
+
+/**
+ * @brief Recombine the Karatsuba products of a single Toom-4 point.
+ *
+ * @param[out] out The 2 · TOOM_K integer coefficients of the product mod NTRU_Q
+ * @param[in] prod The 9 schoolbook products of 2 · TOOM_N integer coefficients
+ */
+static void toom761_karatsuba(int16_t *out, int32_t prod[9][2 * TOOM_N])
+{
+    int32_t part[3][2 * 2 * TOOM_N] = {0};
+    int32_t full[2 * TOOM_K] = {0};
+
+    for (size_t u = 0; u < 3; u++)
+    {
+        for (size_t i = 0; i < 2 * TOOM_N; i++)
+        {
+            int32_t lo = prod[3 * u][i];
+            int32_t hi = prod[3 * u + 1][i];
+            int32_t mid = prod[3 * u + 2][i];
+
+            part[u][i] += lo;
+            part[u][i + TOOM_N] += mid - lo - hi;
+            part[u][i + 2 * TOOM_N] += hi;
+        }
+    }
+
+    for (size_t i = 0; i < 2 * 2 * TOOM_N; i++)
+    {
+        full[i] += part[0][i];
+        full[i + 2 * TOOM_N] += part[2][i] - part[0][i] - part[1][i];
+        full[i + 4 * TOOM_N] += part[1][i];
+    }
+
+    for (size_t i = 0; i < 2 * TOOM_K; i++)
+    {
+        out[i] = toom_freeze(full[i]);
+    }
+}
+
+/**
+ * @brief Transform a small polynomial into the Toom-Cook domain.
+ *
+ * @details This function is the Toom-Cook equivalent of ntt761_forward_small().
+ * The evaluations are exact, such that all operands are bounded by 60.
+ *
+ * @param[out] g_toom The small polynomial g in the Toom-Cook domain
+ * @param[in] g The 761 integer coefficients of the small polynomial g
+ */
+void toom761_forward_small(int16_t g_toom[TOOM_PRODUCTS][TOOM_N], const int8_t *g)
+{
+    int32_t padded[4 * TOOM_K] = {0};
+
+    for (size_t i = 0; i < NTRU_P; i++)
+    {
+        padded[i] = g[i];
+    }
+
+    toom761_evaluate(g_toom, padded, 0);
+}
+
+/**
+ * @brief Transform a polynomial into the Toom-Cook domain.
+ *
+ * @details This function is the Toom-Cook equivalent of ntt761_forward(). The
+ * evaluations are reduced mod NTRU_Q, such that all operands are bounded by 4 ·
+ * 2295.
+ *
+ * @param[out] f_toom The polynomial f in the Toom-Cook domain
+ * @param[in] f The 761 integer coefficients of the polynomial f
+ */
+void toom761_forward(int16_t f_toom[TOOM_PRODUCTS][TOOM_N], const int16_t *f)
+{
+    int32_t padded[4 * TOOM_K] = {0};
+
+    for (size_t i = 0; i < NTRU_P; i++)
+    {
+        padded[i] = f[i];
+    }
+
+    toom761_evaluate(f_toom, padded, 1);
+}
+
+/**
+ * @brief Multiply two polynomials in the Toom-Cook domain.
+ *
+ * @details This function is the Toom-Cook equivalent of ntt761_product(). The
+ * schoolbook products are recombined per point, interpolated mod NTRU_Q and
+ * reduced mod (x^761 - x - 1).
+ *
+ * @param[out] fg The resulting 761 integer coefficients
+ * @param[in] f_toom The polynomial f in the Toom-Cook domain
+ * @param[in] g_toom The small polynomial g in the Toom-Cook domain
+ */
+void toom761_product(int16_t *fg, const int16_t f_toom[TOOM_PRODUCTS][TOOM_N], const int16_t g_toom[TOOM_PRODUCTS][TOOM_N])
+{
+    int32_t prod[9][2 * TOOM_N];
+    int16_t W_mat[7][2 * TOOM_K];
+    int32_t C_mat[8 * TOOM_K] = {0};
+
+    for (size_t t = 0; t < 7; t++)
+    {
+        for (size_t k = 0; k < 9; k++)
+        {
+            __asm_schoolbook48(prod[k], f_toom[9 * t + k], g_toom[9 * t + k]);
+        }
+
+        toom761_karatsuba(W_mat[t], prod);
+    }
+
+    /**
+     * @brief Compute the Toom-4 interpolation.
+     *
+     * The products at the points { 0, 1, -1, 2, -2, 1/2, oo } are turned into
+     * the 7 parts W0, ..., W6 of the product. The even and odd parts are
+     * separated first, after which all divisions are exact mod NTRU_Q.
+     */
+
+    for (size_t i = 0; i < 2 * TOOM_K; i++)
+    {
+        int32_t w0 = W_mat[0][i];
+        int32_t p1 = W_mat[1][i];
+        int32_t m1 = W_mat[2][i];
+        int32_t p2 = W_mat[3][i];
+        int32_t m2 = W_mat[4][i];
+        int32_t h = W_mat[5][i];
+        int32_t wi = W_mat[6][i];
+
+        int32_t e1 = toom_freeze((p1 + m1) * TOOM_INV2) - w0 - wi;
+        int32_t o1 = toom_freeze((p1 - m1) * TOOM_INV2);
+        int32_t e2 = toom_freeze((toom_freeze((p2 + m2) * TOOM_INV2) - w0 - 64 * wi) * TOOM_INV4);
+        int32_t o2 = toom_freeze((p2 - m2) * TOOM_INV4);
+
+        int32_t w4 = toom_freeze((e2 - e1) * TOOM_INV3);
+        int32_t w2 = toom_freeze(e1 - w4);
+
+        int32_t hp = toom_freeze((h - 64 * w0 - 16 * w2 - 4 * w4 - wi) * TOOM_INV2);
+        int32_t x = toom_freeze((o2 - o1) * TOOM_INV3);
+        int32_t y = toom_freeze((16 * o1 - hp) * TOOM_INV3);
+
+        int32_t w3 = toom_freeze((y - x) * TOOM_INV3);
+        int32_t w5 = toom_freeze((x - w3) * TOOM_INV5);
+        int32_t w1 = toom_freeze(o1 - w3 - w5);
+
+        C_mat[i] += w0;
+        C_mat[i + TOOM_K] += w1;
+        C_mat[i + 2 * TOOM_K] += w2;
+        C_mat[i + 3 * TOOM_K] += w3;
+        C_mat[i + 4 * TOOM_K] += w4;
+        C_mat[i + 5 * TOOM_K] += w5;
+        C_mat[i + 6 * TOOM_K] += wi;
+    }
+
+    /**
+     * @brief Reduce the product mod (x^761 - x - 1).
+     *
+     * The product has degree at most 1520, such that x^(761 + i) = x^(i + 1) +
+     * x^i has to be applied only once.
+     */
+
+    fg[0] = toom_freeze(C_mat[0] + C_mat[NTRU_P]);
+
+    for (size_t i = 1; i < NTRU_P; i++)
+    {
+        fg[i] = toom_freeze(C_mat[i] + C_mat[i + NTRU_P - 1] + C_mat[i + NTRU_P]);
+    }
+}
+
+/**
+ * @brief Multiply a polynomial with a small polynomial in the Toom-Cook domain.
+ *
+ * @details This function is the Toom-Cook equivalent of ntt761_shared().
+ *
+ * @param[out] fg The resulting 761 integer coefficients
+ * @param[in] f The 761 integer coefficients of the polynomial f
+ * @param[in] g_toom The small polynomial g in the Toom-Cook domain
+ */
+void toom761_shared(int16_t *fg, const int16_t *f, const int16_t g_toom[TOOM_PRODUCTS][TOOM_N])
+{
+    int16_t A_mat[TOOM_PRODUCTS][TOOM_N];
+
+    toom761_forward(A_mat, f);
+    toom761_product(fg, A_mat, g_toom);
+}
+
+/* Function for computing poly_one * poly_two % (x^761 - x - 1) % 4591 using
+ * Toom-Cook and Karatsuba */
+void toom761(int16_t *fg, const int16_t *f, const int8_t *g)
+{
+    int16_t B_mat[TOOM_PRODUCTS][TOOM_N];
+
+    toom761_forward_small(B_mat, g);
+    toom761_shared(fg, f, B_mat);
+}
+
+#endif
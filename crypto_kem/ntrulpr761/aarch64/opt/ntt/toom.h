@@ -0,0 +1,45 @@
+#ifndef TOOM_H
+#define TOOM_H
+
+/**
+ * This header accompanies toom.c and asm_schoolbook.s. It is used to contain
+ * the Toom-Cook multiplication and the wrapper for the schoolbook
+ * multiplication at the bottom of the Toom-Cook and Karatsuba recursion. As you
+ * can see it has been defined as a Once-Only Header to avoid the compiler from
+ * processing the contents twice.
+ */
+
+/* Include system header files */
+
+#include <stddef.h>
+#include <stdint.h>
+
+/* Include user header files */
+
+#include "ntt_params.h"
+
+/**
+ * @brief Compute the schoolbook product of two size-48 polynomials.
+ *
+ * @details This function can be used to compute the integer product of two
+ * polynomials of TOOM_N integer coefficients. The coefficients of a and b have
+ * to be bounded by 2^14 and 2^6 in absolute value, such that the 95 integer
+ * coefficients of the product fit in 32 bits. The last coefficient of the
+ * result is always zero.
+ *
+ * @param[out] out The resulting 2 · TOOM_N integer coefficients
+ * @param[in] a The TOOM_N integer coefficients of the polynomial a
+ * @param[in] b The TOOM_N integer coefficients of the small polynomial b
+ */
+extern void __asm_schoolbook48(int32_t *out, const int16_t *a, const int16_t *b);
+
+/* Provide function declarations */
+
+void toom761(int16_t *fg, const int16_t *f, const int8_t *g);
+
+void toom761_forward(int16_t f_toom[TOOM_PRODUCTS][TOOM_N], const int16_t *f);
+void toom761_forward_small(int16_t g_toom[TOOM_PRODUCTS][TOOM_N], const int8_t *g);
+void toom761_product(int16_t *fg, const int16_t f_toom[TOOM_PRODUCTS][TOOM_N], const int16_t g_toom[TOOM_PRODUCTS][TOOM_N]);
+void toom761_shared(int16_t *fg, const int16_t *f, const int16_t g_toom[TOOM_PRODUCTS][TOOM_N]);
+
+#endif
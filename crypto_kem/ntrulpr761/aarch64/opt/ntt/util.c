@@ -28,6 +28,39 @@ inline uint64_t counter_read(void)
     return counter;
 }
 
+/**
+ * @brief Count the refills of the L1 data cache in PMU event counter 0.
+ *
+ * @details Besides the CPU cycle count we are interested in the number of L1
+ * data cache misses of a function, e.g. to compare the working sets of
+ * ntt761() and ntt761_ws(). The kernel module in enableccnt grants access to
+ * the PMU from user space and enables it. This function selects the event
+ * L1D_CACHE_REFILL (0x03) for event counter 0 and enables the counter, such
+ * that it can be read using counter_l1d_read().
+ */
+void counter_l1d_init(void)
+{
+    asm volatile("MSR PMEVTYPER0_EL0, %0" ::"r"((uint64_t)0x03));
+    asm volatile("MSR PMCNTENSET_EL0, %0" ::"r"((uint64_t)0x01));
+    asm volatile("ISB");
+}
+
+/**
+ * @brief Read the current value from the PMEVCNTR0_EL0 System register.
+ *
+ * @details This function is the equivalent of counter_read() for the number of
+ * L1 data cache refills, see counter_l1d_init().
+ *
+ * @return The current value of PMU event counter 0.
+ */
+inline uint64_t counter_l1d_read(void)
+{
+    uint64_t counter = 0;
+    asm volatile("MRS %0, PMEVCNTR0_EL0"
+                 : "=r"(counter));
+    return counter;
+}
+
 /**
  * @brief Sort an array of 64 bit unsigned integers.
  *
@@ -27,6 +27,10 @@
 
 uint64_t counter_read(void);
 
+void counter_l1d_init(void);
+
+uint64_t counter_l1d_read(void);
+
 void sort(uint64_t *arr);
 
 uint64_t median(uint64_t *arr);
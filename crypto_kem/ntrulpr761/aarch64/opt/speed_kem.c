@@ -33,10 +33,12 @@ typedef int8 small;
 /* F3 is always represented as -1,0,1 */
 /* so ZZ_fromF3 is a no-op */
 
-/* x must not be close to top int16 */
-static small F3_freeze(int16 x)
+static const uint14_divisor_t F3_divisor = UINT14_DIVISOR(3);
+
+/* out[i] = x[i] mod 3 in -1,0,1, where out may be x */
+static void F3_freeze_batch(int16 *out,const int16 *x,int n)
 {
-  return int32_mod_uint14(x+1,3)-1;
+  uint14_freeze_batch(out,x,n,&F3_divisor);
 }
 
 /* ----- arithmetic mod q */
@@ -46,28 +48,15 @@ typedef int16 Fq;
 /* always represented as -q12...q12 */
 /* so ZZ_fromFq is a no-op */
 
-/* x must not be close to top int32 */
-Fq Fq_freeze(int32 x)
-{
-  return int32_mod_uint14(x+q12,q)-q12;
-}
+static const uint14_divisor_t Fq_divisor = UINT14_DIVISOR(q);
 
-#ifndef LPR
-
-static Fq Fq_recip(Fq a1)
+/* out[i] = x[i] mod q in -q12...q12, where out may be x */
+/* x[i] must fit in int16 */
+static void Fq_freeze_batch(Fq *out,const Fq *x,int n)
 {
-  int i = 1;
-  Fq ai = a1;
-
-  while (i < q-2) {
-    ai = Fq_freeze(a1*(int32)ai);
-    i += 1;
-  }
-  return ai;
+  uint14_freeze_batch(out,x,n,&Fq_divisor);
 }
 
-#endif
-
 /* ----- Top and Right */
 
 #ifdef LPR
@@ -78,9 +67,13 @@ int8 Top(Fq C)
   return (tau1*(int32)(C+tau0)+16384)>>15;
 }
 
-Fq Right(int8 T)
+/* out[i] = Right(T[i]) = tau3*T[i]-tau2 mod q */
+void Right_batch(Fq *out,const int8 *T,int n)
 {
-  return Fq_freeze(tau3*(int32)T-tau2);
+  int i;
+
+  for (i = 0;i < n;++i) out[i] = tau3*(int32)T[i]-tau2;
+  Fq_freeze_batch(out,out,n);
 }
 #endif
 
@@ -101,90 +94,171 @@ static int Weightw_mask(small *r)
 /* R3_fromR(R_fromRq(r)) */
 static void R3_fromRq(small *out,const Fq *r)
 {
+  Fq t[p];
   int i;
-  for (i = 0;i < p;++i) out[i] = F3_freeze(r[i]);
+
+  F3_freeze_batch(t,r,p);
+  for (i = 0;i < p;++i) out[i] = t[i];
 }
 
 /* h = f*g in the ring R3 */
 static void R3_mult(small *h,const small *f,const small *g)
 {
-  small fg[p+p-1];
-  small result;
-  int i,j;
-
-  for (i = 0;i < p;++i) {
-    result = 0;
-    for (j = 0;j <= i;++j) result = F3_freeze(result+f[j]*g[i-j]);
-    fg[i] = result;
-  }
-  for (i = p;i < p+p-1;++i) {
-    result = 0;
-    for (j = i-p+1;j < p;++j) result = F3_freeze(result+f[j]*g[i-j]);
-    fg[i] = result;
-  }
-
-  for (i = p+p-2;i >= p;--i) {
-    fg[i-p] = F3_freeze(fg[i-p]+fg[i]);
-    fg[i-p+1] = F3_freeze(fg[i-p+1]+fg[i]);
-  }
-
-  for (i = 0;i < p;++i) h[i] = fg[i];
+  ntt761_r3(h, f, g);
 }
 
 /* returns 0 if recip succeeded; else -1 */
 static int R3_recip(small *out,const small *in)
 {
-  small f[p+1],g[p+1],v[p+1],r[p+1];
-  int i,loop,delta;
-  int sign,swap,t;
+  return recip761_r3(out,in);
+}
 
-  for (i = 0;i < p+1;++i) v[i] = 0;
-  for (i = 0;i < p+1;++i) r[i] = 0;
-  r[0] = 1;
-  for (i = 0;i < p;++i) f[i] = 0;
-  f[0] = 1; f[p-1] = f[p] = -1;
-  for (i = 0;i < p;++i) g[p-1-i] = in[i];
-  g[p] = 0;
+#endif
 
-  delta = 1;
+/* ----- polynomials mod q */
 
-  for (loop = 0;loop < 2*p-1;++loop) {
-    for (i = p;i > 0;--i) v[i] = v[i-1];
-    v[0] = 0;
+/* h = f*g in the ring Rq */
+void Rq_mult_small(Fq *h,const Fq *f,const small *g)
+{
+#if defined(NTT16)
+  ntt761_16(h, f, g);
+#elif defined(TOOM)
+  toom761(h, f, g);
+#elif defined(KRONECKER)
+  kron761(h, f, g);
+#else
+  ntt761(h, f, g);
+#endif
+}
 
-    sign = -g[0]*f[0];
-    swap = int16_negative_mask(-delta) & int16_nonzero_mask(g[0]);
-    delta ^= swap&(delta^-delta);
-    delta += 1;
+#ifndef LPR
 
-    for (i = 0;i < p+1;++i) {
-      t = swap&(f[i]^g[i]); f[i] ^= t; g[i] ^= t;
-      t = swap&(v[i]^r[i]); v[i] ^= t; r[i] ^= t;
-    }
+/* h = f*g in the ring Rq, for a small g of any weight */
+static void Rq_mult_small_full(Fq *h,const Fq *f,const small *g)
+{
+#if defined(NTT16)
+  ntt761_16(h, f, g);
+#elif defined(TOOM)
+  toom761(h, f, g);
+#elif defined(KRONECKER)
+  kron761(h, f, g);
+#else
+  ntt761_full(h, f, g);
+#endif
+}
 
-    for (i = 0;i < p+1;++i) g[i] = F3_freeze(g[i]+sign*f[i]);
-    for (i = 0;i < p+1;++i) r[i] = F3_freeze(r[i]+sign*v[i]);
+#endif
 
-    for (i = 0;i < p;++i) g[i] = g[i+1];
-    g[p] = 0;
-  }
+/* gt = g transformed for Rq_mult_small_ntt */
+void Rq_small_ntt(small_ntt gt,const small *g)
+{
+#if defined(NTT16)
+  ntt761_16_forward_small(gt, g);
+#elif defined(TOOM)
+  toom761_forward_small(gt, g);
+#elif defined(KRONECKER)
+  kron761_forward_small(gt, g);
+#else
+  ntt761_forward_small(gt, g);
+#endif
+}
 
-  sign = f[0];
-  for (i = 0;i < p;++i) out[i] = sign*v[p-1-i];
+/* h = f*g in the ring Rq, where gt = Rq_small_ntt(g) */
+void Rq_mult_small_ntt(Fq *h,const Fq *f,const small_ntt gt)
+{
+#if defined(NTT16)
+  ntt761_16_shared(h, f, gt);
+#elif defined(TOOM)
+  toom761_shared(h, f, gt);
+#elif defined(KRONECKER)
+  kron761_shared(h, f, gt);
+#else
+  ntt761_shared(h, f, gt);
+#endif
+}
 
-  return int16_nonzero_mask(delta);
+/* ft = f transformed for Rq_mult_ntt */
+static void Rq_ntt(Fq_ntt ft,const Fq *f)
+{
+#if defined(NTT16)
+  ntt761_16_forward(ft, f);
+#elif defined(TOOM)
+  toom761_forward(ft, f);
+#elif defined(KRONECKER)
+  kron761_forward(ft, f);
+#else
+  ntt761_forward(ft, f);
+#endif
 }
 
+/* h = f*g in the ring Rq, where ft = Rq_ntt(f) and gt = Rq_small_ntt(g) */
+/* NTRU LPRime only needs the full product for the alternative backends */
+#if !defined(LPR) || defined(NTT16) || defined(TOOM) || defined(KRONECKER)
+static void Rq_mult_ntt(Fq *h,const Fq_ntt ft,const small_ntt gt)
+{
+#if defined(NTT16)
+  ntt761_16_product(h, ft, gt);
+#elif defined(TOOM)
+  toom761_product(h, ft, gt);
+#elif defined(KRONECKER)
+  kron761_product(h, ft, gt);
+#else
+  ntt761_product(h, ft, gt);
+#endif
+}
 #endif
 
-/* ----- polynomials mod q */
+/* s = Rounded_encode(Round(f*g)) in the ring Rq */
+static void Rq_mult_small_rounded(unsigned char *s,const Fq *f,const small *g)
+{
+#if defined(NTT16) || defined(TOOM) || defined(KRONECKER)
+  Fq h[p];
+  uint16 R[p];
+  int i;
 
-/* h = f*g in the ring Rq */
-void Rq_mult_small(Fq *h,const Fq *f,const small *g)
+  Rq_mult_small(h,f,g);
+  for (i = 0;i < p;++i) R[i] = ((h[i]+q12+1)*10923)>>15; /* Round(h) = 3*R-q12 */
+  encode761_rounded(s,R);
+#else
+  ntt761_rounded(s, f, g);
+#endif
+}
+
+#ifdef LPR
+
+/* s = Rounded_encode(Round(f*g)), where ft = Rq_ntt(f) and gt = Rq_small_ntt(g) */
+static void Rq_mult_ntt_rounded(unsigned char *s,const Fq_ntt ft,const small_ntt gt)
 {
-  ntt761(h, f, g);
+#if defined(NTT16) || defined(TOOM) || defined(KRONECKER)
+  Fq h[p];
+  uint16 R[p];
+  int i;
+
+  Rq_mult_ntt(h,ft,gt);
+  for (i = 0;i < p;++i) R[i] = ((h[i]+q12+1)*10923)>>15; /* Round(h) = 3*R-q12 */
+  encode761_rounded(s,R);
+#else
+  ntt761_product_rounded(s, ft, gt);
+#endif
+}
+
+/* h = the first I coefficients of f*g in the ring Rq, */
+/* where ft = Rq_ntt(f) and gt = Rq_small_ntt(g) */
+static void Rq_mult_small_lowI(Fq *h,const Fq_ntt ft,const small_ntt gt)
+{
+#if defined(NTT16) || defined(TOOM) || defined(KRONECKER)
+  Fq fg[p];
+  int i;
+
+  Rq_mult_ntt(fg,ft,gt);
+  for (i = 0;i < I;++i) h[i] = fg[i];
+#else
+  ntt761_product_low(h, ft, gt);
+#endif
 }
 
+#endif
+
 #ifndef LPR
 
 /* h = 3f in Rq */
@@ -192,55 +266,15 @@ static void Rq_mult3(Fq *h,const Fq *f)
 {
   int i;
 
-  for (i = 0;i < p;++i) h[i] = Fq_freeze(3*f[i]);
+  for (i = 0;i < p;++i) h[i] = 3*f[i];
+  Fq_freeze_batch(h,h,p);
 }
 
 /* out = 1/(3*in) in Rq */
 /* returns 0 if recip succeeded; else -1 */
 static int Rq_recip3(Fq *out,const small *in)
 {
-  Fq f[p+1],g[p+1],v[p+1],r[p+1];
-  int i,loop,delta;
-  int swap,t;
-  int32 f0,g0;
-  Fq scale;
-
-  for (i = 0;i < p+1;++i) v[i] = 0;
-  for (i = 0;i < p+1;++i) r[i] = 0;
-  r[0] = Fq_recip(3);
-  for (i = 0;i < p;++i) f[i] = 0;
-  f[0] = 1; f[p-1] = f[p] = -1;
-  for (i = 0;i < p;++i) g[p-1-i] = in[i];
-  g[p] = 0;
-
-  delta = 1;
-
-  for (loop = 0;loop < 2*p-1;++loop) {
-    for (i = p;i > 0;--i) v[i] = v[i-1];
-    v[0] = 0;
-
-    swap = int16_negative_mask(-delta) & int16_nonzero_mask(g[0]);
-    delta ^= swap&(delta^-delta);
-    delta += 1;
-
-    for (i = 0;i < p+1;++i) {
-      t = swap&(f[i]^g[i]); f[i] ^= t; g[i] ^= t;
-      t = swap&(v[i]^r[i]); v[i] ^= t; r[i] ^= t;
-    }
-
-    f0 = f[0];
-    g0 = g[0];
-    for (i = 0;i < p+1;++i) g[i] = Fq_freeze(f0*g[i]-g0*f[i]);
-    for (i = 0;i < p+1;++i) r[i] = Fq_freeze(f0*r[i]-g0*v[i]);
-
-    for (i = 0;i < p;++i) g[i] = g[i+1];
-    g[p] = 0;
-  }
-
-  scale = Fq_recip(f[0]);
-  for (i = 0;i < p;++i) out[i] = Fq_freeze(scale*(int32)v[p-1-i]);
-
-  return int16_nonzero_mask(delta);
+  return recip761_rq3(out,in);
 }
 
 #endif
@@ -249,8 +283,11 @@ static int Rq_recip3(Fq *out,const small *in)
 
 void Round(Fq *out,const Fq *a)
 {
+  Fq t[p];
   int i;
-  for (i = 0;i < p;++i) out[i] = a[i]-F3_freeze(a[i]);
+
+  F3_freeze_batch(t,a,p);
+  for (i = 0;i < p;++i) out[i] = a[i]-t[i];
 }
 
 /* ----- sorting to generate short polynomial */
@@ -346,21 +383,19 @@ static void KeyGen(Fq *h,small *f,small *ginv)
   }
   Short_random(f);
   Rq_recip3(finv,f); /* always works */
-  Rq_mult_small(h,finv,g);
+  Rq_mult_small_full(h,finv,g);
 }
 
-/* c = Encrypt(r,h) */
-static void Encrypt(Fq *c,const small *r,const Fq *h)
+/* c = Encrypt(r,h), where c is encoded by Rounded_encode */
+static void Encrypt(unsigned char *c,const small *r,const Fq *h)
 {
-  Fq hr[p];
-
-  Rq_mult_small(hr,h,r);
-  Round(c,hr);
+  Rq_mult_small_rounded(c,h,r);
 }
 
-/* r = Decrypt(c,(f,ginv)) */
-static void Decrypt(small *r,const Fq *c,const small *f,const small *ginv)
+/* r = Decrypt(c,(f,ginv)), where c is transformed by Rq_ntt */
+static void Decrypt(small *r,const Fq_ntt c,const small *f,const small *ginv)
 {
+  small_ntt ft;
   Fq cf[p];
   Fq cf3[p];
   small e[p];
@@ -368,7 +403,8 @@ static void Decrypt(small *r,const Fq *c,const small *f,const small *ginv)
   int mask;
   int i;
 
-  Rq_mult_small(cf,c,f);
+  Rq_small_ntt(ft,f);
+  Rq_mult_ntt(cf,c,ft);
   Rq_mult3(cf3,cf);
   R3_fromRq(e,cf3);
   R3_mult(ev,e,ginv);
@@ -384,38 +420,61 @@ static void Decrypt(small *r,const Fq *c,const small *f,const small *ginv)
 
 #ifdef LPR
 
-/* (G,A),a = KeyGen(G); leaves G unchanged */
-void KeyGen(Fq *A,small *a,const Fq *G)
+/* (G,A),a = KeyGen(G); leaves G unchanged; A is encoded by Rounded_encode */
+void KeyGen(unsigned char *A,small *a,const Fq *G)
 {
-  Fq aG[p];
-
   Short_random(a);
-  Rq_mult_small(aG,G,a);
-  Round(A,aG);
+  Rq_mult_small_rounded(A,G,a);
 }
 
-/* B,T = Encrypt(r,(G,A),b) */
-static void Encrypt(Fq *B,int8 *T,const int8 *r,const Fq *G,const Fq *A,const small *b)
+/* B,T = Encrypt(r,(G,A),b), where G and A are transformed by Rq_ntt */
+/* and B is encoded by Rounded_encode */
+static void Encrypt_ntt(unsigned char *B,int8 *T,const int8 *r,const Fq_ntt G,const Fq_ntt A,const small *b)
 {
-  Fq bG[p];
-  Fq bA[p];
+  Fq bA[I];
+  Fq t[I];
+  small_ntt bt;
   int i;
 
-  Rq_mult_small(bG,G,b);
-  Round(B,bG);
-  Rq_mult_small(bA,A,b);
-  for (i = 0;i < I;++i) T[i] = Top(Fq_freeze(bA[i]+r[i]*q12));
+  Rq_small_ntt(bt,b);
+  Rq_mult_ntt_rounded(B,G,bt);
+  Rq_mult_small_lowI(bA,A,bt);
+  for (i = 0;i < I;++i) t[i] = bA[i]+r[i]*q12;
+  Fq_freeze_batch(t,t,I);
+  for (i = 0;i < I;++i) T[i] = Top(t[i]);
+}
+
+/* B,T = Encrypt(r,(G,A),b), where A is transformed by Rq_ntt */
+/* and B is encoded by Rounded_encode */
+static void Encrypt(unsigned char *B,int8 *T,const int8 *r,const Fq *G,const Fq_ntt A,const small *b)
+{
+  Fq_ntt Gt;
+
+  Rq_ntt(Gt,G);
+  Encrypt_ntt(B,T,r,Gt,A,b);
 }
 
-/* r = Decrypt((B,T),a) */
-void Decrypt(int8 *r,const Fq *B,const int8 *T,const small *a)
+/* r = Decrypt((B,T),a), where B and a are transformed by Rq_ntt and Rq_small_ntt */
+static void Decrypt_ntt(int8 *r,const Fq_ntt B,const int8 *T,const small_ntt at)
 {
-  Fq aB[p];
+  Fq aB[I];
+  Fq t[I];
   int i;
 
-  Rq_mult_small(aB,B,a);
-  for (i = 0;i < I;++i)
-    r[i] = -int16_negative_mask(Fq_freeze(Right(T[i])-aB[i]+4*w+1));
+  Rq_mult_small_lowI(aB,B,at);
+  Right_batch(t,T,I);
+  for (i = 0;i < I;++i) t[i] = t[i]-aB[i]+4*w+1;
+  Fq_freeze_batch(t,t,I);
+  for (i = 0;i < I;++i) r[i] = -int16_negative_mask(t[i]);
+}
+
+/* r = Decrypt((B,T),a), where B is transformed by Rq_ntt */
+void Decrypt(int8 *r,const Fq_ntt B,const int8 *T,const small *a)
+{
+  small_ntt at;
+
+  Rq_small_ntt(at,a);
+  Decrypt_ntt(r,B,T,at);
 }
 
 #endif
@@ -429,9 +488,7 @@ typedef int8 Inputs[I]; /* passed by reference */
 
 void Inputs_encode(unsigned char *s,const Inputs r)
 {
-  int i;
-  for (i = 0;i < Inputs_bytes;++i) s[i] = 0;
-  for (i = 0;i < I;++i) s[i>>3] |= r[i]<<(i&7);
+  pack761_inputs(s,r);
 }
 
 #endif
@@ -481,7 +538,8 @@ void Generator(Fq *G,const unsigned char *k)
   int i;
 
   Expand(L,k);
-  for (i = 0;i < p;++i) G[i] = uint32_mod_uint14(L[i],q)-q12;
+  uint14_mod_batch((uint16 *) G,L,p,&Fq_divisor);
+  for (i = 0;i < p;++i) G[i] -= q12;
 }
 
 /* out = HashShort(r) */
@@ -503,8 +561,8 @@ void HashShort(small *out,const Inputs r)
 
 #ifdef LPR
 
-/* (S,A),a = XKeyGen() */
-static void XKeyGen(unsigned char *S,Fq *A,small *a)
+/* (S,A),a = XKeyGen(); A is encoded by Rounded_encode */
+static void XKeyGen(unsigned char *S,unsigned char *A,small *a)
 {
   Fq G[p];
 
@@ -513,8 +571,9 @@ static void XKeyGen(unsigned char *S,Fq *A,small *a)
   KeyGen(A,a,G);
 }
 
-/* B,T = XEncrypt(r,(S,A)) */
-static void XEncrypt(Fq *B,int8 *T,const int8 *r,const unsigned char *S,const Fq *A)
+/* B,T = XEncrypt(r,(S,A)), where A is transformed by Rq_ntt */
+/* and B is encoded by Rounded_encode */
+static void XEncrypt(unsigned char *B,int8 *T,const int8 *r,const unsigned char *S,const Fq_ntt A)
 {
   Fq G[p];
   small b[p];
@@ -536,34 +595,12 @@ static void XEncrypt(Fq *B,int8 *T,const int8 *r,const unsigned char *S,const Fq
 
 void Small_encode(unsigned char *s,const small *f)
 {
-  small x;
-  int i;
-
-  for (i = 0;i < p/4;++i) {
-    x = *f++ + 1;
-    x += (*f++ + 1)<<2;
-    x += (*f++ + 1)<<4;
-    x += (*f++ + 1)<<6;
-    *s++ = x;
-  }
-  x = *f++ + 1;
-  *s++ = x;
+  pack761_small(s,f);
 }
 
 void Small_decode(small *f,const unsigned char *s)
 {
-  unsigned char x;
-  int i;
-
-  for (i = 0;i < p/4;++i) {
-    x = *s++;
-    *f++ = ((small)(x&3))-1; x >>= 2;
-    *f++ = ((small)(x&3))-1; x >>= 2;
-    *f++ = ((small)(x&3))-1; x >>= 2;
-    *f++ = ((small)(x&3))-1;
-  }
-  x = *s++;
-  *f++ = ((small)(x&3))-1;
+  unpack761_small(f,s);
 }
 
 /* ----- encoding general polynomials */
@@ -572,21 +609,19 @@ void Small_decode(small *f,const unsigned char *s)
 
 static void Rq_encode(unsigned char *s,const Fq *r)
 {
-  uint16 R[p],M[p];
+  uint16 R[p];
   int i;
 
   for (i = 0;i < p;++i) R[i] = r[i]+q12;
-  for (i = 0;i < p;++i) M[i] = q;
-  Encode(s,R,M,p);
+  encode761_rq(s,R);
 }
 
 static void Rq_decode(Fq *r,const unsigned char *s)
 {
-  uint16 R[p],M[p];
+  uint16 R[p];
   int i;
 
-  for (i = 0;i < p;++i) M[i] = q;
-  Decode(R,s,M,p);
+  decode761_rq(R,s);
   for (i = 0;i < p;++i) r[i] = ((Fq)R[i])-q12;
 }
 
@@ -596,24 +631,38 @@ static void Rq_decode(Fq *r,const unsigned char *s)
 
 void Rounded_encode(unsigned char *s,const Fq *r)
 {
-  uint16 R[p],M[p];
+  uint16 R[p];
   int i;
 
   for (i = 0;i < p;++i) R[i] = ((r[i]+q12)*10923)>>15;
-  for (i = 0;i < p;++i) M[i] = (q+2)/3;
-  Encode(s,R,M,p);
+  encode761_rounded(s,R);
 }
 
 void Rounded_decode(Fq *r,const unsigned char *s)
 {
-  uint16 R[p],M[p];
+  uint16 R[p];
   int i;
 
-  for (i = 0;i < p;++i) M[i] = (q+2)/3;
-  Decode(R,s,M,p);
+  decode761_rounded(R,s);
   for (i = 0;i < p;++i) r[i] = R[i]*3-q12;
 }
 
+/* ft = Rq_ntt(Rounded_decode(s)) */
+void Rounded_decode_ntt(Fq_ntt ft,const unsigned char *s)
+{
+#if defined(NTT16) || defined(TOOM) || defined(KRONECKER)
+  uint16 R[p];
+  Fq r[p];
+  int i;
+
+  decode761_rounded(R,s);
+  for (i = 0;i < p;++i) r[i] = R[i]*3-q12;
+  Rq_ntt(ft,r);
+#else
+  ntt761_forward_rounded(ft, s);
+#endif
+}
+
 /* ----- encoding top polynomials */
 
 #ifdef LPR
@@ -622,18 +671,12 @@ void Rounded_decode(Fq *r,const unsigned char *s)
 
 void Top_encode(unsigned char *s,const int8 *T)
 {
-  int i;
-  for (i = 0;i < Top_bytes;++i)
-    s[i] = T[2*i]+(T[2*i+1]<<4);
+  pack761_top(s,T);
 }
 
 void Top_decode(int8 *T,const unsigned char *s)
 {
-  int i;
-  for (i = 0;i < Top_bytes;++i) {
-    T[2*i] = s[i]&15;
-    T[2*i+1] = s[i]>>4;
-  }
+  unpack761_top(T,s);
 }
 
 #endif
@@ -667,21 +710,19 @@ static void ZKeyGen(unsigned char *pk,unsigned char *sk)
 static void ZEncrypt(unsigned char *C,const Inputs r,const unsigned char *pk)
 {
   Fq h[p];
-  Fq c[p];
   Rq_decode(h,pk);
-  Encrypt(c,r,h);
-  Rounded_encode(C,c);
+  Encrypt(C,r,h);
 }
 
 /* r = ZDecrypt(C,sk) */
 static void ZDecrypt(Inputs r,const unsigned char *C,const unsigned char *sk)
 {
   small f[p],v[p];
-  Fq c[p];
+  Fq_ntt c;
 
   Small_decode(f,sk); sk += Small_bytes;
   Small_decode(v,sk);
-  Rounded_decode(c,C);
+  Rounded_decode_ntt(c,C);
   Decrypt(r,c,f,v);
 }
 
@@ -707,24 +748,20 @@ void Inputs_random(Inputs r)
 /* pk,sk = ZKeyGen() */
 static void ZKeyGen(unsigned char *pk,unsigned char *sk)
 {
-  Fq A[p];
   small a[p];
 
-  XKeyGen(pk,A,a); pk += Seeds_bytes;
-  Rounded_encode(pk,A);
+  XKeyGen(pk,pk+Seeds_bytes,a);
   Small_encode(sk,a);
 }
 
 /* c = ZEncrypt(r,pk) */
 static void ZEncrypt(unsigned char *c,const Inputs r,const unsigned char *pk)
 {
-  Fq A[p];
-  Fq B[p];
+  Fq_ntt A;
   int8 T[I];
 
-  Rounded_decode(A,pk+Seeds_bytes);
-  XEncrypt(B,T,r,pk,A);
-  Rounded_encode(c,B); c += Rounded_bytes;
+  Rounded_decode_ntt(A,pk+Seeds_bytes);
+  XEncrypt(c,T,r,pk,A); c += Rounded_bytes;
   Top_encode(c,T);
 }
 
@@ -732,11 +769,11 @@ static void ZEncrypt(unsigned char *c,const Inputs r,const unsigned char *pk)
 static void ZDecrypt(Inputs r,const unsigned char *c,const unsigned char *sk)
 {
   small a[p];
-  Fq B[p];
+  Fq_ntt B;
   int8 T[I];
 
   Small_decode(a,sk);
-  Rounded_decode(B,c);
+  Rounded_decode_ntt(B,c);
   Top_decode(T,c+Rounded_bytes);
   XDecrypt(r,B,T,a);
 }
@@ -879,3 +916,144 @@ int crypto_kem_dec(unsigned char *k,const unsigned char *c,const unsigned char *
   Decap(k,c,sk);
   return 0;
 }
+
+/* ----- NTRU LPRime with precomputed transforms */
+
+#ifdef LPR
+
+/* crypto_kem_ntrulpr761.h spells out the sizes of the NTT domain */
+#if crypto_kem_ntrulpr761_ref_NTTROWS != GP0 || GP1 != 512 || NTT16_ROWS != 6
+#error "crypto_kem_ntrulpr761_ref_ntt does not match ntt/ntt_params.h"
+#endif
+#if TOOM_PRODUCTS != 63 || TOOM_N != 48 || KRON_WORDS != 265
+#error "crypto_kem_ntrulpr761_ref_ntt does not match ntt/ntt_params.h"
+#endif
+
+/* the rows of a crypto_kem_ntrulpr761_ref_ntt used by the selected backend */
+#if defined(NTT16)
+#define NTT_POLY(t) ((t).ntt16)
+#elif defined(TOOM)
+#define NTT_POLY(t) ((t).toom)
+#elif defined(KRONECKER)
+#define NTT_POLY(t) ((t).kron)
+#else
+#define NTT_POLY(t) ((t).ntt32)
+#endif
+
+/* G,A = ExpandPublicKey(pk); G and A are transformed */
+static void ExpandPublicKey(Fq_ntt G,Fq_ntt A,const unsigned char *pk)
+{
+  Fq F[p];
+
+  Generator(F,pk);
+  Rq_ntt(G,F);
+  Rounded_decode_ntt(A,pk+Seeds_bytes);
+}
+
+/* c = ZEncrypt(r,pk), where G,A = ExpandPublicKey(pk) */
+static void ZEncrypt_ntt(unsigned char *c,const Inputs r,const Fq_ntt G,const Fq_ntt A)
+{
+  small b[p];
+  int8 T[I];
+
+  HashShort(b,r);
+  Encrypt_ntt(c,T,r,G,A,b); c += Rounded_bytes;
+  Top_encode(c,T);
+}
+
+/* c,r_enc = Hide(r,pk,cache), where G,A = ExpandPublicKey(pk) */
+static void Hide_ntt(unsigned char *c,unsigned char *r_enc,const Inputs r,const unsigned char *pk,const unsigned char *cache,const Fq_ntt G,const Fq_ntt A)
+{
+  Inputs_encode(r_enc,r);
+  ZEncrypt_ntt(c,r,G,A); c += Ciphertexts_bytes;
+  HashConfirm(c,r_enc,pk,cache);
+}
+
+/* ctx = EncapContext(pk) */
+static void EncapContext(crypto_kem_enc_context *ctx,const unsigned char *pk)
+{
+  int i;
+
+  ExpandPublicKey(NTT_POLY(ctx->G),NTT_POLY(ctx->A),pk);
+  for (i = 0;i < PublicKeys_bytes;++i) ctx->pk[i] = pk[i];
+  Hash_prefix(ctx->cache,4,pk,PublicKeys_bytes);
+}
+
+/* c,k = Encap(pk), where ctx = EncapContext(pk) */
+static void Encap_ctx(unsigned char *c,unsigned char *k,const crypto_kem_enc_context *ctx)
+{
+  Inputs r;
+  unsigned char r_enc[Inputs_bytes];
+
+  Inputs_random(r);
+  Hide_ntt(c,r_enc,r,ctx->pk,ctx->cache,NTT_POLY(ctx->G),NTT_POLY(ctx->A));
+  HashSession(k,1,r_enc,c);
+}
+
+/* esk = ExpandSecretKey(sk); a, G and A are transformed */
+static void ExpandSecretKey(crypto_kem_sk_expanded *esk,const unsigned char *sk)
+{
+  small a[p];
+  int i;
+
+  Small_decode(a,sk);
+  Rq_small_ntt(NTT_POLY(esk->a),a);
+  ExpandPublicKey(NTT_POLY(esk->G),NTT_POLY(esk->A),sk+SecretKeys_bytes);
+  for (i = 0;i < crypto_kem_SECRETKEYBYTES;++i) esk->sk[i] = sk[i];
+}
+
+/* r = ZDecrypt(C,sk), where esk = ExpandSecretKey(sk) */
+static void ZDecrypt_expanded(Inputs r,const unsigned char *c,const crypto_kem_sk_expanded *esk)
+{
+  Fq_ntt B;
+  int8 T[I];
+
+  Rounded_decode_ntt(B,c);
+  Top_decode(T,c+Rounded_bytes);
+  Decrypt_ntt(r,B,T,NTT_POLY(esk->a));
+}
+
+/* k = Decap(c,sk), where esk = ExpandSecretKey(sk) */
+static void Decap_expanded(unsigned char *k,const unsigned char *c,const crypto_kem_sk_expanded *esk)
+{
+  const unsigned char *pk = esk->sk + SecretKeys_bytes;
+  const unsigned char *rho = pk + PublicKeys_bytes;
+  const unsigned char *cache = rho + Inputs_bytes;
+  Inputs r;
+  unsigned char r_enc[Inputs_bytes];
+  unsigned char cnew[Ciphertexts_bytes+Confirm_bytes];
+  int mask;
+  int i;
+
+  ZDecrypt_expanded(r,c,esk);
+  Hide_ntt(cnew,r_enc,r,pk,cache,NTT_POLY(esk->G),NTT_POLY(esk->A));
+  mask = Ciphertexts_diff_mask(c,cnew);
+  for (i = 0;i < Inputs_bytes;++i) r_enc[i] ^= mask&(r_enc[i]^rho[i]);
+  HashSession(k,1+mask,r_enc,c);
+}
+
+int crypto_kem_enc_ctx_init(crypto_kem_enc_context *ctx,const unsigned char *pk)
+{
+  EncapContext(ctx,pk);
+  return 0;
+}
+
+int crypto_kem_enc_ctx(unsigned char *c,unsigned char *k,const crypto_kem_enc_context *ctx)
+{
+  Encap_ctx(c,k,ctx);
+  return 0;
+}
+
+int crypto_kem_sk_expand(crypto_kem_sk_expanded *esk,const unsigned char *sk)
+{
+  ExpandSecretKey(esk,sk);
+  return 0;
+}
+
+int crypto_kem_dec_expanded(unsigned char *k,const unsigned char *c,const crypto_kem_sk_expanded *esk)
+{
+  Decap_expanded(k,c,esk);
+  return 0;
+}
+
+#endif
@@ -19,13 +19,26 @@
 #include "int32.h"
 #include "uint16.h"
 #include "uint32.h"
+#include "uint64.h"
 #include "crypto_sort_uint32.h"
-#include "Encode.h"
-#include "Decode.h"
+#include "ntt/mult.h"
 
 typedef int16_t Fq;
 typedef int8_t small;
 typedef int8 Inputs[I];
+#if defined(NTT16)
+typedef int16 small_ntt[NTT16_ROWS][GP1];
+typedef int16 Fq_ntt[NTT16_ROWS][GP1];
+#elif defined(TOOM)
+typedef int16 small_ntt[TOOM_PRODUCTS][TOOM_N];
+typedef int16 Fq_ntt[TOOM_PRODUCTS][TOOM_N];
+#elif defined(KRONECKER)
+typedef uint64 small_ntt[KRON_WORDS];
+typedef uint64 Fq_ntt[KRON_WORDS];
+#else
+typedef int32 small_ntt[GP0][GP1];
+typedef int32 Fq_ntt[GP0][GP1];
+#endif
 
 /* Provide function declarations */
 
@@ -33,6 +46,8 @@ void Seeds_random(unsigned char *s);
 void Generator(Fq *G, const unsigned char *k);
 void Short_random(small *out);
 void Rq_mult_small(Fq *h, const Fq *f, const small *g);
+void Rq_small_ntt(small_ntt gt, const small *g);
+void Rq_mult_small_ntt(Fq *h, const Fq *f, const small_ntt gt);
 void Round(Fq *out, const Fq *a);
 void Rounded_encode(unsigned char *s, const Fq *r);
 void Small_encode(unsigned char *s, const small *f);
@@ -43,23 +58,23 @@ void Inputs_random(Inputs r);
 void Inputs_encode(unsigned char *s, const Inputs r);
 void Short_fromlist(small *out, const uint32 *in);
 void Rounded_decode(Fq *r, const unsigned char *s);
+void Rounded_decode_ntt(Fq_ntt ft, const unsigned char *s);
 void Top_encode(unsigned char *s, const int8 *T);
 void Top_decode(int8 *T, const unsigned char *s);
 void HashConfirm(unsigned char *h, const unsigned char *r, const unsigned char *pk, const unsigned char *cache);
 void HashSession(unsigned char *k, int b, const unsigned char *y, const unsigned char *z);
 
 void Hide(unsigned char *c, unsigned char *r_enc, const Inputs r, const unsigned char *pk, const unsigned char *cache);
-void Decrypt(int8 *r, const Fq *B, const int8 *T, const small *a);
+void Decrypt(int8 *r, const Fq_ntt B, const int8 *T, const small *a);
 
 void HashShort(small *out,const Inputs r);
 
 uint32 urandom32(void);
 void Expand(uint32 *L,const unsigned char *k);
-Fq Fq_freeze(int32 x);
 int8 Top(Fq C);
 void Small_decode(small *f,const unsigned char *s);
 int Ciphertexts_diff_mask(const unsigned char *c,const unsigned char *c2);
 int int16_negative_mask(int16 x);
-Fq Right(int8 T);
+void Right_batch(Fq *out,const int8 *T,int n);
 
 #endif
@@ -66,6 +66,47 @@ int main()
         return KAT_CRYPTO_FAILURE;
     }
 
+    static crypto_kem_enc_context ctx;
+
+    if ((ret_val = crypto_kem_enc_ctx_init(&ctx, pk)) != 0)
+    {
+        return KAT_CRYPTO_FAILURE;
+    }
+
+    if ((ret_val = crypto_kem_enc_ctx(ct, ss, &ctx)) != 0)
+    {
+        return KAT_CRYPTO_FAILURE;
+    }
+
+    if ((ret_val = crypto_kem_dec(ss1, ct, sk)) != 0)
+    {
+        return KAT_CRYPTO_FAILURE;
+    }
+
+    if (memcmp(ss, ss1, crypto_kem_BYTES))
+    {
+        return KAT_CRYPTO_FAILURE;
+    }
+
+    static crypto_kem_sk_expanded esk;
+
+    if ((ret_val = crypto_kem_sk_expand(&esk, sk)) != 0)
+    {
+        return KAT_CRYPTO_FAILURE;
+    }
+
+    memset(ss1, 0, crypto_kem_BYTES);
+
+    if ((ret_val = crypto_kem_dec_expanded(ss1, ct, &esk)) != 0)
+    {
+        return KAT_CRYPTO_FAILURE;
+    }
+
+    if (memcmp(ss, ss1, crypto_kem_BYTES))
+    {
+        return KAT_CRYPTO_FAILURE;
+    }
+
     /* Perform benchmarking on the individual components */
 
     uint64_t t0[NTESTS];
@@ -138,6 +179,240 @@ int main()
     }
     benchmark(t0, "Rq_mult_small()");
 
+    /* Compare all multiplication backends, independent of the one that is
+     * selected at build time */
+
+    Fq aG_alt[p];
+
+    ntt761_full(aG_alt, G, a);
+    if (memcmp(aG, aG_alt, sizeof(aG)))
+    {
+        return KAT_CRYPTO_FAILURE;
+    }
+
+#if NTRU_P == 761
+    ntt761_16(aG_alt, G, a);
+    if (memcmp(aG, aG_alt, sizeof(aG)))
+    {
+        return KAT_CRYPTO_FAILURE;
+    }
+
+    toom761(aG_alt, G, a);
+    if (memcmp(aG, aG_alt, sizeof(aG)))
+    {
+        return KAT_CRYPTO_FAILURE;
+    }
+
+    kron761(aG_alt, G, a);
+    if (memcmp(aG, aG_alt, sizeof(aG)))
+    {
+        return KAT_CRYPTO_FAILURE;
+    }
+#endif
+
+    /* The workspace variant keeps all intermediate results in a single arena,
+     * which is reused for every call */
+
+    static int32_t ntt_ws[NTT761_WORKSPACE_BYTES / sizeof(int32_t)] __attribute__((aligned(64)));
+
+    ntt761_ws(aG_alt, G, a, ntt_ws);
+    if (memcmp(aG, aG_alt, sizeof(aG)))
+    {
+        return KAT_CRYPTO_FAILURE;
+    }
+
+    /* The batch NTT computes 4 products at once, so we use 4 copies of the
+     * same operands and compare each of the results */
+
+    Fq aG_x4[NTT_X4][p];
+    Fq *aG_x4_out[NTT_X4] = {aG_x4[0], aG_x4[1], aG_x4[2], aG_x4[3]};
+    const Fq *G_x4[NTT_X4] = {G, G, G, G};
+    const small *a_x4[NTT_X4] = {a, a, a, a};
+
+    ntt761_x4(aG_x4_out, G_x4, a_x4);
+    for (i = 0; i < NTT_X4; i++)
+    {
+        if (memcmp(aG, aG_x4[i], sizeof(aG)))
+        {
+            return KAT_CRYPTO_FAILURE;
+        }
+    }
+
+    /*----------------------------------------*/
+    for (i = 0; i < NTESTS; i++)
+    {
+        t0[i] = counter_read();
+        ntt761(aG, G, a);
+    }
+    benchmark(t0, "ntt761()");
+
+    /*----------------------------------------*/
+    for (i = 0; i < NTESTS; i++)
+    {
+        t0[i] = counter_read();
+        ntt761_ws(aG_alt, G, a, ntt_ws);
+    }
+    benchmark(t0, "ntt761_ws()");
+
+    /* The number of L1 data cache refills instead of the cycle count. The
+     * transformed g, the transformed f and their product are separate
+     * matrices when using ntt761_shared(), whereas ntt761_ws() computes the
+     * product inplace */
+
+    int32_t ntt_g[GP0][GP1];
+
+    counter_l1d_init();
+
+    /*----------------------------------------*/
+    for (i = 0; i < NTESTS; i++)
+    {
+        t0[i] = counter_l1d_read();
+        ntt761_forward_small(ntt_g, a);
+        ntt761_shared(aG, G, ntt_g);
+    }
+    benchmark(t0, "ntt761_shared() L1D refills");
+
+    /*----------------------------------------*/
+    for (i = 0; i < NTESTS; i++)
+    {
+        t0[i] = counter_l1d_read();
+        ntt761_ws(aG_alt, G, a, ntt_ws);
+    }
+    benchmark(t0, "ntt761_ws() L1D refills");
+
+    /* NTRU LPRime only reads the first I integer coefficients of the products
+     * bA and aB, whose operands are already transformed. The full product is
+     * the part of ntt761() that ntt761_product_low() replaces */
+
+    int32_t ntt_f[GP0][GP1];
+    Fq aG_low[I];
+
+    ntt761_forward(ntt_f, G);
+    ntt761_forward_small(ntt_g, a);
+    ntt761_product_low(aG_low, ntt_f, ntt_g);
+    if (memcmp(aG, aG_low, sizeof(aG_low)))
+    {
+        return KAT_CRYPTO_FAILURE;
+    }
+
+    /*----------------------------------------*/
+    for (i = 0; i < NTESTS; i++)
+    {
+        t0[i] = counter_read();
+        ntt761_product(aG_alt, ntt_f, ntt_g);
+    }
+    benchmark(t0, "ntt761_product()");
+
+    /*----------------------------------------*/
+    for (i = 0; i < NTESTS; i++)
+    {
+        t0[i] = counter_read();
+        ntt761_product_low(aG_low, ntt_f, ntt_g);
+    }
+    benchmark(t0, "ntt761_product_low()");
+
+#if NTRU_P == 761
+    /*----------------------------------------*/
+    for (i = 0; i < NTESTS; i++)
+    {
+        t0[i] = counter_read();
+        ntt761_16(aG_alt, G, a);
+    }
+    benchmark(t0, "ntt761_16()");
+
+    /*----------------------------------------*/
+    for (i = 0; i < NTESTS; i++)
+    {
+        t0[i] = counter_read();
+        toom761(aG_alt, G, a);
+    }
+    benchmark(t0, "toom761()");
+
+    /*----------------------------------------*/
+    for (i = 0; i < NTESTS; i++)
+    {
+        t0[i] = counter_read();
+        kron761(aG_alt, G, a);
+    }
+    benchmark(t0, "kron761()");
+#endif
+
+    /*----------------------------------------*/
+    for (i = 0; i < NTESTS; i++)
+    {
+        t0[i] = counter_read();
+        ntt761_x4(aG_x4_out, G_x4, a_x4);
+    }
+    benchmark(t0, "ntt761_x4()");
+
+    /* The product of two small polynomials mod 3, i.e. R3_mult() of the
+     * Streamlined NTRU Prime decapsulation */
+
+    small a3[p];
+
+    /*----------------------------------------*/
+    for (i = 0; i < NTESTS; i++)
+    {
+        t0[i] = counter_read();
+        ntt761_r3(a3, a, a);
+    }
+    benchmark(t0, "ntt761_r3()");
+
+    /* The inversions of the Streamlined NTRU Prime KeyGen, i.e. R3_recip()
+     * and Rq_recip3(), which both compute 2p - 1 division steps */
+
+    Fq a_recip[p];
+
+    /*----------------------------------------*/
+    for (i = 0; i < NTESTS; i++)
+    {
+        t0[i] = counter_read();
+        recip761_r3(a3, a);
+    }
+    benchmark(t0, "recip761_r3()");
+
+    /*----------------------------------------*/
+    for (i = 0; i < NTESTS; i++)
+    {
+        t0[i] = counter_read();
+        recip761_rq3(a_recip, a);
+    }
+    benchmark(t0, "recip761_rq3()");
+
+    /* The transforms themselves, as generated by gen_ntt_asm.py, such that
+     * the layer merging strategies can be compared */
+
+    int32_t ntt_row[NTT_P];
+
+    for (i = 0; i < NTT_P; i++)
+    {
+        ntt_row[i] = G[i];
+    }
+
+    /*----------------------------------------*/
+    for (i = 0; i < NTESTS; i++)
+    {
+        t0[i] = counter_read();
+        __asm_ntt_forward(ntt_row, MR_top, MR_bot);
+    }
+    benchmark(t0, "__asm_ntt_forward()");
+
+    /*----------------------------------------*/
+    for (i = 0; i < NTESTS; i++)
+    {
+        t0[i] = counter_read();
+        __asm_ntt_forward_l2(ntt_row, MR_top, MR_bot);
+    }
+    benchmark(t0, "__asm_ntt_forward_l2()");
+
+    /*----------------------------------------*/
+    for (i = 0; i < NTESTS; i++)
+    {
+        t0[i] = counter_read();
+        __asm_ntt_inverse(ntt_row, MR_inv_top, MR_inv_bot);
+    }
+    benchmark(t0, "__asm_ntt_inverse()");
+
     /*----------------------------------------*/
     for (i = 0; i < NTESTS; i++)
     {
@@ -199,7 +474,7 @@ int main()
     unsigned char r_enc[Inputs_bytes];
     unsigned char cache[Hash_bytes];
 
-    Fq B[p];
+    Fq_ntt Bt;
     // Fq bG[p];
     // Fq bA[p];
     // small b[p];
@@ -211,6 +486,13 @@ int main()
         crypto_kem_enc(ct, ss, pk);
     }
     benchmark(t0, "crypto_kem_enc(ct, ss, pk)");
+
+    for (size_t j = 0; j < NTESTS; j++)
+    {
+        t0[j] = counter_read();
+        crypto_kem_enc_ctx(ct, ss, &ctx);
+    }
+    benchmark(t0, "crypto_kem_enc_ctx(ct, ss, &ctx)");
     printf("|------------------------------------------|--------------------|\n");
 
     /*----------------------------------------*/
@@ -248,7 +530,7 @@ int main()
     // // Hide
     // Inputs_encode(r_enc,r);
     //     // ZEncrypt
-    //     Rounded_decode(A,pk+Seeds_bytes);
+    //     Rounded_decode_ntt(A,pk+Seeds_bytes);
     //         // XEncrypt
     //         Generator(G,pk);
     //         HashShort(b,r);
@@ -281,6 +563,13 @@ int main()
         crypto_kem_dec(ss1, ct, sk);
     }
     benchmark(t0, "crypto_kem_dec(ss1, ct, sk)");
+
+    for (size_t j = 0; j < NTESTS; j++)
+    {
+        t0[j] = counter_read();
+        crypto_kem_dec_expanded(ss1, ct, &esk);
+    }
+    benchmark(t0, "crypto_kem_dec_expanded(ss1, ct, &esk)");
     printf("|------------------------------------------|--------------------|\n");
     for (i = 0; i < NTESTS; i++)
     {
@@ -291,9 +580,9 @@ int main()
     for (i = 0; i < NTESTS; i++)
     {
         t0[i] = counter_read();
-        Rounded_decode(B,ct);
+        Rounded_decode_ntt(Bt,ct);
     }
-    benchmark(t0, "Rounded_decode()");
+    benchmark(t0, "Rounded_decode_ntt()");
     for (i = 0; i < NTESTS; i++)
     {
         t0[i] = counter_read();
@@ -304,7 +593,7 @@ int main()
     for (i = 0; i < NTESTS; i++)
     {
         t0[i] = counter_read();
-        Decrypt(r, B, T, a);
+        Decrypt(r, Bt, T, a);
     }
     benchmark(t0, "Decrypt()");
 
@@ -343,9 +632,9 @@ int main()
     for (i = 0; i < NTESTS; i++)
     {
         t0[i] = counter_read();
-        Rounded_decode(B,ct);
+        Rounded_decode_ntt(Bt,ct);
     }
-    benchmark(t0, "Rounded_decode()");
+    benchmark(t0, "Rounded_decode_ntt()");
     /*----------------------------------------*/
     for (i = 0; i < NTESTS; i++)
     {
@@ -400,12 +689,20 @@ int main()
 
 
     /*----------------------------------------*/
+    small_ntt bt;
     for (i = 0; i < NTESTS; i++)
     {
         t0[i] = counter_read();
-        Rq_mult_small(aG, G, a);
+        Rq_small_ntt(bt, b);
     }
-    benchmark(t0, "Rq_mult_small()");
+    benchmark(t0, "Rq_small_ntt()");
+    /*----------------------------------------*/
+    for (i = 0; i < NTESTS; i++)
+    {
+        t0[i] = counter_read();
+        Rq_mult_small_ntt(aG, G, bt);
+    }
+    benchmark(t0, "Rq_mult_small_ntt()");
     /*----------------------------------------*/
     for (i = 0; i < NTESTS; i++)
     {
@@ -417,9 +714,9 @@ int main()
     for (i = 0; i < NTESTS; i++)
     {
         t0[i] = counter_read();
-        Rq_mult_small(aG, G, a);
+        Rq_mult_small_ntt(aG, A, bt);
     }
-    benchmark(t0, "Rq_mult_small()");
+    benchmark(t0, "Rq_mult_small_ntt()");
     /*----------------------------------------*/
     for (i = 0; i < NTESTS; i++)
     {
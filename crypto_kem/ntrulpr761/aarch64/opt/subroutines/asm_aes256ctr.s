@@ -0,0 +1,170 @@
+/* Switch to the text segment - this contains the program code */
+
+.text
+
+/* Enable the AES instructions, which are only executed on CPUs that implement
+ * the Crypto Extensions, see crypto_stream_aes256ctr.c */
+
+.arch armv8-a+crypto
+
+/* Provide function declarations */
+
+.global __asm_aes256ctr32
+.type __asm_aes256ctr32, %function
+
+/* Provide macro definitions */
+
+/* Set the block b to the counter block v31 with its lowest 32 bits replaced by
+ * lo32 + j, which are stored in big endian byte order. */
+
+.macro counter b, j
+    add     tmp, lo32, #(\j)
+    rev     tmp, tmp
+    mov     \b\().16b, v31.16b
+    mov     \b\().s[3], tmp
+.endm
+
+/* One AES round of the 4 blocks v0 - v3 with the round key k: AESE computes
+ * AddRoundKey, SubBytes and ShiftRows, AESMC computes MixColumns. The blocks
+ * are independent, such that the rounds of different blocks overlap. */
+
+.macro round4 k
+    aese    v0.16b, \k\().16b
+    aesmc   v0.16b, v0.16b
+    aese    v1.16b, \k\().16b
+    aesmc   v1.16b, v1.16b
+    aese    v2.16b, \k\().16b
+    aesmc   v2.16b, v2.16b
+    aese    v3.16b, \k\().16b
+    aesmc   v3.16b, v3.16b
+.endm
+
+.macro round1 k
+    aese    v0.16b, \k\().16b
+    aesmc   v0.16b, v0.16b
+.endm
+
+/* Encrypt the 4 blocks v0 - v3 with the 15 round keys in v16 - v30. The last
+ * round has no MixColumns and is followed by the final AddRoundKey. */
+
+.macro encrypt4
+    round4  v16
+    round4  v17
+    round4  v18
+    round4  v19
+    round4  v20
+    round4  v21
+    round4  v22
+    round4  v23
+    round4  v24
+    round4  v25
+    round4  v26
+    round4  v27
+    round4  v28
+
+    aese    v0.16b, v29.16b
+    aese    v1.16b, v29.16b
+    aese    v2.16b, v29.16b
+    aese    v3.16b, v29.16b
+    eor     v0.16b, v0.16b, v30.16b
+    eor     v1.16b, v1.16b, v30.16b
+    eor     v2.16b, v2.16b, v30.16b
+    eor     v3.16b, v3.16b, v30.16b
+.endm
+
+.macro encrypt1
+    round1  v16
+    round1  v17
+    round1  v18
+    round1  v19
+    round1  v20
+    round1  v21
+    round1  v22
+    round1  v23
+    round1  v24
+    round1  v25
+    round1  v26
+    round1  v27
+    round1  v28
+
+    aese    v0.16b, v29.16b
+    eor     v0.16b, v0.16b, v30.16b
+.endm
+
+__asm_aes256ctr32:
+
+    /* Due to our choice of registers we do not need (to store) callee-saved
+     * registers. Neither do we use the procedure link register, as we do not
+     * branch to any functions from within this subroutine. The function
+     * prologue is therefore empty. */
+
+    /* Alias registers for a specific purpose (and readability) */
+
+    out     .req x0     // Store pointer to the next keystream block
+    rk      .req x1     // Store pointer to the 15 round keys
+    ctr     .req x2     // Store pointer to the counter block
+    count   .req x3     // Store the number of remaining blocks
+    lo32    .req w4     // Store the lowest 32 bits of the counter
+    tmp     .req w5     // Store the lowest 32 bits of the current block
+
+    /* Load the round keys and the counter block */
+
+    ld1     {v16.16b, v17.16b, v18.16b, v19.16b}, [rk], #64
+    ld1     {v20.16b, v21.16b, v22.16b, v23.16b}, [rk], #64
+    ld1     {v24.16b, v25.16b, v26.16b, v27.16b}, [rk], #64
+    ld1     {v28.16b, v29.16b, v30.16b}, [rk]
+
+    ld1     {v31.16b}, [ctr]
+    ldr     lo32, [ctr, #12]
+    rev     lo32, lo32
+
+    cmp     count, #4
+    b.lo    .Laes256ctr32_tail
+
+    /* Encrypt 4 counter blocks at a time */
+
+.Laes256ctr32_x4:
+    counter v0, 0
+    counter v1, 1
+    counter v2, 2
+    counter v3, 3
+    add     lo32, lo32, #4
+
+    encrypt4
+    st1     {v0.16b, v1.16b, v2.16b, v3.16b}, [out], #64
+
+    sub     count, count, #4
+    cmp     count, #4
+    b.hs    .Laes256ctr32_x4
+
+    /* Encrypt the remaining 0 - 3 counter blocks one by one */
+
+.Laes256ctr32_tail:
+    cbz     count, .Laes256ctr32_done
+
+.Laes256ctr32_x1:
+    counter v0, 0
+    add     lo32, lo32, #1
+
+    encrypt1
+    st1     {v0.16b}, [out], #16
+
+    subs    count, count, #1
+    b.ne    .Laes256ctr32_x1
+
+.Laes256ctr32_done:
+
+    /* Store the counter of the next block, the caller handles the carry into
+     * the upper 96 bits */
+
+    rev     lo32, lo32
+    str     lo32, [ctr, #12]
+
+    .unreq  out
+    .unreq  rk
+    .unreq  ctr
+    .unreq  count
+    .unreq  lo32
+    .unreq  tmp
+
+    ret     lr
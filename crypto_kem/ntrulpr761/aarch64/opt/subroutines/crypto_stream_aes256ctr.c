@@ -1,29 +1,312 @@
+#include <stdint.h>
 #include <string.h>
-#include <openssl/evp.h>
+#ifdef __linux__
+#include <sys/auxv.h>
+#endif
 #include "crypto_stream_aes256ctr.h"
 
-static int aes256ctr_xor(
-  unsigned char *out,
-  const unsigned char *in,
-  unsigned long long inlen,
-  const unsigned char *n,
-  const unsigned char *k
-)
+/*
+AES-256 in counter mode with a 128-bit big-endian counter, i.e. the same
+keystream as EVP_aes_256_ctr(), written straight to the output.
+
+With the ARMv8 Crypto Extensions the blocks are encrypted by
+__asm_aes256ctr32() using AESE and AESMC. Otherwise a constant time
+bitsliced implementation encrypts 4 blocks at a time, using the ct64
+layout of BearSSL: every block is split into two halves of 8 bytes, and
+the 8 words of the state hold bit j of all 8 x 8 bytes in word j.
+
+The key schedule is shared by both and uses the bitsliced S-box as well,
+so neither path has secret dependent table lookups or branches.
+*/
+
+extern void __asm_aes256ctr32(unsigned char *out,const uint32_t *rk,unsigned char *ctr,uint64_t blocks);
+
+static uint32_t load32_le(const unsigned char *x)
+{
+  return x[0] | ((uint32_t)x[1] << 8) | ((uint32_t)x[2] << 16) | ((uint32_t)x[3] << 24);
+}
+
+static void store32_le(unsigned char *x,uint32_t u)
+{
+  x[0] = u; x[1] = u >> 8; x[2] = u >> 16; x[3] = u >> 24;
+}
+
+/* ----- bitsliced AES */
+
+#define SWAPN(cl,ch,s,x,y) \
+  do { \
+    uint64_t a = (x), b = (y); \
+    (x) = (a & (cl)) | ((b & (cl)) << (s)); \
+    (y) = ((a & (ch)) >> (s)) | (b & (ch)); \
+  } while (0)
+
+#define SWAP2(x,y) SWAPN(0x5555555555555555ULL,0xAAAAAAAAAAAAAAAAULL,1,x,y)
+#define SWAP4(x,y) SWAPN(0x3333333333333333ULL,0xCCCCCCCCCCCCCCCCULL,2,x,y)
+#define SWAP8(x,y) SWAPN(0x0F0F0F0F0F0F0F0FULL,0xF0F0F0F0F0F0F0F0ULL,4,x,y)
+
+/* transpose the 8 x 8 bit matrices between bytes and bit planes; an involution */
+static void aes_ortho(uint64_t *q)
+{
+  SWAP2(q[0],q[1]); SWAP2(q[2],q[3]); SWAP2(q[4],q[5]); SWAP2(q[6],q[7]);
+  SWAP4(q[0],q[2]); SWAP4(q[1],q[3]); SWAP4(q[4],q[6]); SWAP4(q[5],q[7]);
+  SWAP8(q[0],q[4]); SWAP8(q[1],q[5]); SWAP8(q[2],q[6]); SWAP8(q[3],q[7]);
+}
+
+/* spread the 4 words of a block into the even (q0) and odd (q1) columns */
+static void aes_interleave_in(uint64_t *q0,uint64_t *q1,const uint32_t *w)
+{
+  uint64_t x0 = w[0], x1 = w[1], x2 = w[2], x3 = w[3];
+
+  x0 |= x0 << 16; x1 |= x1 << 16; x2 |= x2 << 16; x3 |= x3 << 16;
+  x0 &= 0x0000FFFF0000FFFFULL; x1 &= 0x0000FFFF0000FFFFULL;
+  x2 &= 0x0000FFFF0000FFFFULL; x3 &= 0x0000FFFF0000FFFFULL;
+  x0 |= x0 << 8; x1 |= x1 << 8; x2 |= x2 << 8; x3 |= x3 << 8;
+  x0 &= 0x00FF00FF00FF00FFULL; x1 &= 0x00FF00FF00FF00FFULL;
+  x2 &= 0x00FF00FF00FF00FFULL; x3 &= 0x00FF00FF00FF00FFULL;
+  *q0 = x0 | (x2 << 8);
+  *q1 = x1 | (x3 << 8);
+}
+
+static void aes_interleave_out(uint32_t *w,uint64_t q0,uint64_t q1)
+{
+  uint64_t x0 = q0 & 0x00FF00FF00FF00FFULL;
+  uint64_t x1 = q1 & 0x00FF00FF00FF00FFULL;
+  uint64_t x2 = (q0 >> 8) & 0x00FF00FF00FF00FFULL;
+  uint64_t x3 = (q1 >> 8) & 0x00FF00FF00FF00FFULL;
+
+  x0 |= x0 >> 8; x1 |= x1 >> 8; x2 |= x2 >> 8; x3 |= x3 >> 8;
+  x0 &= 0x0000FFFF0000FFFFULL; x1 &= 0x0000FFFF0000FFFFULL;
+  x2 &= 0x0000FFFF0000FFFFULL; x3 &= 0x0000FFFF0000FFFFULL;
+  w[0] = (uint32_t)x0 | (uint32_t)(x0 >> 16);
+  w[1] = (uint32_t)x1 | (uint32_t)(x1 >> 16);
+  w[2] = (uint32_t)x2 | (uint32_t)(x2 >> 16);
+  w[3] = (uint32_t)x3 | (uint32_t)(x3 >> 16);
+}
+
+/* SubBytes of all 64 bytes, the circuit of Boyar and Peralta (113 gates) */
+static void aes_sbox(uint64_t *q)
+{
+  uint64_t x0,x1,x2,x3,x4,x5,x6,x7;
+  uint64_t y1,y2,y3,y4,y5,y6,y7,y8,y9,y10,y11,y12,y13,y14,y15,y16,y17,y18,y19,y20,y21;
+  uint64_t z0,z1,z2,z3,z4,z5,z6,z7,z8,z9,z10,z11,z12,z13,z14,z15,z16,z17;
+  uint64_t t0,t1,t2,t3,t4,t5,t6,t7,t8,t9,t10,t11,t12,t13,t14,t15,t16,t17,t18,t19;
+  uint64_t t20,t21,t22,t23,t24,t25,t26,t27,t28,t29,t30,t31,t32,t33,t34,t35,t36,t37,t38,t39;
+  uint64_t t40,t41,t42,t43,t44,t45,t46,t47,t48,t49,t50,t51,t52,t53,t54,t55,t56,t57,t58,t59;
+  uint64_t t60,t61,t62,t63,t64,t65,t66,t67;
+  uint64_t s0,s1,s2,s3,s4,s5,s6,s7;
+
+  x0 = q[7]; x1 = q[6]; x2 = q[5]; x3 = q[4];
+  x4 = q[3]; x5 = q[2]; x6 = q[1]; x7 = q[0];
+
+  /* top linear transformation */
+  y14 = x3 ^ x5; y13 = x0 ^ x6; y9 = x0 ^ x3; y8 = x0 ^ x5;
+  t0 = x1 ^ x2; y1 = t0 ^ x7; y4 = y1 ^ x3; y12 = y13 ^ y14;
+  y2 = y1 ^ x0; y5 = y1 ^ x6; y3 = y5 ^ y8; t1 = x4 ^ y12;
+  y15 = t1 ^ x5; y20 = t1 ^ x1; y6 = y15 ^ x7; y10 = y15 ^ t0;
+  y11 = y20 ^ y9; y7 = x7 ^ y11; y17 = y10 ^ y11; y19 = y10 ^ y8;
+  y16 = t0 ^ y11; y21 = y13 ^ y16; y18 = x0 ^ y16;
+
+  /* non-linear section */
+  t2 = y12 & y15; t3 = y3 & y6; t4 = t3 ^ t2; t5 = y4 & x7;
+  t6 = t5 ^ t2; t7 = y13 & y16; t8 = y5 & y1; t9 = t8 ^ t7;
+  t10 = y2 & y7; t11 = t10 ^ t7; t12 = y9 & y11; t13 = y14 & y17;
+  t14 = t13 ^ t12; t15 = y8 & y10; t16 = t15 ^ t12; t17 = t4 ^ t14;
+  t18 = t6 ^ t16; t19 = t9 ^ t14; t20 = t11 ^ t16; t21 = t17 ^ y20;
+  t22 = t18 ^ y19; t23 = t19 ^ y21; t24 = t20 ^ y18;
+
+  t25 = t21 ^ t22; t26 = t21 & t23; t27 = t24 ^ t26; t28 = t25 & t27;
+  t29 = t28 ^ t22; t30 = t23 ^ t24; t31 = t22 ^ t26; t32 = t31 & t30;
+  t33 = t32 ^ t24; t34 = t23 ^ t33; t35 = t27 ^ t33; t36 = t24 & t35;
+  t37 = t36 ^ t34; t38 = t27 ^ t36; t39 = t29 & t38; t40 = t25 ^ t39;
+
+  t41 = t40 ^ t37; t42 = t29 ^ t33; t43 = t29 ^ t40; t44 = t33 ^ t37;
+  t45 = t42 ^ t41;
+  z0 = t44 & y15; z1 = t37 & y6; z2 = t33 & x7; z3 = t43 & y16;
+  z4 = t40 & y1; z5 = t29 & y7; z6 = t42 & y11; z7 = t45 & y17;
+  z8 = t41 & y10; z9 = t44 & y12; z10 = t37 & y3; z11 = t33 & y4;
+  z12 = t43 & y13; z13 = t40 & y5; z14 = t29 & y2; z15 = t42 & y9;
+  z16 = t45 & y14; z17 = t41 & y8;
+
+  /* bottom linear transformation */
+  t46 = z15 ^ z16; t47 = z10 ^ z11; t48 = z5 ^ z13; t49 = z9 ^ z10;
+  t50 = z2 ^ z12; t51 = z2 ^ z5; t52 = z7 ^ z8; t53 = z0 ^ z3;
+  t54 = z6 ^ z7; t55 = z16 ^ z17; t56 = z12 ^ t48; t57 = t50 ^ t53;
+  t58 = z4 ^ t46; t59 = z3 ^ t54; t60 = t46 ^ t57; t61 = z14 ^ t57;
+  t62 = t52 ^ t58; t63 = t49 ^ t58; t64 = z4 ^ t59; t65 = t61 ^ t62;
+  t66 = z1 ^ t63; s0 = t59 ^ t63; s6 = t56 ^ ~t62; s7 = t48 ^ ~t60;
+  t67 = t64 ^ t65; s3 = t53 ^ t66; s4 = t51 ^ t66; s5 = t47 ^ t65;
+  s1 = t64 ^ ~s3; s2 = t55 ^ ~t67;
+
+  q[7] = s0; q[6] = s1; q[5] = s2; q[4] = s3;
+  q[3] = s4; q[2] = s5; q[1] = s6; q[0] = s7;
+}
+
+static void aes_shift_rows(uint64_t *q)
+{
+  int i;
+
+  for (i = 0;i < 8;++i) {
+    uint64_t x = q[i];
+    q[i] = (x & 0x000000000000FFFFULL)
+      | ((x & 0x00000000FFF00000ULL) >> 4)
+      | ((x & 0x00000000000F0000ULL) << 12)
+      | ((x & 0x0000FF0000000000ULL) >> 8)
+      | ((x & 0x000000FF00000000ULL) << 8)
+      | ((x & 0xF000000000000000ULL) >> 12)
+      | ((x & 0x0FFF000000000000ULL) << 4);
+  }
+}
+
+static uint64_t rotr32(uint64_t x)
+{
+  return (x << 32) | (x >> 32);
+}
+
+static void aes_mix_columns(uint64_t *q)
+{
+  uint64_t q0 = q[0], q1 = q[1], q2 = q[2], q3 = q[3];
+  uint64_t q4 = q[4], q5 = q[5], q6 = q[6], q7 = q[7];
+  uint64_t r0 = (q0 >> 16) | (q0 << 48), r1 = (q1 >> 16) | (q1 << 48);
+  uint64_t r2 = (q2 >> 16) | (q2 << 48), r3 = (q3 >> 16) | (q3 << 48);
+  uint64_t r4 = (q4 >> 16) | (q4 << 48), r5 = (q5 >> 16) | (q5 << 48);
+  uint64_t r6 = (q6 >> 16) | (q6 << 48), r7 = (q7 >> 16) | (q7 << 48);
+
+  q[0] = q7 ^ r7 ^ r0 ^ rotr32(q0 ^ r0);
+  q[1] = q0 ^ r0 ^ q7 ^ r7 ^ r1 ^ rotr32(q1 ^ r1);
+  q[2] = q1 ^ r1 ^ r2 ^ rotr32(q2 ^ r2);
+  q[3] = q2 ^ r2 ^ q7 ^ r7 ^ r3 ^ rotr32(q3 ^ r3);
+  q[4] = q3 ^ r3 ^ q7 ^ r7 ^ r4 ^ rotr32(q4 ^ r4);
+  q[5] = q4 ^ r4 ^ r5 ^ rotr32(q5 ^ r5);
+  q[6] = q5 ^ r5 ^ r6 ^ rotr32(q6 ^ r6);
+  q[7] = q6 ^ r6 ^ r7 ^ rotr32(q7 ^ r7);
+}
+
+static void aes_add_round_key(uint64_t *q,const uint64_t *sk)
+{
+  int i;
+
+  for (i = 0;i < 8;++i) q[i] ^= sk[i];
+}
+
+/* ----- key schedule */
+
+static uint32_t aes_sub_word(uint32_t x)
 {
-  EVP_CIPHER_CTX *x;
-  int ok;
-  int outl = 0;
+  uint64_t q[8] = {x};
 
-  x = EVP_CIPHER_CTX_new();
-  if (!x) return -111;
+  aes_ortho(q);
+  aes_sbox(q);
+  aes_ortho(q);
+  return (uint32_t)q[0];
+}
+
+/* rk = the 60 words of the AES-256 round keys, in little-endian byte order */
+static void aes256_keysched(uint32_t *rk,const unsigned char *k)
+{
+  uint32_t rcon = 1;
+  uint32_t t;
+  int i;
 
-  ok = EVP_EncryptInit_ex(x,EVP_aes_256_ctr(),0,k,n);
-  if (ok == 1) ok = EVP_CIPHER_CTX_set_padding(x, 0);
-  if (ok == 1) ok = EVP_EncryptUpdate(x, out, &outl, in, inlen);
-  if (ok == 1) ok = EVP_EncryptFinal_ex(x, out, &outl);
+  for (i = 0;i < 8;++i) rk[i] = load32_le(k + 4 * i);
 
-  EVP_CIPHER_CTX_free(x);
-  return ok == 1 ? 0 : -111;
+  for (i = 8;i < 60;++i) {
+    t = rk[i - 1];
+    if (i % 8 == 0) {
+      t = aes_sub_word((t << 24) | (t >> 8)) ^ rcon;
+      rcon <<= 1;
+    } else if (i % 8 == 4)
+      t = aes_sub_word(t);
+    rk[i] = rk[i - 8] ^ t;
+  }
+}
+
+/* sk = the round keys rk, bitsliced as 4 copies of the same block */
+static void aes256_bitslice_keys(uint64_t *sk,const uint32_t *rk)
+{
+  uint64_t q[8];
+  int r,i;
+
+  for (r = 0;r < 15;++r) {
+    aes_interleave_in(&q[0],&q[4],rk + 4 * r);
+    q[1] = q[2] = q[3] = q[0];
+    q[5] = q[6] = q[7] = q[4];
+    aes_ortho(q);
+    for (i = 0;i < 8;++i) sk[8 * r + i] = q[i];
+  }
+}
+
+/* ----- counter mode */
+
+static void ctr_increment(unsigned char *ctr)
+{
+  uint32_t c = 1;
+  int i;
+
+  for (i = 15;i >= 0;--i) {
+    c += ctr[i];
+    ctr[i] = c;
+    c >>= 8;
+  }
+}
+
+/* out = the next 4 keystream blocks, using the bitsliced AES */
+static void aes256ctr_x4(unsigned char *out,unsigned char *ctr,const uint64_t *sk)
+{
+  uint32_t w[16];
+  uint64_t q[8];
+  int i,r;
+
+  for (i = 0;i < 4;++i) {
+    for (r = 0;r < 4;++r) w[4 * i + r] = load32_le(ctr + 4 * r);
+    ctr_increment(ctr);
+  }
+
+  for (i = 0;i < 4;++i) aes_interleave_in(&q[i],&q[i + 4],w + 4 * i);
+  aes_ortho(q);
+
+  aes_add_round_key(q,sk);
+  for (r = 1;r < 14;++r) {
+    aes_sbox(q);
+    aes_shift_rows(q);
+    aes_mix_columns(q);
+    aes_add_round_key(q,sk + 8 * r);
+  }
+  aes_sbox(q);
+  aes_shift_rows(q);
+  aes_add_round_key(q,sk + 8 * 14);
+
+  aes_ortho(q);
+  for (i = 0;i < 4;++i) aes_interleave_out(w + 4 * i,q[i],q[i + 4]);
+  for (i = 0;i < 16;++i) store32_le(out + 4 * i,w[i]);
+}
+
+/* out = the next blocks of the keystream, using the Crypto Extensions */
+/* __asm_aes256ctr32() only increments the lowest 32 bits of the counter */
+static void aes256ctr_ce(unsigned char *out,unsigned long long blocks,unsigned char *ctr,const uint32_t *rk)
+{
+  while (blocks > 0) {
+    uint64_t lo = ((uint64_t)ctr[12] << 24) | ((uint64_t)ctr[13] << 16) | ((uint64_t)ctr[14] << 8) | ctr[15];
+    uint64_t n = (1ULL << 32) - lo;
+    int i;
+
+    if (n > blocks) n = blocks;
+    __asm_aes256ctr32(out,rk,ctr,n);
+    out += 16 * n;
+    blocks -= n;
+
+    if (lo + n == (1ULL << 32))
+      for (i = 11;i >= 0;--i)
+        if (++ctr[i]) break;
+  }
+}
+
+static int aes256ctr_has_ce(void)
+{
+#if defined(AT_HWCAP) && defined(HWCAP_AES)
+  return (getauxval(AT_HWCAP) & HWCAP_AES) != 0;
+#else
+  return 0;
+#endif
 }
 
 int crypto_stream_aes256ctr(
@@ -33,7 +316,34 @@ int crypto_stream_aes256ctr(
   const unsigned char *k
 )
 {
-  unsigned char temp[outlen];
-  memset(temp, 0, outlen);
-  return aes256ctr_xor(out, temp, outlen, n, k);
+  uint32_t rk[60];
+  unsigned char ctr[16];
+  unsigned char tmp[64];
+
+  aes256_keysched(rk,k);
+  memcpy(ctr,n,16);
+
+  if (aes256ctr_has_ce()) {
+    unsigned long long blocks = outlen / 16;
+
+    aes256ctr_ce(out,blocks,ctr,rk);
+    out += 16 * blocks;
+    outlen -= 16 * blocks;
+    if (outlen > 0) {
+      aes256ctr_ce(tmp,1,ctr,rk);
+      memcpy(out,tmp,outlen);
+    }
+  } else {
+    uint64_t sk[8 * 15];
+
+    aes256_bitslice_keys(sk,rk);
+    for (;outlen >= 64;outlen -= 64,out += 64)
+      aes256ctr_x4(out,ctr,sk);
+    if (outlen > 0) {
+      aes256ctr_x4(tmp,ctr,sk);
+      memcpy(out,tmp,outlen);
+    }
+  }
+
+  return 0;
 }
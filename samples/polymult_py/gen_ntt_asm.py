@@ -0,0 +1,1161 @@
+#!/usr/bin/env python3
+
+import argparse
+import json
+import random
+import re
+import sys
+from typing import Dict, List, NoReturn, Optional, Tuple
+
+from lib_common import NTT
+
+"""
+This file generates the unrolled AArch64 (NEON) assembly of the size-512 cyclic
+NTT used by crypto_kem/ntrulpr761/aarch64/opt, i.e. the functions
+__asm_ntt_forward(), __asm_ntt_forward_l2() and __asm_ntt_inverse() in
+ntt/asm_ntt_<target>.s. The target forward_l2 is the forward NTT without its
+first layer, which is merged into the Good's permutation. The generated code is
+controlled by a strategy (spec) per target, which is a dictionary with the
+following keys:
+
+* groups:   The layer merging, e.g. [4, 3, 2]. The 9 layers (8 for forward_l2)
+            are split into consecutive groups and every group is computed in a
+            single pass over the 512 integer coefficients. The forward NTT
+            starts at layer 1 (2), the inverse NTT at layer 9. Groups without
+            layers 8 and 9 operate on whole vectors and hold at most 4 layers.
+            Layers 8 and 9 need to shuffle integer coefficients between lanes
+            and therefore have to be part of the same group, which holds 2, 3
+            or 4 layers.
+* twiddles: The twiddle layout. 'block' loads the roots of all merged layers
+            once per block and keeps them in registers, 'layer' (re)loads the
+            roots of a layer right before it is computed, trading extra loads
+            for free registers.
+* batch:    The number of butterflies whose instructions are interleaved to
+            hide their latencies. It is lowered if there are not enough free
+            registers.
+* data:     The first vector register of the consecutive block of registers
+            holding the integer coefficients. The roots, temporaries and M are
+            allocated from the remaining registers, callee-saved registers
+            (v8 - v15) last. These are saved and restored only if they are
+            used.
+
+Every generated function is executed by a small simulator of the emitted
+instructions and compared with the NTT class of lib_common.py, using the
+precomputed (Montgomery) roots defined in ntt/mult.c. The script refuses to
+write a file that fails this check.
+
+The inverse NTT also scales its result: the base multiplication leaves a factor
+2^-32 in every integer coefficient, which is compensated for together with the
+factor 512^-1 in the last layer, whose root is 1. Its outputs are reduced to
+[0, M) before they are stored, such that __asm_ntt_inverse() is a single pass
+from the base multiplication to __asm_reduce_terms_761().
+
+Run it from this directory, e.g.
+
+    python3 gen_ntt_asm.py --groups-forward 4 3 2 --groups-inverse 2 3 4
+
+and use gen_ntt_sweep.py to benchmark a range of strategies on a device.
+"""
+
+# Define the NTT parameters, these match ntt/ntt_params.h
+VAR_Q, VAR_N, VAR_LAYERS = 6984193, 512, 9
+
+# Define the path of the optimized implementation, relative to this directory
+OPT_DIR = "../../crypto_kem/ntrulpr761/aarch64/opt"
+
+DEFAULT_SPEC = {
+    "forward": {"groups": [4, 3, 2], "twiddles": "block", "batch": 4,
+                "data": 0},
+    "forward_l2": {"groups": [4, 4], "twiddles": "block", "batch": 4,
+                   "data": 0},
+    "inverse": {"groups": [2, 3, 4], "twiddles": "block", "batch": 4,
+                "data": 0},
+}
+
+# Define the names of the functions and their first layer per target, and the
+# root tables per direction
+FUNCTIONS = {"forward": "__asm_ntt_forward",
+             "forward_l2": "__asm_ntt_forward_l2",
+             "inverse": "__asm_ntt_inverse"}
+FIRST = {"forward": 1, "forward_l2": 2, "inverse": 1}
+TABLES = {"forward": ("MR_top", "MR_bot"),
+          "inverse": ("MR_inv_top", "MR_inv_bot")}
+
+# Define type aliases for the roots (B, B') and a butterfly (a, b, root)
+Root = Tuple[str, str]
+Butterfly = Tuple[int, int, Optional[Root]]
+
+
+def load_tables(path: str) -> Dict[str, List[int]]:
+    """
+    Parse the precomputed roots from a C source file
+    :param path: The path of the source file, i.e. ntt/mult.c
+    :return: Dictionary mapping the names of the tables to their values
+    """
+    with open(path) as file:
+        text = file.read()
+
+    tables = {}
+    for name, body in re.findall(r"(?:const )?int32_t (\w+)\[[^]]*\] = "
+                                 r"\{([^}]*)\};", text):
+        tables[name] = [int(_) for _ in body.split(",")]
+
+    return tables
+
+
+def direction_of(target: str) -> str:
+    """ The direction of a target, i.e. either 'forward' or 'inverse' """
+    return target.split("_")[0]
+
+
+def check_spec(target: str, spec: dict) -> NoReturn:
+    """
+    Verify whether a strategy can be generated, raise a ValueError otherwise
+    :param target: Either 'forward', 'forward_l2' or 'inverse'
+    :param spec: The strategy
+    """
+    groups = spec["groups"]
+    layers = VAR_LAYERS - FIRST[target] + 1
+    if sum(groups) != layers or min(groups) < 1:
+        raise ValueError(f"{target}: groups must split {layers} layers")
+
+    tail = groups[0] if target == "inverse" else groups[-1]
+    for size in groups:
+        if size > 4:
+            raise ValueError(f"{target}: groups hold at most 4 layers")
+    if tail < 2:
+        raise ValueError(f"{target}: layers 8 and 9 must share a group")
+    if spec["twiddles"] not in ("block", "layer"):
+        raise ValueError(f"{target}: twiddles is either block or layer")
+    if spec["batch"] < 1:
+        raise ValueError(f"{target}: batch must be at least 1")
+    if spec["data"] < 0 or spec["data"] + 16 > 32:
+        raise ValueError(f"{target}: data must be in v0 - v16")
+
+
+class Emitter:
+    """
+    The class Emitter collects the lines of an assembly file and keeps track
+    of the vector registers. Free registers are handed out in order, preferring
+    the registers that do not need to be saved by the callee
+    """
+
+    def __init__(self, reserved: List[int]) -> NoReturn:
+        """ Class constructor used to initialize an instance of the class """
+        self.lines = []
+        order = list(range(16, 32)) + list(range(0, 8)) + list(range(8, 16))
+        self.free = [_ for _ in order if _ not in reserved]
+
+    def op(self, mnemonic: str, *operands: str) -> NoReturn:
+        """ Append a single instruction """
+        self.lines.append(f"    {mnemonic:<8}{', '.join(operands)}")
+
+    def comment(self, *text: str) -> NoReturn:
+        """ Append a (multi line) block comment """
+        if len(text) == 1:
+            self.lines.append(f"    /* {text[0]} */")
+        else:
+            self.lines.append(f"    /* {text[0]}")
+            self.lines += [f"     * {_}" for _ in text[1:-1]]
+            self.lines.append(f"     * {text[-1]} */")
+
+    def raw(self, line: str = "") -> NoReturn:
+        """ Append a line as is, an empty line by default """
+        self.lines.append(line)
+
+    def take(self, count: int) -> List[int]:
+        """ Take a number of free vector registers """
+        if count > len(self.free):
+            raise ValueError("not enough free vector registers")
+        regs, self.free = self.free[:count], self.free[count:]
+        return regs
+
+    def take_run(self, count: int) -> List[int]:
+        """ Take a number of free vector registers with consecutive numbers """
+        for first in self.free:
+            regs = list(range(first, first + count))
+            if all(_ in self.free for _ in regs):
+                self.free = [_ for _ in self.free if _ not in regs]
+                return regs
+        raise ValueError("not enough consecutive free vector registers")
+
+    def give(self, regs: List[int]) -> NoReturn:
+        """ Return vector registers that are no longer used """
+        self.free = sorted(self.free + regs, key=lambda _: (_ < 16, 8 <= _, _))
+
+
+class Generator:
+    """
+    The class Generator emits the assembly of a single NTT target. The 512
+    integer coefficients are 128 vectors of 4 lanes. A group of m layers
+    starting at layer t splits the coefficients into independent
+    sub-transforms of 2^m points, which are computed in registers.
+    """
+
+    def __init__(self, target: str, spec: dict,
+                 tables: Dict[str, List[int]]) -> NoReturn:
+        """ Class constructor used to initialize an instance of the class """
+        check_spec(target, spec)
+        self.target, self.spec = target, spec
+        self.direction, self.first = direction_of(target), FIRST[target]
+        self.top, self.bot = (tables[_] for _ in TABLES[self.direction])
+        self.unit = (self.top[0], self.bot[0])
+
+        # The coefficients use a fixed block of registers, which needs to be
+        # consecutive for the ld1, ld4 and st4 instructions of the last group
+        self.data = list(range(spec["data"], spec["data"] + 16))
+        self.e = Emitter(self.data)
+        self.m_reg = self.e.take(1)[0]
+        self.m_op = f"v{self.m_reg}.4s[0]"
+
+        # The inverse NTT holds the scaling factor (B, B') and 2M in the lanes
+        # 0, 1 and 2 of another register
+        if self.direction == "inverse":
+            self.s_reg = self.e.take(1)[0]
+
+    def ridx(self, layer: int, pos: int) -> int:
+        """ Index of the root of block pos in a layer """
+        if self.direction == "forward":
+            return (1 << (layer - 1)) - 1 + pos
+        return VAR_N - (1 << layer) + pos
+
+    def layers(self) -> List[Tuple[int, int]]:
+        """ The groups as (first layer t, number of layers m) in order """
+        groups, t, res = self.spec["groups"], self.first, []
+        if self.direction == "inverse":
+            groups = groups[::-1]
+        for m in groups:
+            res.append((t, m))
+            t += m
+        return res if self.direction == "forward" else res[::-1]
+
+    # -- Loading roots ------------------------------------------------------
+
+    def load_vec(self, reg: int, table: str, idx: int, width: int,
+                 ptr: str) -> NoReturn:
+        """ Load width consecutive roots starting at idx into a register """
+        size = {1: "s", 2: "d", 4: "q"}[width]
+        offset = 4 * idx
+        if offset % (4 * width) == 0:
+            self.e.op("ldr", f"{size}{reg}", f"[{table}, #4 * {idx}]")
+        else:
+            self.e.op("add", ptr, table, f"#4 * {idx}")
+            self.e.op("ldr", f"{size}{reg}", f"[{ptr}]")
+
+    def load_roots(self, need: List[Tuple[int, int]],
+                   roots: Dict[int, Root], regs: List[int]) -> NoReturn:
+        """
+        Load the roots of the blocks (layer, pos) that are not yet available in
+        a register. All roots of a layer are loaded at once, but a layer is
+        skipped if the values of its roots have already been loaded. This is
+        the case for the first block, as the roots of the earlier layers are a
+        prefix of the roots of the last layer
+        :param need: The required (layer, pos) with consecutive pos per layer
+        :param roots: Maps the value of a root to its (B, B') operands
+        :param regs: Receives the registers that have been taken
+        """
+        layers = {}
+        for layer, pos in need:
+            layers.setdefault(layer, []).append(pos)
+
+        for layer in sorted(layers, reverse=True):
+            pos = layers[layer]
+            idx = [self.ridx(layer, _) for _ in pos]
+            if all(self.top[_] in roots or (self.top[_], self.bot[_]) ==
+                   self.unit for _ in idx):
+                continue
+
+            for chunk in range(0, len(idx), 4):
+                count = min(4, len(idx) - chunk)
+                b, b_p = self.e.take(2)
+                regs += [b, b_p]
+                self.load_vec(b, "x1", idx[chunk], count, "x3")
+                self.load_vec(b_p, "x2", idx[chunk], count, "x4")
+                for lane in range(count):
+                    value = self.top[idx[chunk] + lane]
+                    roots.setdefault(value, (f"v{b}.4s[{lane}]",
+                                             f"v{b_p}.4s[{lane}]"))
+
+    def root(self, layer: int, pos: int,
+             roots: Dict[int, Root]) -> Optional[Root]:
+        """ The operands of a root, None for the root 1 """
+        idx = self.ridx(layer, pos)
+        if (self.top[idx], self.bot[idx]) == self.unit:
+            return None
+        return roots[self.top[idx]]
+
+    # -- Butterflies --------------------------------------------------------
+
+    def butterflies(self, regs: List[int],
+                    pairs: List[Butterfly]) -> NoReturn:
+        """
+        Compute the butterflies of a layer on the registers regs. Butterflies
+        with the root 1 only add and subtract, their result b is written to a
+        temporary register, which then replaces b in regs. The others are
+        computed in batches of interleaved instructions
+        :param regs: The registers holding the points, updated in place
+        :param pairs: The butterflies (j, k, root) on points j and k
+        """
+        M = self.m_op
+        for j, k, root in pairs:
+            if root is None:
+                a, b = regs[j], regs[k]
+                t = self.e.take(1)[0]
+                self.e.op("sub", f"v{t}.4s", f"v{a}.4s", f"v{b}.4s")
+                self.e.op("add", f"v{a}.4s", f"v{a}.4s", f"v{b}.4s")
+                regs[k] = t
+                self.e.give([b])
+
+        pairs = [_ for _ in pairs if _[2] is not None]
+        batch = max(1, min(self.spec["batch"], len(self.e.free) // 2))
+        for first in range(0, len(pairs), batch):
+            part = pairs[first:first + batch]
+            tmp = self.e.take(2 * len(part))
+            t, u = tmp[0::2], tmp[1::2]
+            a = [regs[_[0]] for _ in part]
+            b = [regs[_[1]] for _ in part]
+            r = [_[2] for _ in part]
+            n = range(len(part))
+
+            if self.direction == "forward":
+                # (a, b) = (a + b · w, a - b · w)
+                for i in n:
+                    self.e.op("sqdmulh", f"v{t[i]}.4s", f"v{b[i]}.4s", r[i][0])
+                for i in n:
+                    self.e.op("mul", f"v{u[i]}.4s", f"v{b[i]}.4s", r[i][1])
+                for i in n:
+                    self.e.op("sqdmulh", f"v{u[i]}.4s", f"v{u[i]}.4s", M)
+                for i in n:
+                    self.e.op("sub", f"v{t[i]}.4s", f"v{t[i]}.4s", f"v{u[i]}.4s")
+                for i in n:
+                    self.e.op("sub", f"v{b[i]}.4s", f"v{a[i]}.4s", f"v{t[i]}.4s")
+                    self.e.op("add", f"v{a[i]}.4s", f"v{a[i]}.4s", f"v{t[i]}.4s")
+            else:
+                # (a, b) = (a + b, (a - b) · w)
+                for i in n:
+                    self.e.op("sub", f"v{t[i]}.4s", f"v{a[i]}.4s", f"v{b[i]}.4s")
+                    self.e.op("add", f"v{a[i]}.4s", f"v{a[i]}.4s", f"v{b[i]}.4s")
+                for i in n:
+                    self.e.op("sqdmulh", f"v{u[i]}.4s", f"v{t[i]}.4s", r[i][0])
+                for i in n:
+                    self.e.op("mul", f"v{t[i]}.4s", f"v{t[i]}.4s", r[i][1])
+                for i in n:
+                    self.e.op("sqdmulh", f"v{t[i]}.4s", f"v{t[i]}.4s", M)
+                for i in n:
+                    self.e.op("sub", f"v{b[i]}.4s", f"v{u[i]}.4s", f"v{t[i]}.4s")
+
+            self.e.give(tmp)
+
+    def scale(self, regs: List[int]) -> NoReturn:
+        """
+        Multiply the points on the registers regs by the scaling factor 512^-1
+        · 2^32, in batches of interleaved Montgomery multiplications
+        """
+        M, S = self.m_op, f"v{self.s_reg}.4s"
+        batch = max(1, min(self.spec["batch"], len(self.e.free) // 2))
+        for first in range(0, len(regs), batch):
+            part = regs[first:first + batch]
+            tmp = self.e.take(2 * len(part))
+            t, u = tmp[0::2], tmp[1::2]
+            n = range(len(part))
+
+            for i in n:
+                self.e.op("sqdmulh", f"v{t[i]}.4s", f"v{part[i]}.4s", f"{S}[0]")
+            for i in n:
+                self.e.op("mul", f"v{u[i]}.4s", f"v{part[i]}.4s", f"{S}[1]")
+            for i in n:
+                self.e.op("sqdmulh", f"v{u[i]}.4s", f"v{u[i]}.4s", M)
+            for i in n:
+                self.e.op("sub", f"v{part[i]}.4s", f"v{t[i]}.4s", f"v{u[i]}.4s")
+
+            self.e.give(tmp)
+
+    def freeze(self, regs: List[int]) -> NoReturn:
+        """
+        Reduce the points on the registers regs from (-2M, 2M) to [0, M), i.e.
+        add 2M to the negative points and subtract M from the points that are
+        at least M, which is selected using an unsigned minimum
+        """
+        S = f"v{self.s_reg}.4s"
+        batch = max(1, min(self.spec["batch"], len(self.e.free)))
+        for first in range(0, len(regs), batch):
+            part = regs[first:first + batch]
+            t = self.e.take(len(part))
+            n = range(len(part))
+
+            for i in n:
+                self.e.op("ushr", f"v{t[i]}.4s", f"v{part[i]}.4s", "#31")
+            for i in n:
+                self.e.op("mla", f"v{part[i]}.4s", f"v{t[i]}.4s", f"{S}[2]")
+            for i in n:
+                self.e.op("sub", f"v{t[i]}.4s", f"v{part[i]}.4s",
+                          f"v{self.m_reg}.4s")
+            for i in n:
+                self.e.op("umin", f"v{part[i]}.4s", f"v{part[i]}.4s",
+                          f"v{t[i]}.4s")
+
+            self.e.give(t)
+
+    def layer_pairs(self, m: int, s: int, first: int,
+                    root) -> List[Butterfly]:
+        """
+        The butterflies of layer s of a group of m layers on 2^m points
+        starting at point first. The root of sub-block u is root(u)
+        """
+        half = 1 << (m - 1 - s)
+        pairs = []
+        for u in range(1 << s):
+            for j in range(first + 2 * half * u, first + 2 * half * u + half):
+                pairs.append((j, j + half, root(u)))
+        return pairs
+
+    def layer_order(self, m: int) -> List[int]:
+        """ The order of the layers of a group """
+        return list(range(m)) if self.direction == "forward" \
+            else list(range(m))[::-1]
+
+    def header(self, t: int, m: int) -> NoReturn:
+        """ Emit the comment describing the layers of a group """
+        layers = [t + _ for _ in self.layer_order(m)]
+        self.e.raw()
+        self.e.comment(f"Layers {'+'.join(str(_) for _ in layers)}")
+        for layer in layers:
+            self.e.comment(f"NTT {self.direction} layer {layer}: length = "
+                           f"{VAR_N >> layer}, ridx = {self.ridx(layer, 0)}, "
+                           f"loops = {1 << (layer - 1)}")
+        if self.direction == "inverse" and t == 1:
+            self.e.comment("Scale by 512^-1 · 2^32 and reduce to [0, M)")
+        self.e.raw()
+
+    # -- Groups -------------------------------------------------------------
+
+    def vector_group(self, t: int, m: int) -> NoReturn:
+        """
+        Emit a group of m layers starting at layer t that operates on whole
+        vectors. Block b of layer t is split into L / 4 sub-transforms of 2^m
+        vectors at a distance of L integer coefficients, with L the length of
+        the last layer of the group
+        """
+        self.header(t, m)
+
+        last = VAR_N >> (t + m - 1)
+        size = 1 << (m - 1)
+        for b in range(1 << (t - 1)):
+            roots, taken = {}, []
+            need = [(t + s, (b << s) + u) for s in range(m)
+                    for u in range(1 << s)]
+
+            if self.spec["twiddles"] == "block":
+                self.load_roots(need, roots, taken)
+
+            for i in range(last // 4):
+                base = b * (VAR_N * 2 >> t) + 4 * i
+                regs = self.data[:2 * size]
+                for j, reg in enumerate(regs):
+                    self.e.op("ldr", f"q{reg}",
+                              f"[start, #4 * {base + j * last}]")
+
+                for s in self.layer_order(m):
+                    layer = t + s
+                    layer_taken = []
+                    if self.spec["twiddles"] == "layer":
+                        roots = {}
+                        self.load_roots([(layer, (b << s) + u)
+                                         for u in range(1 << s)],
+                                        roots, layer_taken)
+                    pairs = self.layer_pairs(
+                        m, s, 0, lambda u: self.root(layer, (b << s) + u,
+                                                     roots))
+                    self.butterflies(regs, pairs)
+                    self.e.give(layer_taken)
+
+                # The last layer of the inverse NTT scales and reduces its
+                # outputs, see the file description
+                if self.direction == "inverse" and t == 1:
+                    self.scale(regs)
+                    self.freeze(regs)
+
+                for j, reg in enumerate(regs):
+                    self.e.op("str", f"q{reg}",
+                              f"[start, #4 * {base + j * last}]")
+                self.e.raw()
+
+                # The butterflies with the root 1 may have renamed registers,
+                # return the block of data registers to its original state
+                self.release(regs)
+
+            self.e.give(taken)
+
+    def release(self, regs: List[int]) -> NoReturn:
+        """ Return renamed registers and take back the data registers """
+        extra = [_ for _ in regs if _ not in self.data]
+        missing = [_ for _ in self.data[:len(regs)] if _ not in regs]
+        self.e.give(extra)
+        self.e.free = [_ for _ in self.e.free if _ not in missing]
+
+    def lane_group(self, t: int, m: int) -> NoReturn:
+        """
+        Emit the last group of m layers, which includes the layers 8 and 9. A
+        chunk of 4 blocks of layer t, i.e. 2^m vectors, is computed at once.
+        The layers before 8 operate on whole vectors, where the 4 blocks have
+        different roots held in the lanes of the root registers. For the layers
+        8 and 9 every group of 4 vectors (quad) is transposed, such that lane k
+        of vector r holds integer coefficient 4k + r. The butterflies then use
+        a different root per lane. The forward NTT loads the chunk as is and
+        stores the transposed quads using st4, the inverse NTT loads them using
+        ld4 and stores the chunk as is
+        """
+        self.header(t, m)
+
+        forward = self.direction == "forward"
+        count = 1 << m
+        regs = self.data[:count]
+        chunks = VAR_N // (4 * count)
+        vlayers = list(range(m - 2))
+        if not forward:
+            vlayers = vlayers[::-1]
+
+        self.e.op("mov", "x3", "start")
+        self.e.op("mov", "x4", "start")
+
+        # Pointers to the roots of the vector layers, the layers 8 and 9
+        pointers = {}
+        names = ["x5", "x6", "x7", "x9", "x10", "x11", "x12", "x13"]
+        for layer in [t + _ for _ in range(m - 2)] + [8, 9]:
+            pointers[layer] = (names.pop(0), names.pop(0))
+            idx = self.ridx(layer, 0)
+            self.e.op("add", pointers[layer][0], "x1", f"#4 * {idx}")
+            self.e.op("add", pointers[layer][1], "x2", f"#4 * {idx}")
+        self.e.raw()
+
+        self.e.raw(f"    .rept {chunks}")
+        self.e.raw()
+
+        if forward:
+            if m == 2:
+                self.e.op("ld4", self.reglist(regs, "4s"), "[x3]", "#64")
+            else:
+                for q in range(0, count, 4):
+                    self.e.op("ld1", self.reglist(regs[q:q + 4], "4s"),
+                              "[x3]", "#64")
+            self.vector_layers(t, m, regs, vlayers, pointers)
+
+        for q in range(0, count, 4):
+            quad = regs[q:q + 4]
+            if forward:
+                if m > 2:
+                    self.transpose(quad)
+                self.lane_layers(quad, pointers)
+                self.e.op("st4", self.reglist(quad, "4s"), "[x4]", "#64")
+            else:
+                self.e.op("ld4", self.reglist(quad, "4s"), "[x3]", "#64")
+                self.lane_layers(quad, pointers)
+                if m > 2:
+                    self.transpose(quad)
+                else:
+                    self.e.op("st4", self.reglist(quad, "4s"), "[x4]", "#64")
+            self.e.raw()
+
+        if not forward and m > 2:
+            self.vector_layers(t, m, regs, vlayers, pointers)
+            for q in range(0, count, 4):
+                self.e.op("st1", self.reglist(regs[q:q + 4], "4s"),
+                          "[x4]", "#64")
+            self.e.raw()
+
+        self.e.raw("    .endr")
+
+    def vector_layers(self, t: int, m: int, regs: List[int],
+                      vlayers: List[int], pointers: dict) -> NoReturn:
+        """ Emit the layers of the last group that operate on whole vectors """
+        for s in vlayers:
+            layer = t + s
+            width = 1 << s
+            vecs = self.e.take(2 * width)
+            top, bot = vecs[:width], vecs[width:]
+            for table, dst in zip(pointers[layer], (top, bot)):
+                for reg in dst:
+                    self.e.op("ldr", f"q{reg}", f"[{table}]", "#16")
+
+            # Root pos = blk · 2^s + u of the chunk
+            pairs = []
+            for blk in range(4):
+                def root(u, blk=blk):
+                    pos = blk * width + u
+                    return (f"v{top[pos // 4]}.4s[{pos % 4}]",
+                            f"v{bot[pos // 4]}.4s[{pos % 4}]")
+                pairs += self.layer_pairs(m - 2, s, blk << (m - 2), root)
+            self.butterflies(regs, pairs)
+            self.e.give(vecs)
+        self.e.raw()
+
+    def lane_layers(self, quad: List[int], pointers: dict) -> NoReturn:
+        """ Emit the layers 8 and 9 on a transposed quad """
+        r8 = self.e.take(2)
+        r9 = self.e.take_run(2) + self.e.take_run(2)
+        self.e.op("ldr", f"q{r8[0]}", f"[{pointers[8][0]}]", "#16")
+        self.e.op("ldr", f"q{r8[1]}", f"[{pointers[8][1]}]", "#16")
+        self.e.op("ld2", self.reglist(r9[0:2], "4s"), f"[{pointers[9][0]}]",
+                  "#32")
+        self.e.op("ld2", self.reglist(r9[2:4], "4s"), f"[{pointers[9][1]}]",
+                  "#32")
+
+        root8 = (f"v{r8[0]}.4s", f"v{r8[1]}.4s")
+        root9 = [(f"v{r9[0]}.4s", f"v{r9[2]}.4s"),
+                 (f"v{r9[1]}.4s", f"v{r9[3]}.4s")]
+        layer8 = [(0, 2, root8), (1, 3, root8)]
+        layer9 = [(0, 1, root9[0]), (2, 3, root9[1])]
+
+        regs = list(quad)
+        if self.direction == "forward":
+            self.butterflies(regs, layer8)
+            self.butterflies(regs, layer9)
+        else:
+            self.butterflies(regs, layer9)
+            self.butterflies(regs, layer8)
+        self.e.give(r8 + r9)
+
+    def transpose(self, quad: List[int]) -> NoReturn:
+        """ Transpose a quad, i.e. 4 by 4 integer coefficients, in place """
+        tmp = self.e.take(4)
+        a = [f"v{_}" for _ in quad]
+        t = [f"v{_}" for _ in tmp]
+        self.e.op("trn1", f"{t[0]}.4s", f"{a[0]}.4s", f"{a[1]}.4s")
+        self.e.op("trn2", f"{t[1]}.4s", f"{a[0]}.4s", f"{a[1]}.4s")
+        self.e.op("trn1", f"{t[2]}.4s", f"{a[2]}.4s", f"{a[3]}.4s")
+        self.e.op("trn2", f"{t[3]}.4s", f"{a[2]}.4s", f"{a[3]}.4s")
+        self.e.op("trn1", f"{a[0]}.2d", f"{t[0]}.2d", f"{t[2]}.2d")
+        self.e.op("trn1", f"{a[1]}.2d", f"{t[1]}.2d", f"{t[3]}.2d")
+        self.e.op("trn2", f"{a[2]}.2d", f"{t[0]}.2d", f"{t[2]}.2d")
+        self.e.op("trn2", f"{a[3]}.2d", f"{t[1]}.2d", f"{t[3]}.2d")
+        self.e.give(tmp)
+
+    @staticmethod
+    def reglist(regs: List[int], arrangement: str) -> str:
+        """ Format a list of consecutive registers """
+        return "{" + ", ".join(f"v{_}.{arrangement}" for _ in regs) + "}"
+
+    # -- File ---------------------------------------------------------------
+
+    def generate(self) -> str:
+        """ Generate the complete assembly file """
+        for t, m in self.layers():
+            # Data registers that are not needed by this group are free
+            spare = self.data[1 << m:]
+            self.e.give(spare)
+            if t + m - 1 == VAR_LAYERS:
+                self.lane_group(t, m)
+            else:
+                self.vector_group(t, m)
+            self.e.free = [_ for _ in self.e.free if _ not in spare]
+        body = self.e.lines
+
+        name = FUNCTIONS[self.target]
+        spec = self.spec
+        saved = re.search(r"\b[vqds](8|9|1[0-5])\b", "\n".join(body))
+
+        head = [
+            "/* This file has been generated by samples/polymult_py/"
+            "gen_ntt_asm.py, please",
+            " * change the strategy and regenerate it instead of editing it."
+            " Strategy:",
+            f" * groups = {'+'.join(str(_) for _ in spec['groups'])}, "
+            f"twiddles = {spec['twiddles']}, batch = {spec['batch']}, "
+            f"data = v{spec['data']}" +
+            (" */" if self.first == 1 else ""),
+        ]
+        if self.first == 2:
+            head += [
+                " *",
+                " * The first layer is not computed here, it has been merged "
+                "into the Good's",
+                " * permutation (see asm_goods.s) */",
+            ]
+
+        head += [
+            "",
+            "/* Switch to the text segment - this contains the program code */",
+            "",
+            ".text",
+            "",
+            "/* Provide function declarations */",
+            "",
+            f".global {name}",
+            f".type {name}, %function",
+            "",
+            f"{name}:",
+            "",
+        ]
+
+        if saved:
+            head += [
+                "    /* Store the callee-saved registers v8 - v15 (their lower "
+                "64 bits) that",
+                "     * are used by this subroutine */",
+                "",
+                "    stp     d8, d9, [sp, #-64]!",
+                "    stp     d10, d11, [sp, #16]",
+                "    stp     d12, d13, [sp, #32]",
+                "    stp     d14, d15, [sp, #48]",
+                "",
+            ]
+        else:
+            head += [
+                "    /* Due to our choice of registers we do not need (to "
+                "store) callee-saved",
+                "     * registers. Neither do we use the procedure link "
+                "register, as we do not",
+                "     * branch to any functions from within this subroutine. "
+                "The function",
+                "     * prologue is therefore empty. */",
+                "",
+            ]
+
+        head += [
+            "    /* Alias registers for a specific purpose (and readability) */",
+            "",
+            "    start   .req x0     // Store pointer to the first integer "
+            "coefficient",
+            "    M       .req w15    // Store the constant value M = 6984193",
+            "",
+            "    /* Initialize constant values */",
+            "",
+            "    mov     M, #0x9201              // 6984193 (= M)",
+            "    movk    M, #0x6a, lsl #16",
+            f"    dup     v{self.m_reg}.4s, M",
+        ]
+
+        if self.direction == "inverse":
+            alias = head.index("    M       .req w15    // Store the constant "
+                               "value M = 6984193")
+            head.insert(alias + 1, "    factor  .req w14    // Store the "
+                        "constant values (B, B') and 2M")
+            head += [
+                "",
+                "    // The base multiplication leaves a factor 2^-32 in every "
+                "coefficient,",
+                "    // which we compensate for together with the factor "
+                "512^-1.",
+                "    // 512^-1 mod 6984193              = 6970552",
+                "    // B  = 6970552 · 2^32 · R mod M   = 4877441",
+                "    // B' = B · M' mod R               = 1715657345",
+                "",
+                "    mov     factor, #0x6c81         // 4877441 (= B)",
+                "    movk    factor, #0x4a, lsl #16",
+                f"    mov     v{self.s_reg}.4s[0], factor",
+                "",
+                "    mov     factor, #0xda81         // 1715657345 (= B')",
+                "    movk    factor, #0x6642, lsl #16",
+                f"    mov     v{self.s_reg}.4s[1], factor",
+                "",
+                "    mov     factor, #0x2402         // 13968386 (= 2M)",
+                "    movk    factor, #0xd5, lsl #16",
+                f"    mov     v{self.s_reg}.4s[2], factor",
+            ]
+
+        tail = [
+            "",
+            "    .unreq  start",
+            "    .unreq  M",
+        ]
+        if self.direction == "inverse":
+            tail += ["    .unreq  factor"]
+        tail += [""]
+        if saved:
+            tail += [
+                "    /* Restore the callee-saved registers */",
+                "",
+                "    ldp     d10, d11, [sp, #16]",
+                "    ldp     d12, d13, [sp, #32]",
+                "    ldp     d14, d15, [sp, #48]",
+                "    ldp     d8, d9, [sp], #64",
+                "",
+            ]
+        tail += ["    ret     lr", ""]
+
+        return "\n".join(head + body + tail)
+
+
+class Simulator:
+    """
+    The class Simulator executes the subset of AArch64 instructions emitted by
+    the Generator with bit exact 32 bit lanes. Memory is modeled as a
+    dictionary of 32 bit words, which catches any access outside the
+    coefficients, the root tables and the stack
+    """
+
+    def __init__(self, mem: Dict[int, int]) -> NoReturn:
+        """ Class constructor used to initialize an instance of the class """
+        self.mem = mem
+        self.v = [[random.getrandbits(32) - (1 << 31) for _ in range(4)]
+                  for _ in range(32)]
+        self.x = {}
+        self.alias = {}
+
+    @staticmethod
+    def s32(value: int) -> int:
+        """ Wrap an integer to a signed 32 bit integer """
+        value &= 0xffffffff
+        return value - (1 << 32) if value >> 31 else value
+
+    def load(self, addr: int) -> int:
+        """ Load a 32 bit word """
+        if addr not in self.mem:
+            raise ValueError(f"load from invalid address {addr:#x}")
+        return self.mem[addr]
+
+    def store(self, addr: int, value: int) -> NoReturn:
+        """ Store a 32 bit word """
+        if addr not in self.mem:
+            raise ValueError(f"store to invalid address {addr:#x}")
+        self.mem[addr] = self.s32(value)
+
+    def vreg(self, operand: str) -> Tuple[int, Optional[int]]:
+        """ Parse a vector operand as (register, lane or None) """
+        match = re.fullmatch(r"[vqsd](\d+)(?:\.\w+)?(?:\[(\d)\])?", operand)
+        lane = match.group(2)
+        return int(match.group(1)), (int(lane) if lane is not None else None)
+
+    def addr(self, operand: str) -> Tuple[str, int]:
+        """ Parse [xN] or [xN, #imm] as (register, address) """
+        match = re.fullmatch(r"\[(\w+)(?:, #([-\w *]+))?\]!?", operand)
+        base = self.alias.get(match.group(1), match.group(1))
+        offset = eval(match.group(2)) if match.group(2) else 0
+        return base, self.x[base] + offset
+
+    def run(self, text: str, args: Dict[str, int]) -> NoReturn:
+        """ Execute an assembly file, with the arguments in registers """
+        self.x.update(args)
+        lines = self.expand(text)
+        for line in lines:
+            self.step(line)
+
+    @staticmethod
+    def expand(text: str) -> List[str]:
+        """ Strip comments and unroll the .rept directives """
+        text = re.sub(r"/\*.*?\*/", "", text, flags=re.S)
+        lines, stack = [], [[1, []]]
+        for line in text.split("\n"):
+            line = line.split("//")[0].strip()
+            if not line:
+                continue
+            if line.startswith(".rept"):
+                stack.append([int(line.split()[1]), []])
+            elif line.startswith(".endr"):
+                count, body = stack.pop()
+                stack[-1][1] += body * count
+            else:
+                stack[-1][1].append(line)
+        return stack[0][1]
+
+    def step(self, line: str) -> NoReturn:
+        """ Execute a single line """
+        if line.endswith(":") or line.startswith("."):
+            return
+        if ".req" in line:
+            name, _, reg = line.split()
+            self.alias[name] = reg
+            return
+
+        mnemonic, _, rest = line.partition(" ")
+        ops = [_.strip() for _ in
+               re.split(r",\s*(?![^{]*\})(?![^\[]*\])", rest.strip())]
+        ops = [self.alias.get(_, _) for _ in ops]
+        getattr(self, "op_" + mnemonic)(ops)
+
+    # -- Scalar instructions ------------------------------------------------
+
+    def op_mov(self, ops: List[str]) -> NoReturn:
+        if ops[0].startswith("v"):
+            d, lane = self.vreg(ops[0])
+            self.v[d][lane] = self.s32(self.x[ops[1].replace("w", "x")])
+        elif ops[1].startswith("#"):
+            self.x[ops[0].replace("w", "x")] = int(ops[1][1:], 0)
+        else:
+            self.x[ops[0]] = self.x[ops[1]]
+
+    def op_movk(self, ops: List[str]) -> NoReturn:
+        reg = ops[0].replace("w", "x")
+        shift = int(ops[2].split("#")[1])
+        self.x[reg] = (self.x[reg] & ~(0xffff << shift)) | \
+            (int(ops[1][1:], 0) << shift)
+
+    def op_add(self, ops: List[str]) -> NoReturn:
+        if ops[0].startswith("v"):
+            self.vec3(ops, lambda a, b: a + b)
+        else:
+            self.x[ops[0]] = self.x[ops[1]] + eval(ops[2][1:])
+
+    def op_ret(self, ops: List[str]) -> NoReturn:
+        pass
+
+    # -- Memory instructions ------------------------------------------------
+
+    def post(self, ops: List[str], base: str) -> NoReturn:
+        """ Apply a post-increment or pre-index writeback """
+        if len(ops) > 2 and ops[-1].startswith("#"):
+            self.x[base] += int(ops[-1][1:])
+
+    def op_ldr(self, ops: List[str]) -> NoReturn:
+        reg, _ = self.vreg(ops[0])
+        lanes = {"s": 1, "d": 2, "q": 4}[ops[0][0]]
+        base, addr = self.addr(ops[1])
+        self.v[reg] = [self.load(addr + 4 * _) if _ < lanes else 0
+                       for _ in range(4)]
+        self.post(ops, base)
+
+    def op_str(self, ops: List[str]) -> NoReturn:
+        reg, _ = self.vreg(ops[0])
+        base, addr = self.addr(ops[1])
+        for lane in range(4):
+            self.store(addr + 4 * lane, self.v[reg][lane])
+        self.post(ops, base)
+
+    def structure(self, ops: List[str], load: bool) -> NoReturn:
+        """ ld1, ld2, ld4, st1 and st4 (multiple structures) """
+        regs = [self.vreg(_)[0] for _ in ops[0].strip("{}").split(", ")]
+        base, addr = self.addr(ops[1])
+        n = int(self.mnemonic[2])
+        if n == 1:
+            order = [(r, k) for r in range(len(regs)) for k in range(4)]
+        else:
+            order = [(r, k) for k in range(4) for r in range(n)]
+        for i, (r, k) in enumerate(order):
+            if load:
+                self.v[regs[r]][k] = self.load(addr + 4 * i)
+            else:
+                self.store(addr + 4 * i, self.v[regs[r]][k])
+        self.post(ops, base)
+
+    def op_ld1(self, ops: List[str]) -> NoReturn:
+        self.mnemonic = "ld1"
+        self.structure(ops, True)
+
+    def op_ld2(self, ops: List[str]) -> NoReturn:
+        self.mnemonic = "ld2"
+        self.structure(ops, True)
+
+    def op_ld4(self, ops: List[str]) -> NoReturn:
+        self.mnemonic = "ld4"
+        self.structure(ops, True)
+
+    def op_st1(self, ops: List[str]) -> NoReturn:
+        self.mnemonic = "st1"
+        self.structure(ops, False)
+
+    def op_st4(self, ops: List[str]) -> NoReturn:
+        self.mnemonic = "st4"
+        self.structure(ops, False)
+
+    def pair(self, ops: List[str], load: bool) -> NoReturn:
+        """ stp and ldp of d registers, including the writeback forms """
+        base, addr = self.addr(ops[2])
+        if ops[2].endswith("!"):
+            self.x[base] = addr
+        for i, operand in enumerate(ops[:2]):
+            reg, _ = self.vreg(operand)
+            for lane in range(2):
+                if load:
+                    self.v[reg][lane] = self.load(addr + 8 * i + 4 * lane)
+                    self.v[reg][lane + 2] = 0
+                else:
+                    self.store(addr + 8 * i + 4 * lane, self.v[reg][lane])
+        if len(ops) > 3:
+            self.x[base] += int(ops[3][1:])
+
+    def op_stp(self, ops: List[str]) -> NoReturn:
+        self.pair(ops, False)
+
+    def op_ldp(self, ops: List[str]) -> NoReturn:
+        self.pair(ops, True)
+
+    # -- Vector instructions ------------------------------------------------
+
+    def vec3(self, ops: List[str], func) -> NoReturn:
+        """ Lane wise operation, the last operand may select a lane """
+        d, _ = self.vreg(ops[0])
+        a, _ = self.vreg(ops[1])
+        b, lane = self.vreg(ops[2])
+        src = [self.v[b][lane]] * 4 if lane is not None else self.v[b]
+        self.v[d] = [self.s32(func(x, y)) for x, y in zip(self.v[a], src)]
+
+    def op_sub(self, ops: List[str]) -> NoReturn:
+        self.vec3(ops, lambda a, b: a - b)
+
+    def op_mul(self, ops: List[str]) -> NoReturn:
+        self.vec3(ops, lambda a, b: a * b)
+
+    def op_sqdmulh(self, ops: List[str]) -> NoReturn:
+        def sqdmulh(a, b):
+            return min((2 * a * b) >> 32, (1 << 31) - 1)
+        self.vec3(ops, sqdmulh)
+
+    def op_mla(self, ops: List[str]) -> NoReturn:
+        d, _ = self.vreg(ops[0])
+        acc = list(self.v[d])
+        self.vec3(ops, lambda a, b: a * b)
+        self.v[d] = [self.s32(x + y) for x, y in zip(acc, self.v[d])]
+
+    def op_umin(self, ops: List[str]) -> NoReturn:
+        self.vec3(ops, lambda a, b: min(a & 0xffffffff, b & 0xffffffff))
+
+    def op_ushr(self, ops: List[str]) -> NoReturn:
+        d, _ = self.vreg(ops[0])
+        a, _ = self.vreg(ops[1])
+        shift = int(ops[2][1:])
+        self.v[d] = [self.s32((_ & 0xffffffff) >> shift) for _ in self.v[a]]
+
+    def op_dup(self, ops: List[str]) -> NoReturn:
+        d, _ = self.vreg(ops[0])
+        self.v[d] = [self.s32(self.x[ops[1].replace("w", "x")])] * 4
+
+    def trn(self, ops: List[str], odd: int) -> NoReturn:
+        d, _ = self.vreg(ops[0])
+        a, _ = self.vreg(ops[1])
+        b, _ = self.vreg(ops[2])
+        va, vb = self.v[a], self.v[b]
+        if ops[0].endswith(".4s"):
+            self.v[d] = [va[odd], vb[odd], va[2 + odd], vb[2 + odd]]
+        else:
+            self.v[d] = va[2 * odd:2 * odd + 2] + vb[2 * odd:2 * odd + 2]
+
+    def op_trn1(self, ops: List[str]) -> NoReturn:
+        self.trn(ops, 0)
+
+    def op_trn2(self, ops: List[str]) -> NoReturn:
+        self.trn(ops, 1)
+
+
+def simulate(direction: str, text: str, tables: Dict[str, List[int]],
+             cvec: List[int]) -> List[int]:
+    """
+    Execute a generated function on a coefficient vector
+    :param direction: Either 'forward' or 'inverse'
+    :param text: The generated assembly
+    :param tables: The precomputed roots
+    :param cvec: The 512 integer coefficients
+    :return: The resulting 512 integer coefficients
+    """
+    coeffs, top, bot, stack = 0x10000, 0x20000, 0x30000, 0x40000
+    top_t, bot_t = (tables[_] for _ in TABLES[direction])
+
+    mem = {}
+    for base, values in ((coeffs, cvec), (top, top_t), (bot, bot_t)):
+        for i, value in enumerate(values):
+            mem[base + 4 * i] = value
+    for i in range(16):
+        mem[stack - 64 + 4 * i] = 0
+
+    sim = Simulator(mem)
+    saved = [list(_[:2]) for _ in sim.v[8:16]]
+    sim.run(text, {"x0": coeffs, "x1": top, "x2": bot, "sp": stack})
+
+    # Verify the calling convention, the stack and lower 64 bits of v8 - v15
+    assert sim.x["sp"] == stack, "the stack pointer has not been restored"
+    assert [_[:2] for _ in sim.v[8:16]] == saved, "v8 - v15 not restored"
+
+    return [mem[coeffs + 4 * _] for _ in range(VAR_N)]
+
+
+def verify(target: str, text: str, tables: Dict[str, List[int]],
+           runs: int = 4) -> NoReturn:
+    """
+    Compare a generated function with the NTT class of lib_common.py, raise an
+    AssertionError on a mismatch. The forward NTT is tested with 16 bit inputs
+    and the inverse NTT with random inputs in (-M, M), which is what ntt761()
+    uses. The input of forward_l2 is the output of the first layer, whose root
+    is 1. The output of the inverse NTT has to be in [0, M)
+    :param target: Either 'forward', 'forward_l2' or 'inverse'
+    :param text: The generated assembly
+    :param tables: The precomputed roots
+    :param runs: The number of random inputs
+    """
+    # Recover the roots w from the Montgomery representation B = w · 2^31
+    r_inv = pow(2, -31, VAR_Q)
+    roots = [(_ * r_inv) % VAR_Q for _ in tables["MR_top"]]
+    roots_inv = [(_ * r_inv) % VAR_Q for _ in tables["MR_inv_top"]]
+    ntt = NTT(VAR_Q, VAR_N, roots, roots_inv)
+
+    direction = direction_of(target)
+    bound = (1 << 15) if direction == "forward" else VAR_Q
+    for run in range(runs):
+        # The sum of 512 inputs of the inverse NTT can exceed 32 bits if they
+        # all are close to M, so only the forward NTT is tested with the bound
+        if run == 0 and direction == "forward":
+            cvec = [bound - 1] * VAR_N
+        else:
+            cvec = [random.randint(-bound + 1, bound - 1)
+                    for _ in range(VAR_N)]
+
+        if FIRST[target] == 2:
+            half = VAR_N // 2
+            result = simulate(direction, text, tables,
+                              [cvec[_] + cvec[_ + half] for _ in range(half)] +
+                              [cvec[_] - cvec[_ + half] for _ in range(half)])
+        else:
+            result = simulate(direction, text, tables, cvec)
+
+        expected = [_ % VAR_Q for _ in cvec]
+        if direction == "forward":
+            ntt.forward_iti(expected)
+            result = [_ % VAR_Q for _ in result]
+        else:
+            # The assembly compensates for the factor 2^-32 of the base
+            # multiplication as well
+            ntt.inverse_iti(expected)
+            expected = [(_ << 32) % VAR_Q for _ in expected]
+
+        assert result == expected, f"{target} NTT mismatch"
+
+
+def generate(target: str, spec: dict,
+             tables: Dict[str, List[int]]) -> str:
+    """ Generate and verify the assembly of a single target """
+    text = Generator(target, spec, tables).generate()
+    verify(target, text, tables)
+    return text
+
+
+def main() -> NoReturn:
+    """ Parse the command line, generate, verify and write the files """
+    parser = argparse.ArgumentParser(
+        description="Generate the NTT assembly of ntrulpr761 (aarch64)")
+    parser.add_argument("--spec", help="JSON file holding the strategy")
+    parser.add_argument("--opt", default=OPT_DIR,
+                        help="The optimized implementation to write to")
+    parser.add_argument("--out", help="Write into this directory instead")
+    for target in DEFAULT_SPEC:
+        option = target.replace("_", "-")
+        parser.add_argument(f"--groups-{option}", type=int, nargs="+")
+        parser.add_argument(f"--twiddles-{option}",
+                            choices=["block", "layer"])
+        parser.add_argument(f"--batch-{option}", type=int)
+        parser.add_argument(f"--data-{option}", type=int)
+    args = parser.parse_args()
+
+    spec = json.loads(json.dumps(DEFAULT_SPEC))
+    if args.spec:
+        with open(args.spec) as file:
+            for target, values in json.load(file).items():
+                spec[target].update(values)
+    for target in spec:
+        for key in spec[target]:
+            value = getattr(args, f"{key}_{target}")
+            if value is not None:
+                spec[target][key] = value
+
+    tables = load_tables(f"{args.opt}/ntt/mult.c")
+    out = args.out or f"{args.opt}/ntt"
+    for target in spec:
+        try:
+            text = generate(target, spec[target], tables)
+        except (ValueError, AssertionError) as error:
+            sys.exit(f"gen_ntt_asm.py: {error}")
+        path = f"{out}/asm_ntt_{target}.s"
+        with open(path, "w") as file:
+            file.write(text)
+        print(f"{path}: {spec[target]}")
+
+
+if __name__ == "__main__":
+    main()
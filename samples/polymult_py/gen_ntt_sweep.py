@@ -0,0 +1,143 @@
+#!/usr/bin/env python3
+
+import argparse
+import itertools
+import json
+import re
+import shutil
+import subprocess
+import sys
+from typing import Dict, Iterator, List, NoReturn
+
+import gen_ntt_asm
+
+"""
+This file benchmarks a range of strategies of gen_ntt_asm.py on the device it
+runs on, such that the layer merging of the NTT can be tuned for a specific
+microarchitecture. The optimized implementation is copied into a scratch
+directory once. For every strategy the assembly is generated (and verified),
+the benchmark is rebuilt using 'make speed' and the cycle counts of
+__asm_ntt_forward(), __asm_ntt_forward_l2() and __asm_ntt_inverse() are read
+from its output. The targets are independent, so each is swept while the others
+keep the default strategy. The best strategies are printed and can be written to a JSON
+file, which is accepted by gen_ntt_asm.py, e.g.
+
+    python3 gen_ntt_sweep.py --best best.json
+    python3 gen_ntt_asm.py --spec best.json
+
+The benchmark reads the cycle counter PMCCNTR_EL0, see enableccnt.
+"""
+
+# Match a line of the benchmark output, e.g. '| name | med: 1234 |'
+BENCH = re.compile(r"\|\s*(?:\x1b\[[0-9;]*m)?(\S+)\s*(?:\x1b\[[0-9;]*m)?\s*"
+                   r"\|\s*med:\s*(\d+)")
+
+
+def compositions(layers: int, largest: int) -> Iterator[List[int]]:
+    """
+    Generate all ways to split a number of layers into groups
+    :param layers: The number of layers
+    :param largest: The maximum number of layers of a group
+    :return: Iterator over the group sizes
+    """
+    if layers == 0:
+        yield []
+        return
+    for size in range(1, min(largest, layers) + 1):
+        for rest in compositions(layers - size, largest):
+            yield [size] + rest
+
+
+def strategies(target: str, args) -> Iterator[dict]:
+    """ Generate the strategies of a target that are swept """
+    layers = gen_ntt_asm.VAR_LAYERS - gen_ntt_asm.FIRST[target] + 1
+    for tail in (2, 3, 4):
+        for groups in compositions(layers - tail, 4):
+            if len(groups) + 1 > args.max_groups:
+                continue
+            groups = groups + [tail]
+            if target == "inverse":
+                groups = groups[::-1]
+            for twiddles, batch in itertools.product(args.twiddles,
+                                                     args.batch):
+                yield {"groups": groups, "twiddles": twiddles,
+                       "batch": batch, "data": 0}
+
+
+def benchmark(work: str, runs: int) -> Dict[str, int]:
+    """
+    Rebuild and run the benchmark, take the minimum of the medians of a number
+    of runs for every benchmarked function
+    """
+    subprocess.run(["make", "-C", work, "speed"], check=True,
+                   stdout=subprocess.DEVNULL)
+    cycles = {}
+    for _ in range(runs):
+        output = subprocess.run(["./benchmark.out"], cwd=work, check=True,
+                                capture_output=True, text=True).stdout
+        for name, value in BENCH.findall(output):
+            cycles[name] = min(cycles.get(name, int(value)), int(value))
+    return cycles
+
+
+def main() -> NoReturn:
+    """ Parse the command line and sweep the strategies """
+    parser = argparse.ArgumentParser(
+        description="Benchmark the NTT assembly strategies of gen_ntt_asm.py")
+    parser.add_argument("--opt", default=gen_ntt_asm.OPT_DIR,
+                        help="The optimized implementation")
+    parser.add_argument("--work", default="/tmp/ntt_sweep",
+                        help="The scratch directory")
+    parser.add_argument("--target", choices=list(gen_ntt_asm.FUNCTIONS),
+                        nargs="+", default=list(gen_ntt_asm.FUNCTIONS))
+    parser.add_argument("--twiddles", choices=["block", "layer"], nargs="+",
+                        default=["block", "layer"])
+    parser.add_argument("--batch", type=int, nargs="+", default=[2, 4])
+    parser.add_argument("--max-groups", type=int, default=3,
+                        help="The maximum number of groups (passes)")
+    parser.add_argument("--runs", type=int, default=3)
+    parser.add_argument("--best", help="Write the best strategies (JSON)")
+    args = parser.parse_args()
+
+    shutil.rmtree(args.work, ignore_errors=True)
+    shutil.copytree(args.opt, args.work)
+    subprocess.run(["make", "-C", args.work, "clean"],
+                   stdout=subprocess.DEVNULL, stderr=subprocess.DEVNULL)
+    tables = gen_ntt_asm.load_tables(f"{args.work}/ntt/mult.c")
+
+    best = json.loads(json.dumps(gen_ntt_asm.DEFAULT_SPEC))
+    for target in args.target:
+        name = f"{gen_ntt_asm.FUNCTIONS[target]}()"
+        results = []
+        for spec in strategies(target, args):
+            try:
+                text = gen_ntt_asm.generate(target, spec, tables)
+            except ValueError as error:
+                print(f"skipped {spec}: {error}", file=sys.stderr)
+                continue
+            with open(f"{args.work}/ntt/asm_ntt_{target}.s", "w") as file:
+                file.write(text)
+
+            cycles = benchmark(args.work, args.runs)[name]
+            results.append((cycles, spec))
+            print(f"{name:<24}{cycles:>8}  {spec}", flush=True)
+
+        # Restore the default strategy before sweeping the other targets
+        text = gen_ntt_asm.generate(target, best[target], tables)
+        with open(f"{args.work}/ntt/asm_ntt_{target}.s", "w") as file:
+            file.write(text)
+
+        results.sort(key=lambda _: _[0])
+        print(f"\nFastest strategies of {name}")
+        for cycles, spec in results[:5]:
+            print(f"{cycles:>8}  {spec}")
+        print()
+        best[target] = results[0][1]
+
+    if args.best:
+        with open(args.best, "w") as file:
+            json.dump({_: best[_] for _ in args.target}, file, indent=4)
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,71 @@
+#!/usr/bin/env python3
+
+import unittest
+
+import gen_ntt_asm
+
+# Define the path of the precomputed roots, relative to the directory root
+MULT_C = f"{gen_ntt_asm.OPT_DIR}/ntt/mult.c"
+
+
+class TestGenNTTAsm(unittest.TestCase):
+    """ Class for testing the generated NTT assembly using its simulator """
+
+    @classmethod
+    def setUpClass(cls):
+        """ setUpClass is used to define objects for the whole class """
+
+        # Parse the precomputed roots of the optimized implementation
+        cls.tables = gen_ntt_asm.load_tables(MULT_C)
+
+    def check(self, direction, groups, twiddles="block", batch=4, data=0):
+        """ Generate a strategy, generate() verifies it using lib_common """
+        spec = {"groups": groups, "twiddles": twiddles, "batch": batch,
+                "data": data}
+        text = gen_ntt_asm.generate(direction, spec, self.tables)
+        self.assertIn(gen_ntt_asm.FUNCTIONS[direction], text)
+
+    def test_default(self):
+        """ Testing the strategies of the files in the repository """
+        for direction, spec in gen_ntt_asm.DEFAULT_SPEC.items():
+            self.check(direction, **spec)
+
+    def test_groups(self):
+        """
+        Testing various layer merging strategies, including the ones that
+        merge layers 8 and 9 with the layers operating on whole vectors
+        """
+        for groups in ([3, 3, 3], [4, 1, 4], [1, 2, 2, 2, 2], [2, 4, 3]):
+            self.check("forward", groups)
+            self.check("inverse", groups[::-1])
+
+    def test_forward_l2(self):
+        """
+        Testing the forward NTT without its first layer, which is merged into
+        the Good's permutation
+        """
+        for groups in ([4, 4], [2, 3, 3], [3, 3, 2], [1, 1, 2, 4]):
+            self.check("forward_l2", groups)
+        self.check("forward_l2", [4, 4], twiddles="layer", data=16)
+
+    def test_twiddles(self):
+        """ Testing the twiddle layouts and register allocations """
+        self.check("forward", [4, 2, 3], twiddles="layer", batch=1)
+        self.check("inverse", [3, 2, 4], twiddles="layer", batch=8)
+        self.check("forward", [3, 4, 2], data=16)
+        self.check("inverse", [2, 4, 3], data=16)
+
+    def test_invalid(self):
+        """ Testing whether invalid strategies are rejected """
+        with self.assertRaises(ValueError):
+            self.check("forward", [4, 4, 1])
+        with self.assertRaises(ValueError):
+            self.check("forward", [5, 2, 2])
+        with self.assertRaises(ValueError):
+            self.check("inverse", [2, 3, 3])
+        with self.assertRaises(ValueError):
+            self.check("forward_l2", [4, 3, 2])
+
+
+if __name__ == "__main__":
+    unittest.main()